@@ -8,7 +8,9 @@
  */
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include "charsets.h"
+#include "memstats.h"
 #include "bibutils.h"
 #include "args.h"
 
@@ -111,3 +113,153 @@ process_charsets( int *argc, char *argv[], param *p )
 	}
 }
 
+
+static int
+args_sortkey( char *sortname, unsigned char *sortkey )
+{
+	if ( !strcasecmp( sortname, "refnum" ) ||
+	     !strcasecmp( sortname, "citekey" ) )
+		*sortkey = BIBL_SORT_REFNUM;
+	else if ( !strcasecmp( sortname, "year" ) )
+		*sortkey = BIBL_SORT_YEAR;
+	else if ( !strcasecmp( sortname, "author" ) )
+		*sortkey = BIBL_SORT_AUTHOR;
+	else return 0;
+	return 1;
+}
+
+/* Process sort request; like charsets, switches are order independent */
+void
+process_sort( int *argc, char *argv[], param *p )
+{
+	int i, j, subtract;
+	i = 1;
+	while ( i<*argc ) {
+		subtract = 0;
+		if ( args_match( argv[i], NULL, "--sort" ) ) {
+			if ( i+1 >= *argc || !args_sortkey( argv[i+1], &(p->sortkey) ) ) {
+				fprintf( stderr, "%s: error --sort takes the argument "
+					"refnum, year, or author\n", p->progname );
+				exit( EXIT_FAILURE );
+			}
+			subtract = 2;
+		}
+		if ( subtract ) {
+			for ( j=i+subtract; j<*argc; ++j )
+				argv[j-subtract] = argv[j];
+			*argc -= subtract;
+		} else i++;
+	}
+}
+
+/* Process duplicate removal request */
+void
+process_dedup( int *argc, char *argv[], param *p )
+{
+	int i, j, subtract;
+	i = 1;
+	while ( i<*argc ) {
+		subtract = 0;
+		if ( args_match( argv[i], NULL, "--dedup" ) ) {
+			p->dedup = BIBL_DEDUP_DROP;
+			subtract = 1;
+		} else if ( args_match( argv[i], NULL, "--dedup-merge" ) ) {
+			p->dedup = BIBL_DEDUP_MERGE;
+			subtract = 1;
+		}
+		if ( subtract ) {
+			for ( j=i+subtract; j<*argc; ++j )
+				argv[j-subtract] = argv[j];
+			*argc -= subtract;
+		} else i++;
+	}
+}
+
+/* Process value sharing request */
+void
+process_intern( int *argc, char *argv[], param *p )
+{
+	int i, j, subtract;
+	i = 1;
+	while ( i<*argc ) {
+		subtract = 0;
+		if ( args_match( argv[i], NULL, "--intern" ) ) {
+			p->intern = 1;
+			subtract = 1;
+		}
+		if ( subtract ) {
+			for ( j=i+subtract; j<*argc; ++j )
+				argv[j-subtract] = argv[j];
+			*argc -= subtract;
+		} else i++;
+	}
+}
+
+static int
+args_convcache( char *size, long *convcache )
+{
+	char *end;
+	*convcache = strtol( size, &end, 10 );
+	if ( end==size || *end || *convcache < 0 ) return 0;
+	return 1;
+}
+
+/* Process conversion cache request */
+void
+process_convcache( int *argc, char *argv[], param *p )
+{
+	int i, j, subtract;
+	i = 1;
+	while ( i<*argc ) {
+		subtract = 0;
+		if ( args_match( argv[i], NULL, "--convert-cache" ) ) {
+			if ( i+1 >= *argc || !args_convcache( argv[i+1], &(p->convcache) ) ) {
+				fprintf( stderr, "%s: error --convert-cache takes the "
+					"number of conversions to keep\n", p->progname );
+				exit( EXIT_FAILURE );
+			}
+			subtract = 2;
+		}
+		if ( subtract ) {
+			for ( j=i+subtract; j<*argc; ++j )
+				argv[j-subtract] = argv[j];
+			*argc -= subtract;
+		} else i++;
+	}
+}
+
+/* Process memory statistics request, reported as the program exits */
+static char *memstats_progname = NULL;
+
+static void
+report_memstats( void )
+{
+	memstats_report( stderr, memstats_progname );
+	if ( memstats_progname ) free( memstats_progname );
+	memstats_progname = NULL;
+}
+
+void
+process_memstats( int *argc, char *argv[], param *p )
+{
+	static int registered = 0;
+	int i, j, subtract;
+	i = 1;
+	while ( i<*argc ) {
+		subtract = 0;
+		if ( args_match( argv[i], NULL, "--memstats" ) ) {
+			if ( !registered ) {
+				if ( p->progname )
+					memstats_progname = strdup( p->progname );
+				atexit( report_memstats );
+				registered = 1;
+			}
+			subtract = 1;
+		}
+		if ( subtract ) {
+			for ( j=i+subtract; j<*argc; ++j )
+				argv[j-subtract] = argv[j];
+			*argc -= subtract;
+		} else i++;
+	}
+}
@@ -12,5 +12,10 @@
 extern void args_tellversion( char *progname );
 extern int args_match( char *check, char *shortarg, char *longarg );
 extern void process_charsets( int *argc, char *argv[], param *p );
+extern void process_sort( int *argc, char *argv[], param *p );
+extern void process_dedup( int *argc, char *argv[], param *p );
+extern void process_intern( int *argc, char *argv[], param *p );
+extern void process_convcache( int *argc, char *argv[], param *p );
+extern void process_memstats( int *argc, char *argv[], param *p );
 
 #endif
@@ -30,6 +30,12 @@ args_tomods_help( char *progname, char *help1, char *help2 )
 	fprintf(stderr,"  -v, --version             display version\n");
 	fprintf(stderr,"  -a, --add-refcount        add \"_#\", where # is reference count to reference\n");
 	fprintf(stderr,"  -s, --single-refperfile   one reference per output file\n");
+	fprintf(stderr,"  --sort KEY                sort by refnum, year, or author\n");
+	fprintf(stderr,"  --dedup                   drop duplicate references (doi, isbn, title)\n");
+	fprintf(stderr,"  --dedup-merge             as --dedup, filling in missing fields\n");
+	fprintf(stderr,"  --intern                  share identical field values between references\n");
+	fprintf(stderr,"  --convert-cache N         keep N character conversions for reuse\n");
+	fprintf(stderr,"  --memstats                report memory use when done\n");
 	fprintf(stderr,"  -i, --input-encoding      input character encoding\n");
 	fprintf(stderr,"  -o, --output-encoding     output character encoding\n");
 	fprintf(stderr,"  -u, --unicode-characters  DEFAULT: write unicode (not xml entities)\n");
@@ -63,6 +69,11 @@ tomods_processargs( int *argc, char *argv[], param *p,
 {
 	int i, j, subtract, status;
 	process_charsets( argc, argv, p );
+	process_sort( argc, argv, p );
+	process_dedup( argc, argv, p );
+	process_intern( argc, argv, p );
+	process_convcache( argc, argv, p );
+	process_memstats( argc, argv, p );
 	i = 0;
 	while ( i<*argc ) {
 		subtract = 0;
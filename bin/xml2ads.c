@@ -27,6 +27,12 @@ help( char *progname )
 	fprintf(stderr,"  -v, --version            display version\n");
 	fprintf(stderr,"  -nb, --no-bom            do not write Byte Order Mark in UTF8 output\n");
 	fprintf(stderr,"  -s, --single-refperfile  one reference per output file\n");
+	fprintf(stderr,"  --sort KEY               sort by refnum, year, or author\n");
+	fprintf(stderr,"  --dedup                  drop duplicate references (doi, isbn, title)\n");
+	fprintf(stderr,"  --dedup-merge            as --dedup, filling in missing fields\n");
+	fprintf(stderr,"  --intern                 share identical field values between references\n");
+	fprintf(stderr,"  --convert-cache N        keep N character conversions for reuse\n");
+	fprintf(stderr,"  --memstats               report memory use when done\n");
 	fprintf(stderr,"  --verbose                for verbose output\n");
 	fprintf(stderr,"  --debug                  for debug output\n");
 
@@ -77,6 +83,11 @@ main( int argc, char *argv[] )
 	modsin_initparams( &p, progname );
 	adsout_initparams( &p, progname );
 	process_charsets( &argc, argv, &p );
+	process_sort( &argc, argv, &p );
+	process_dedup( &argc, argv, &p );
+	process_intern( &argc, argv, &p );
+	process_convcache( &argc, argv, &p );
+	process_memstats( &argc, argv, &p );
 	process_args( &argc, argv, &p );
 	bibprog( argc, argv, &p );
 	bibl_freeparams( &p );
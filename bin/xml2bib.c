@@ -42,6 +42,12 @@ help( char *progname )
 	fprintf(stderr,"  -nb, --no-bom             do not write Byte Order Mark in UTF8 output\n");
 	fprintf(stderr,"  -U,  --uppercase          write bibtex tags/types in upper case\n" );
 	fprintf(stderr,"  -s,  --single-refperfile  one reference per output file\n");
+	fprintf(stderr,"  --sort KEY                sort by refnum, year, or author\n");
+	fprintf(stderr,"  --dedup                   drop duplicate references (doi, isbn, title)\n");
+	fprintf(stderr,"  --dedup-merge             as --dedup, filling in missing fields\n");
+	fprintf(stderr,"  --intern                  share identical field values between references\n");
+	fprintf(stderr,"  --convert-cache N         keep N character conversions for reuse\n");
+	fprintf(stderr,"  --memstats                report memory use when done\n");
 	fprintf(stderr,"  -i, --input-encoding      interpret input file with requested character set\n" );
 	fprintf(stderr,"                            (use argument for current list)\n");
 	fprintf(stderr,"  -o, --output-encoding     write output file with requested character set\n" );
@@ -135,6 +141,11 @@ main( int argc, char *argv[] )
 	modsin_initparams( &p, progname );
 	bibtexout_initparams( &p, progname );
 	process_charsets( &argc, argv, &p );
+	process_sort( &argc, argv, &p );
+	process_dedup( &argc, argv, &p );
+	process_intern( &argc, argv, &p );
+	process_convcache( &argc, argv, &p );
+	process_memstats( &argc, argv, &p );
 	process_args( &argc, argv, &p );
 	Da1 fprintf( stderr, "GQMJr::main charsetin=%d, charsetout=%d, utf8in=%d, utf8out=%d, \n", 	p.charsetin, p.charsetout, p.utf8in, p.utf8out);
 
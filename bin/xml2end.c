@@ -28,6 +28,12 @@ help( char *progname )
 	fprintf(stderr,"  -v, --version  display version\n\n");
 	fprintf(stderr,"  -nb, --no-bom   do not write Byte Order Mark in UTF8 output\n");
 	fprintf(stderr,"  -s, --single-refperfile one reference per output file\n");
+	fprintf(stderr,"  --sort KEY     sort by refnum, year, or author\n");
+	fprintf(stderr,"  --dedup        drop duplicate references (doi, isbn, title)\n");
+	fprintf(stderr,"  --dedup-merge  as --dedup, filling in missing fields\n");
+	fprintf(stderr,"  --intern       share identical field values between references\n");
+	fprintf(stderr,"  --convert-cache N keep N character conversions for reuse\n");
+	fprintf(stderr,"  --memstats     report memory use when done\n");
 	fprintf(stderr,"  -i, --input-encoding interpret input file with requested character set (use\n" );
 	fprintf(stderr,"                       argument for current list)\n");
 	fprintf(stderr,"  -o, --output-encoding interprest output file with requested character set\n" );
@@ -81,6 +87,11 @@ main( int argc, char *argv[] )
 	modsin_initparams( &p, progname );
 	endout_initparams( &p, progname );
 	process_charsets( &argc, argv, &p );
+	process_sort( &argc, argv, &p );
+	process_dedup( &argc, argv, &p );
+	process_intern( &argc, argv, &p );
+	process_convcache( &argc, argv, &p );
+	process_memstats( &argc, argv, &p );
 	process_args( &argc, argv, &p );
 	bibprog( argc, argv, &p );
 	bibl_freeparams( &p );
@@ -39,6 +39,8 @@ adsout_initparams( param *p, const char *progname )
 	p->verbose          = 0;
 	p->addcount         = 0;
 	p->singlerefperfile = 0;
+	p->sortkey          = BIBL_SORT_NONE;
+	p->dedup            = BIBL_DEDUP_NONE;
 
 	if ( p->charsetout == BIBL_CHARSET_UNICODE ) {
 		p->utf8out = p->utf8bom = 1;
@@ -103,14 +105,15 @@ get_type( fields *in )
 	};
 	int nmatch_genres = sizeof( match_genres ) / sizeof( match_genres[0] );
 
-	char *tag, *data;
+	const char *tag;
+	char *data;
 	int i, j, type = TYPE_UNKNOWN;
 
 	for ( i=0; i<in->n; ++i ) {
-		tag = in->tag[i].data;
+		tag = fields_tag( in, i, FIELDS_CHRP_NOUSE );
 		if ( strcasecmp( tag, "GENRE" )!=0 &&
 		     strcasecmp( tag, "NGENRE" )!=0 ) continue;
-		data = in->data[i].data;
+		data = (char *) fields_value( in, i, FIELDS_CHRP_NOUSE );
 		for ( j=0; j<nmatch_genres; ++j ) {
 			if ( !strcasecmp( data, match_genres[j].name ) ) {
 				type = match_genres[j].type;
@@ -123,11 +126,11 @@ get_type( fields *in )
 			else if ( !strcasecmp( data, "thesis" ) )
 				type = TYPE_THESIS;
 			else if ( !strcasecmp( data, "book" ) ) {
-				if ( in->level[i]==0 ) type = TYPE_BOOK;
+				if ( fields_level( in, i )==0 ) type = TYPE_BOOK;
 				else type = TYPE_INBOOK;
 			}
 			else if ( !strcasecmp( data, "collection" ) ) {
-				if ( in->level[i]==0 ) type = TYPE_BOOK;
+				if ( fields_level( in, i )==0 ) type = TYPE_BOOK;
 				else type = TYPE_INBOOK;
 			}
 			if ( type!=TYPE_UNKNOWN ) fields_setused( in, i );
@@ -135,9 +138,9 @@ get_type( fields *in )
 	}
 	if ( type==TYPE_UNKNOWN ) {
 		for ( i=0; i<in->n; ++i ) {
-			if ( strcasecmp( in->tag[i].data, "RESOURCE" ) )
+			if ( !fields_match_casetag( in, i, "RESOURCE" ) )
 				continue;
-			data = in->data[i].data;
+			data = (char *) fields_value( in, i, FIELDS_CHRP_NOUSE );
 			if ( !strcasecmp( data, "moving image" ) )
 				type = TYPE_BROADCAST;
 			else if ( !strcasecmp( data, "software, multimedia" ) )
@@ -233,26 +236,24 @@ static void
 append_people( fields *in, char *tag1, char *tag2, char *tag3, char *adstag, int level, fields *out, int *status )
 {
 	str oneperson, allpeople;
-	vplist_index i;
-	int fstatus;
-	vplist a;
+	int i, fstatus;
+	fields_iter it;
+	char *person;
 
 	str_init( &oneperson );
 	str_init( &allpeople );
-	vplist_init( &a );
-
-	fields_findv_eachof( in, level, FIELDS_CHRP, &a, tag1, tag2, tag3, NULL );
-	if ( a.n ) {
-		for ( i=0; i<a.n; ++i ) {
-			if ( i!=0 ) str_strcatc( &allpeople, "; " );
-			name_build_withcomma( &oneperson, (char *) vplist_get( &a, i) );
-			str_strcat( &allpeople, &oneperson );
-		}
+
+	fields_iter_init( &it, in, level, FIELDS_CHRP, tag1, tag2, tag3, NULL );
+	for ( i=0; ( person = fields_iter_next( &it ) ); ++i ) {
+		if ( i!=0 ) str_strcatc( &allpeople, "; " );
+		name_build_withcomma( &oneperson, person );
+		str_strcat( &allpeople, &oneperson );
+	}
+	if ( i ) {
 		fstatus = fields_add( out, adstag, str_cstr( &allpeople ), LEVEL_MAIN );
 		if ( fstatus!=FIELDS_OK ) *status = BIBL_ERR_MEMERR;
 	}
 
-	vplist_free( &a );
 	str_free( &oneperson );
 	str_free( &allpeople );
 }
@@ -434,23 +435,19 @@ append_Rtag( fields *in, char *adstag, int type, fields *out, int *status )
 static void
 append_easyall( fields *in, char *tag, char *adstag, int level, fields *out, int *status )
 {
-	vplist_index i;
+	fields_iter it;
+	char *value;
 	int fstatus;
-	vplist a;
-
-	vplist_init( &a );
 
-	fields_findv_each( in, level, FIELDS_CHRP, &a, tag );
+	fields_iter_init( &it, in, level, FIELDS_CHRP, tag, NULL );
 
-	for ( i=0; i<a.n; ++i ) {
-		fstatus = fields_add( out, adstag, (char*) vplist_get( &a, i ), LEVEL_MAIN );
+	while ( ( value = fields_iter_next( &it ) ) ) {
+		fstatus = fields_add( out, adstag, value, LEVEL_MAIN );
 		if ( fstatus!=FIELDS_OK ) {
 			*status = BIBL_ERR_MEMERR;
-			goto out;
+			return;
 		}
 	}
-out:
-	vplist_free( &a );
 }
 
 static void
@@ -469,27 +466,25 @@ append_easy( fields *in, char *tag, char *adstag, int level, fields *out, int *s
 static void
 append_keys( fields *in, char *tag, char *adstag, int level, fields *out, int *status )
 {
-	vplist_index i;
+	int i, fstatus;
+	fields_iter it;
 	str allkeys;
-	int fstatus;
-	vplist a;
+	char *key;
 
 	str_init( &allkeys );
-	vplist_init( &a );
 
-	fields_findv_each( in, level, FIELDS_CHRP, &a, tag );
+	fields_iter_init( &it, in, level, FIELDS_CHRP, tag, NULL );
 
-	if ( a.n ) {
-		for ( i=0; i<a.n; ++i ) {
-			if ( i>0 ) str_strcatc( &allkeys, ", " );
-			str_strcatc( &allkeys, (char *) vplist_get( &a, i ) );
-		}
+	for ( i=0; ( key = fields_iter_next( &it ) ); ++i ) {
+		if ( i>0 ) str_strcatc( &allkeys, ", " );
+		str_strcatc( &allkeys, key );
+	}
+	if ( i ) {
 		fstatus = fields_add( out, adstag, str_cstr( &allkeys ), LEVEL_MAIN );
 		if ( fstatus!=FIELDS_OK ) *status = BIBL_ERR_MEMERR;
 	}
 
 	str_free( &allkeys );
-	vplist_free( &a );
 }
 
 static void
@@ -530,7 +525,8 @@ append_trailer( fields *out, int *status )
 static void
 output( FILE *fp, fields *out )
 {
-	char *tag, *value;
+	const char *tag;
+	char *value;
 	int i;
 
 	for ( i=0; i<out->n; ++i ) {
@@ -575,15 +571,20 @@ append_data( fields *in, fields *out )
 static int
 adsout_write( fields *in, FILE *fp, param *p, unsigned long refnum )
 {
+	fields local, *out = p->scratch;
 	int status;
-	fields out;
 
-	fields_init( &out );
+	/* fields to reuse for each reference, from bibl_write() */
+	if ( out ) fields_reset( out );
+	else {
+		fields_init( &local );
+		out = &local;
+	}
 
-	status = append_data( in, &out );
-	if ( status==BIBL_OK ) output( fp, &out );
+	status = append_data( in, out );
+	if ( status==BIBL_OK ) output( fp, out );
 
-	fields_free( &out );
+	if ( out==&local ) fields_free( &local );
 
 	return status;
 }
@@ -8,13 +8,16 @@
  */
 #include <stdio.h>
 #include <stdlib.h>
+#include <ctype.h>
 #include "bibutils.h"
 
 /* internal includes */
 #include "reftypes.h"
 #include "charsets.h"
 #include "str_conv.h"
+#include "utf8.h"
 #include "is_ws.h"
+#include "dedup.h"
 
 /* illegal modes to pass in, but use internally for consistency */
 #define BIBL_INTERNALIN   (BIBL_LASTIN+1)
@@ -131,6 +134,12 @@ bibl_duplicateparams( param *np, param *op )
 	np->addcount = op->addcount;
 	np->output_raw = op->output_raw;
 	np->singlerefperfile = op->singlerefperfile;
+	np->sortkey = op->sortkey;
+	np->dedup = op->dedup;
+	np->intern = op->intern;
+	np->convcache = op->convcache;
+	np->borrow = op->borrow;
+	np->scratch = NULL;
 
 	np->readf = op->readf;
 	np->processf = op->processf;
@@ -347,19 +356,11 @@ static int
 extract_tag_value( str *tag, str *value, char *p )
 {
 	str_empty( tag );
-	while ( p && *p && *p!='|' ) {
-		str_addchar( tag, *p );
-		p++;
-	}
+	p = str_cattodelim( tag, p, "|", 1 );
 	if ( str_memerr( tag ) ) return BIBL_ERR_MEMERR;
 
-	if ( p && *p=='|' ) p++;
-
 	str_empty( value );
-	while ( p && *p ) {
-		str_addchar( value, *p );
-		p++;
-	}
+	if ( p ) str_strcatc( value, p );
 	if ( str_memerr( tag ) ) return BIBL_ERR_MEMERR;
 
 	return BIBL_OK;
@@ -455,32 +456,36 @@ out:
 static int
 read_ref( FILE *fp, bibl *bin, char *filename, param *p )
 {
-	int nrefs = 0, bufpos = 0, ok, ret=BIBL_OK, fcharset;/* = CHARSET_UNKNOWN;*/
+	int nrefs = 0, ok, ret=BIBL_OK, fcharset;/* = CHARSET_UNKNOWN;*/
 	str reference, line;
-	char buf[256]="";
-	fields *ref;
+	fields *ref = NULL;
+	char *data;
+	reader r;
+	reader_init( &r, fp );
 	str_init( &reference );
 	str_init( &line );
-	while ( p->readf( fp, buf, sizeof(buf), &bufpos, &line, &reference, &fcharset ) ) {
+	while ( p->readf( &r, &line, &reference, &fcharset ) ) {
 		if ( reference.len==0 ) continue;
-		ref = fields_new();
+		/* a reference that wasn't kept leaves its fields for the next */
+		if ( ref ) fields_reset( ref );
+		else ref = fields_new();
 		if ( !ref ) {
 			ret = BIBL_ERR_MEMERR;
 			bibl_free( bin );
 			goto out;
 		}
-		if ( p->processf( ref, reference.data, filename, nrefs+1, p )){
+		/* readers that borrow values from the record need the fields
+		 * to keep it, the others leave it to be reused */
+		if ( p->borrow ) data = fields_record( ref, &reference );
+		else data = str_cstr( &reference );
+		if ( p->processf( ref, data, filename, nrefs+1, p )){
 			ok = bibl_addref( bin, ref );
 			if ( !ok ) {
 				ret = BIBL_ERR_MEMERR;
 				bibl_free( bin );
-				fields_free( ref );
-				free( ref );
 				goto out;
 			}
-		} else {
-			fields_free( ref );
-			free( ref );
+			ref = NULL;
 		}
 		str_empty( &reference );
 		if ( fcharset!=CHARSET_UNKNOWN ) {
@@ -495,14 +500,19 @@ read_ref( FILE *fp, bibl *bin, char *filename, param *p )
 	}
 	if ( p->charsetin==CHARSET_UNICODE ) p->utf8in = 1;
 out:
+	if ( ref ) {
+		fields_free( ref );
+		free( ref );
+	}
 	str_free( &line );
 	str_free( &reference );
+	reader_free( &r );
 	return ret;
 }
 
 /* Don't manipulate latex for URL's and the like */
 static int
-bibl_notexify( char *tag )
+bibl_notexify( const char *tag )
 {
 	char *protected[] = { "DOI", "URL", "REFNUM", "FILEATTACH" };
 	int i, nprotected = sizeof( protected ) / sizeof( protected[0] );
@@ -512,54 +522,144 @@ bibl_notexify( char *tag )
 }
 
 /* bibl_fixcharsetdata()
+ *
+ * Convert the values of ref with tex, or with notex for the tags that
+ * bibl_notexify() protects from LaTeX.
  *
  * returns BIBL_OK or BIBL_ERR_MEMERR
  */
 static int
-bibl_fixcharsetdata( fields *ref, param *p )
+bibl_fixcharsetdata( fields *ref, str_conv *tex, str_conv *notex )
 {
-	str *data;
-	char *tag;
+	int ok, status = BIBL_OK;
+	str *data, copy;
+	const char *tag;
 	long i, n;
-	int ok;
 
 	n = fields_num( ref );
 
+	str_init( &copy );
+
 	for ( i=0; i<n; ++i ) {
 
 		tag  = fields_tag( ref, i, FIELDS_CHRP_NOUSE );
-		data = fields_value( ref, i, FIELDS_STRP_NOUSE );
 
-		if ( bibl_notexify( tag ) ) {
-			ok = str_convert( data,
-				p->charsetin,  0, p->utf8in,  p->xmlin,
-				p->charsetout, 0, p->utf8out, p->xmlout );
-		} else {
-			ok = str_convert( data,
-				p->charsetin,  p->latexin,  p->utf8in,  p->xmlin,
-				p->charsetout, p->latexout, p->utf8out, p->xmlout );
+		/* convert a copy of pooled or borrowed values, so that they
+		 * are only copied into the entry if the conversion changes them */
+		if ( fields_shared( ref, i ) ) {
+			str_strcpyc( &copy, fields_value( ref, i, FIELDS_CHRP_NOUSE ) );
+			data = &copy;
+		} else
+			data = fields_value( ref, i, FIELDS_STRP_NOUSE );
+
+		if ( bibl_notexify( tag ) ) ok = str_conv_convert( notex, data );
+		else ok = str_conv_convert( tex, data );
+
+		if ( ok && data==&copy && !str_memerr( &copy ) &&
+		     strcmp( copy.data, fields_value( ref, i, FIELDS_CHRP_NOUSE ) ) ) {
+			data = fields_value( ref, i, FIELDS_STRP_NOUSE );
+			str_strcpy( data, &copy );
 		}
 
-		if ( !ok ) return BIBL_ERR_MEMERR;
+		if ( !ok || str_memerr( data ) ) {
+			status = BIBL_ERR_MEMERR;
+			goto out;
+		}
 	}
 
-	return BIBL_OK;
+out:
+	str_free( &copy );
+
+	return status;
 }
 
 /* bibl_fixcharsets()
+ *
+ * With p->convcache set, values that come up again are copied from a
+ * cache of that many recent conversions; its hits and misses are
+ * reported when verbose.
  *
  * returns BIBL_OK or BIBL_ERR_MEMERR
  */
 static int
 bibl_fixcharsets( bibl *b, param *p )
 {
+	str_conv tex, notex;
 	int status = BIBL_OK;
 	long i;
+
+	str_conv_init( &tex,
+		p->charsetin,  p->latexin,  p->utf8in,  p->xmlin,
+		p->charsetout, p->latexout, p->utf8out, p->xmlout );
+	str_conv_init( &notex,
+		p->charsetin,  0, p->utf8in,  p->xmlin,
+		p->charsetout, 0, p->utf8out, p->xmlout );
+
+	if ( p->convcache > 0 ) {
+		if ( !str_conv_cache( &tex, p->convcache ) ||
+		     !str_conv_cache( &notex, p->convcache ) ) {
+			status = BIBL_ERR_MEMERR;
+			goto out;
+		}
+	}
+
 	for ( i=0; i<b->nrefs && status==BIBL_OK; ++i )
-		status = bibl_fixcharsetdata( b->ref[i], p );
+		status = bibl_fixcharsetdata( b->ref[i], &tex, &notex );
+
+	if ( p->convcache > 0 && verbose_set( p ) ) {
+		if ( p->progname ) fprintf( stderr, "%s: ", p->progname );
+		fprintf( stderr, "conversion cache of %ld: %lu hits, %lu misses\n",
+			p->convcache, tex.nhit + notex.nhit, tex.nmiss + notex.nmiss );
+	}
+
+out:
+	str_conv_free( &tex );
+	str_conv_free( &notex );
 	return status;
 }
 
+/* bibl_checkutf8()
+ *
+ * Warn about values that should be UTF-8 but aren't, with the offset of
+ * the first bad byte; they are converted with '?' for the bad bytes.
+ */
+static void
+bibl_checkutf8( bibl *b, param *p, char *filename )
+{
+	long i, j, n, off;
+	char *value;
+
+	for ( i=0; i<b->nrefs; ++i ) {
+		n = fields_num( b->ref[i] );
+		for ( j=0; j<n; ++j ) {
+			value = fields_value( b->ref[i], j, FIELDS_CHRP_NOUSE );
+			off = utf8_validate( value, strlen( value ) );
+			if ( off==-1 ) continue;
+			if ( p->progname ) fprintf( stderr, "%s: ", p->progname );
+			fprintf( stderr, "Warning: Invalid UTF-8 at byte %ld of tag '%s' in reference %ld",
+				off, (char *) fields_tag( b->ref[i], j, FIELDS_CHRP_NOUSE ), i+1 );
+			if ( filename ) fprintf( stderr, " of %s", filename );
+			fprintf( stderr, "\n" );
+		}
+	}
+}
+
+/* bibl_intern()
+ *
+ * Share the values of the references added to b from reference start
+ * on through the fields value pool, see fields_intern().
+ *
+ * returns BIBL_OK or BIBL_ERR_MEMERR
+ */
+static int
+bibl_intern( bibl *b, long start )
+{
+	long i;
+	for ( i=start; i<b->nrefs; ++i )
+		if ( fields_intern( b->ref[i] )!=FIELDS_OK ) return BIBL_ERR_MEMERR;
+	return BIBL_OK;
+}
+
 static int
 build_refnum( fields *f, long nrefs, int *n )
 {
@@ -613,6 +713,7 @@ bibl_checkrefid( bibl *b, param *p )
 	char buf[512];
 	int n, status;
 	fields *ref;
+	str *refnum;
 	long i;
 
 	for ( i=0; i<b->nrefs; ++i ) {
@@ -624,8 +725,9 @@ bibl_checkrefid( bibl *b, param *p )
 		}
 		if ( p->addcount ) {
 			sprintf( buf, "_%ld", i+1 );
-			str_strcatc( &(ref->data[n]), buf );
-			if ( str_memerr( &(ref->data[n]) ) )
+			refnum = fields_value( ref, n, FIELDS_STRP_NOUSE );
+			str_strcatc( refnum, buf );
+			if ( str_memerr( refnum ) )
 				return BIBL_ERR_MEMERR;
 		}
 	}
@@ -649,12 +751,12 @@ generate_citekey( fields *f, int nref )
 	if ( n2==-1 ) n2 = fields_find( f, "PARTDATE:YEAR", 0 );
 	if ( n2==-1 ) n2 = fields_find( f, "PARTDATE:YEAR", -1 );
 	if ( n1!=-1 && n2!=-1 ) {
-		p = f->data[n1].data;
+		p = (char *) fields_value( f, n1, FIELDS_CHRP_NOUSE );
 		while ( p && *p && *p!='|' ) {
 			if ( !is_ws( *p ) ) str_addchar( &citekey, *p ); 
 			p++;
 		}
-		p = f->data[n2].data;
+		p = (char *) fields_value( f, n2, FIELDS_CHRP_NOUSE );
 		while ( p && *p ) {
 			if ( !is_ws( *p ) ) str_addchar( &citekey, *p );
 			p++;
@@ -683,7 +785,7 @@ resolve_citekeys( bibl *b, slist *citekeys, int *dup )
 {
 	const char abc[]="abcdefghijklmnopqrstuvwxyz";
 	int nsame, ntmp, n, i, j, status = BIBL_OK;
-	str tmp;
+	str tmp, *refnum;
 
 	str_init( &tmp );
 
@@ -712,8 +814,9 @@ resolve_citekeys( bibl *b, slist *citekeys, int *dup )
 			dup[j] = -1;
 			n = fields_find( b->ref[j], "REFNUM", -1 );
 			if ( n!=-1 ) {
-				str_strcpy(&((b->ref[j])->data[n]),&tmp);
-				if ( str_memerr( &((b->ref[j])->data[n]) ) ) {
+				refnum = fields_value( b->ref[j], n, FIELDS_STRP_NOUSE );
+				str_strcpy( refnum, &tmp );
+				if ( str_memerr( refnum ) ) {
 					status = BIBL_ERR_MEMERR;
 					goto out;
 				}
@@ -735,8 +838,8 @@ get_citekeys( bibl *b, slist *citekeys )
 		f = b->ref[i];
 		n = fields_find( f, "REFNUM", -1 );
 		if ( n==-1 ) n = generate_citekey( f, i );
-		if ( n!=-1 && f->data[n].data ) {
-			s = slist_add( citekeys, &(f->data[n]) );
+		if ( n!=-1 && !fields_nodata( f, n ) ) {
+			s = slist_add( citekeys, fields_value( f, n, FIELDS_STRP_NOUSE ) );
 			if ( !s ) return BIBL_ERR_MEMERR;
 		} else {
 			s = slist_addc( citekeys, "" );
@@ -831,6 +934,7 @@ int
 bibl_read( bibl *b, FILE *fp, char *filename, param *p )
 {
 	int ok, status;
+	long nrefs;
 	param lp;
 	bibl bin;
 
@@ -844,6 +948,7 @@ bibl_read( bibl *b, FILE *fp, char *filename, param *p )
 	if ( status!=BIBL_OK ) return status;
 
 	bibl_init( &bin );
+	nrefs = b->nrefs;
 
 	status = read_ref( fp, &bin, filename, &lp );
 	if ( status!=BIBL_OK ) {
@@ -861,6 +966,8 @@ bibl_read( bibl *b, FILE *fp, char *filename, param *p )
 	}
 
 	if ( !lp.output_raw || ( lp.output_raw & BIBL_RAW_WITHCHARCONVERT ) ) {
+		if ( lp.utf8in && lp.charsetin==CHARSET_UNICODE )
+			bibl_checkutf8( &bin, &lp, filename );
 		status = bibl_fixcharsets( &bin, &lp );
 		if ( status!=BIBL_OK ) return status;
 		if ( debug_set( p ) ) {
@@ -903,6 +1010,15 @@ bibl_read( bibl *b, FILE *fp, char *filename, param *p )
 	if ( !lp.output_raw || ( lp.output_raw & BIBL_RAW_WITHMAKEREFID ) )
 		bibl_checkrefid( b, &lp );
 
+	if ( lp.intern ) {
+		status = bibl_intern( b, nrefs );
+		if ( status!=BIBL_OK ) {
+			bibl_free( &bin );
+			bibl_freeparams( &lp );
+			return status;
+		}
+	}
+
 	bibl_free( &bin );
 
 	bibl_freeparams( &lp );
@@ -910,6 +1026,122 @@ bibl_read( bibl *b, FILE *fp, char *filename, param *p )
 	return BIBL_OK;
 }
 
+typedef struct {
+	char   *key;
+	long    year;
+	long    pos;
+	int     nocase;
+	fields *ref;
+} sortref;
+
+static char *
+sortref_key( fields *f, int sortkey )
+{
+	char *key = NULL;
+
+	switch ( sortkey ) {
+	case BIBL_SORT_REFNUM:
+		key = fields_findv( f, LEVEL_ANY, FIELDS_CHRP_NOUSE, "REFNUM" );
+		break;
+	case BIBL_SORT_YEAR:
+		key = fields_findv( f, LEVEL_MAIN, FIELDS_CHRP_NOUSE, "DATE:YEAR" );
+		if ( !key )
+			key = fields_findv_firstof( f, LEVEL_ANY, FIELDS_CHRP_NOUSE,
+				"DATE:YEAR", "PARTDATE:YEAR", NULL );
+		break;
+	case BIBL_SORT_AUTHOR:
+		key = fields_findv( f, LEVEL_MAIN, FIELDS_CHRP_NOUSE, "AUTHOR" );
+		if ( !key )
+			key = fields_findv_firstof( f, LEVEL_ANY, FIELDS_CHRP_NOUSE,
+				"AUTHOR", "AUTHOR:CORP", "AUTHOR:ASIS", NULL );
+		break;
+	}
+
+	return key;
+}
+
+/* names are stored as "Family|Given|Given", so treat '|' as lower than
+ * any printable character to keep "Smith|J" ahead of "Smithson|A"
+ */
+static int
+sortref_strcmp( const char *a, const char *b, int nocase )
+{
+	unsigned char ca, cb;
+
+	while ( 1 ) {
+		ca = ( *a=='|' ) ? 1 : (unsigned char) *a;
+		cb = ( *b=='|' ) ? 1 : (unsigned char) *b;
+		if ( nocase ) {
+			ca = tolower( ca );
+			cb = tolower( cb );
+		}
+		if ( ca!=cb || ca=='\0' ) return (int) ca - (int) cb;
+		a++;
+		b++;
+	}
+}
+
+static int
+sortref_cmp( const void *v1, const void *v2 )
+{
+	const sortref *a = ( const sortref * ) v1;
+	const sortref *b = ( const sortref * ) v2;
+	int cmp;
+
+	if ( a->key && !b->key ) return -1;
+	if ( !a->key && b->key ) return 1;
+	if ( a->key && b->key ) {
+		if ( a->year < b->year ) return -1;
+		if ( a->year > b->year ) return 1;
+		cmp = sortref_strcmp( a->key, b->key, a->nocase );
+		if ( cmp ) return cmp;
+	}
+
+	if ( a->pos < b->pos ) return -1;
+	if ( a->pos > b->pos ) return 1;
+	return 0;
+}
+
+/* bibl_sort()
+ *
+ * Order references by citation key, year, or first author before
+ * output.  The key is looked up once per reference and the (key,
+ * position) pairs are sorted, so references with identical keys
+ * keep their input order and references without a key go last.
+ *
+ * returns BIBL_OK or BIBL_ERR_MEMERR
+ */
+static int
+bibl_sort( bibl *b, int sortkey )
+{
+	sortref *refs;
+	long i;
+
+	if ( sortkey==BIBL_SORT_NONE || b->nrefs < 2 ) return BIBL_OK;
+
+	refs = ( sortref * ) malloc( sizeof( sortref ) * b->nrefs );
+	if ( !refs ) return BIBL_ERR_MEMERR;
+
+	for ( i=0; i<b->nrefs; ++i ) {
+		refs[i].ref    = b->ref[i];
+		refs[i].pos    = i;
+		refs[i].key    = sortref_key( b->ref[i], sortkey );
+		refs[i].year   = 0;
+		refs[i].nocase = ( sortkey==BIBL_SORT_AUTHOR );
+		if ( refs[i].key && sortkey==BIBL_SORT_YEAR )
+			refs[i].year = atol( refs[i].key );
+	}
+
+	qsort( refs, b->nrefs, sizeof( sortref ), sortref_cmp );
+
+	for ( i=0; i<b->nrefs; ++i )
+		b->ref[i] = refs[i].ref;
+
+	free( refs );
+
+	return BIBL_OK;
+}
+
 static FILE *
 singlerefname( fields *reffields, long nref, int mode )
 {
@@ -928,7 +1160,7 @@ singlerefname( fields *reffields, long nref, int mode )
 	found = fields_find( reffields, "REFNUM", 0 );
 	/* find new filename based on reference */
 	if ( found!=-1 ) {
-		sprintf( outfile,"%s.%s",reffields->data[found].data, suffix );
+		sprintf( outfile,"%s.%s",(char *) fields_value( reffields, found, FIELDS_CHRP_NOUSE ), suffix );
 	} else  sprintf( outfile,"%ld.%s",nref, suffix );
 	count = 0;
 	fp = fopen( outfile, "r" );
@@ -938,7 +1170,7 @@ singlerefname( fields *reffields, long nref, int mode )
 		if ( count==60000 ) return NULL;
 		if ( found!=-1 )
 			sprintf( outfile, "%s_%ld.%s", 
-				reffields->data[found].data, count, suffix  );
+				(char *) fields_value( reffields, found, FIELDS_CHRP_NOUSE ), count, suffix  );
 		else sprintf( outfile,"%ld_%ld.%s",nref, count, suffix );
 		fp = fopen( outfile, "r" );
 	}
@@ -979,6 +1211,7 @@ bibl_writefp( FILE *fp, bibl *b, param *p )
 int
 bibl_write( bibl *b, FILE *fp, param *p )
 {
+	fields scratch;
 	int status;
 	param lp;
 
@@ -990,8 +1223,14 @@ bibl_write( bibl *b, FILE *fp, param *p )
 	status = bibl_setwriteparams( &lp, p );
 	if ( status!=BIBL_OK ) return status;
 
+	status = bibl_dedup( b, lp.dedup, stderr, lp.progname );
+	if ( status!=BIBL_OK ) goto out;
+
+	status = bibl_sort( b, lp.sortkey );
+	if ( status!=BIBL_OK ) goto out;
+
 	status = bibl_fixcharsets( b, &lp );
-	if ( status!=BIBL_OK ) return status;
+	if ( status!=BIBL_OK ) goto out;
 
 	if ( debug_set( p ) ) {
 		report_params( stderr, "bibl_write", &lp );
@@ -1002,9 +1241,15 @@ bibl_write( bibl *b, FILE *fp, param *p )
 		fflush( stderr );
 	}
 
+	/* one set of output fields for the writer to reuse */
+	fields_init( &scratch );
+	lp.scratch = &scratch;
+
 	if ( p->singlerefperfile ) status = bibl_writeeachfp( fp, b, &lp );
 	else status = bibl_writefp( fp, b, &lp );
 
+	fields_free( &scratch );
+out:
 	bibl_freeparams( &lp );
 
 	return status;
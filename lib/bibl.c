@@ -81,7 +81,8 @@ bibl_copy( bibl *bout, bibl *bin )
 {
 	fields *refin, *refout;
 	int i, j, n, status, ok, level;
-	char *tag, *value;
+	const char *tag;
+	char *value;
 	for ( i=0; i<bin->nrefs; ++i ) {
 		refin = bin->ref[i];
 		refout = fields_new();
@@ -36,7 +36,7 @@ static slist replace = { 0, 0, 0, NULL };
 static int  biblatexin_convertf( fields *bibin, fields *info, int reftype, param *p );
 static int  biblatexin_processf( fields *bibin, char *data, char *filename, long nref, param *p );
 static int  biblatexin_cleanf( bibl *bin, param *p );
-static int  biblatexin_readf( FILE *fp, char *buf, int bufsize, int *bufpos, str *line, str *reference, int *fcharset );
+static int  biblatexin_readf( reader *r, str *line, str *reference, int *fcharset );
 static int  biblatexin_typef( fields *bibin, char *filename, int nrefs, param *p );
 
 void
@@ -50,6 +50,9 @@ biblatexin_initparams( param *p, const char *progname )
 	p->utf8in           = 0;
 	p->nosplittitle     = 0;
 	p->verbose          = 0;
+	p->intern           = 0;
+	p->convcache        = 0;
+	p->borrow           = 0;
 	p->addcount         = 0;
 	p->output_raw       = 0;
 
@@ -81,10 +84,10 @@ biblatexin_initparams( param *p, const char *progname )
  *
  */
 static int
-readmore( FILE *fp, char *buf, int bufsize, int *bufpos, str *line )
+readmore( reader *r, str *line )
 {
 	if ( line->len ) return 1;
-	else return str_fget( fp, buf, bufsize, bufpos, line );
+	else return reader_getline( r, line );
 }
 
 /*
@@ -94,11 +97,11 @@ readmore( FILE *fp, char *buf, int bufsize, int *bufpos, str *line )
  * returns 1 if last reference in file, 2 if reference within file
  */
 static int
-biblatexin_readf( FILE *fp, char *buf, int bufsize, int *bufpos, str *line, str *reference, int *fcharset )
+biblatexin_readf( reader *r, str *line, str *reference, int *fcharset )
 {
 	int haveref = 0;
 	char *p;
-	while ( haveref!=2 && readmore( fp, buf, bufsize, bufpos, line ) ) {
+	while ( haveref!=2 && readmore( r, line ) ) {
 		if ( line->len == 0 ) continue; /* blank line */
 		p = &(line->data[0]);
 		p = skip_ws( p );
@@ -617,7 +620,7 @@ out:
 }
 
 static int
-is_name_tag( str *tag )
+is_name_tag( const str *tag )
 {
 	if ( str_has_value( tag ) ) {
 		if ( !strcasecmp( str_cstr( tag ), "author" ) ) return 1;
@@ -640,7 +643,7 @@ is_name_tag( str *tag )
 }
 
 static int
-is_url_tag( str *tag )
+is_url_tag( const str *tag )
 {
 	if ( str_has_value( tag ) ) {
 		if ( !strcasecmp( str_cstr( tag ), "url" ) ) return 1;
@@ -649,7 +652,7 @@ is_url_tag( str *tag )
 }
 
 static int
-biblatexin_cleandata( str *tag, str *s, fields *info, param *p )
+biblatexin_cleandata( const str *tag, str *s, fields *info, param *p )
 {
 	slist tokens;
 	str *tok;
@@ -688,7 +691,7 @@ biblatexin_findref( bibl *bin, char *citekey )
 	for ( i=0; i<bin->nrefs; ++i ) {
 		n = fields_find( bin->ref[i], "refnum", -1 );
 		if ( n==-1 ) continue;
-		if ( !strcmp( bin->ref[i]->data[n].data, citekey ) ) return i;
+		if ( !strcmp( (char *) fields_value( bin->ref[i], n, FIELDS_CHRP_NOUSE ), citekey ) ) return i;
 	}
 	return -1;
 }
@@ -699,10 +702,10 @@ biblatexin_nocrossref( bibl *bin, long i, int n, param *p )
 	int n1 = fields_find( bin->ref[i], "REFNUM", -1 );
 	if ( p->progname ) fprintf( stderr, "%s: ", p->progname );
 	fprintf( stderr, "Cannot find cross-reference '%s'", 
-			bin->ref[i]->data[n].data);
+			(char *) fields_value( bin->ref[i], n, FIELDS_CHRP_NOUSE ));
 	if ( n1!=-1 )
 		fprintf( stderr, " for reference '%s'\n", 
-				bin->ref[i]->data[n1].data );
+				(char *) fields_value( bin->ref[i], n1, FIELDS_CHRP_NOUSE ) );
 	fprintf( stderr, "\n" );
 }
 
@@ -710,11 +713,12 @@ static int
 biblatexin_crossref_oneref( fields *ref, fields *cross )
 {
 	int j, nl, ntype, fstatus;
-	char *type, *nt, *nd;
+	const char *nt;
+	char *type, *nd;
 	ntype = fields_find( ref, "INTERNAL_TYPE", -1 );
 	type = ( char * ) fields_value( ref, ntype, FIELDS_CHRP_NOUSE );
 	for ( j=0; j<cross->n; ++j ) {
-		nt = ( char * ) fields_tag( cross, j, FIELDS_CHRP_NOUSE );
+		nt = fields_tag( cross, j, FIELDS_CHRP_NOUSE );
 		if ( !strcasecmp( nt, "INTERNAL_TYPE" ) ) continue;
 		if ( !strcasecmp( nt, "REFNUM" ) ) continue;
 		if ( !strcasecmp( nt, "TITLE" ) ) {
@@ -757,7 +761,8 @@ static int
 biblatexin_cleanref( fields *bibin, param *p )
 {
 	int i, n, status;
-	str *t, *d;
+	const str *t;
+	str *d;
 	n = fields_num( bibin );
 	for ( i=0; i<n; ++i ) {
 		t = fields_tag( bibin, i, FIELDS_STRP_NOUSE );
@@ -828,7 +833,8 @@ static int
 get_title_elements( fields *bibin, int currlevel, int reftype, variants *all, int nall, str *ttl, str *subttl, str *ttladdon )
 {
 	int nfields, process, level, i;
-	str *t, *d;
+	const str *t;
+	str *d;
 	char *newtag;
 
 	strs_empty( ttl, subttl, ttladdon, NULL );
@@ -1050,7 +1056,7 @@ out:
 }
 
 static int
-biblatexin_bltsubtype( fields *bibin, int n, str *intag, str *invalue, int level, param *pm, char *outtag, fields *bibout )
+biblatexin_bltsubtype( fields *bibin, int n, const str *intag, str *invalue, int level, param *pm, char *outtag, fields *bibout )
 {
 	int fstatus1, fstatus2;
 
@@ -1071,7 +1077,7 @@ biblatexin_bltsubtype( fields *bibin, int n, str *intag, str *invalue, int level
 
 /* biblatex drops school field if institution is present */
 static int
-biblatexin_bltschool( fields *bibin, int n, str *intag, str *invalue, int level, param *pm, char *outtag, fields *bibout )
+biblatexin_bltschool( fields *bibin, int n, const str *intag, str *invalue, int level, param *pm, char *outtag, fields *bibout )
 {
 	int fstatus;
 	if ( fields_find( bibin, "institution", LEVEL_ANY ) != -1 )
@@ -1084,7 +1090,7 @@ biblatexin_bltschool( fields *bibin, int n, str *intag, str *invalue, int level,
 }
 
 static int
-biblatexin_bltthesistype( fields *bibin, int n, str *intag, str *invalue, int level, param *pm, char *outtag, fields *bibout )
+biblatexin_bltthesistype( fields *bibin, int n, const str *intag, str *invalue, int level, param *pm, char *outtag, fields *bibout )
 {
 	char *p = invalue->data;
 	int fstatus = FIELDS_OK;
@@ -1105,7 +1111,7 @@ biblatexin_bltthesistype( fields *bibin, int n, str *intag, str *invalue, int le
 }
 
 static int
-biblatexin_bteprint( fields *bibin, int n, str *intag, str *invalue, int level, param *pm, char *outtag, fields *bibout )
+biblatexin_bteprint( fields *bibin, int n, const str *intag, str *invalue, int level, param *pm, char *outtag, fields *bibout )
 {
 	int neprint, netype, fstatus;
 	char *eprint = NULL, *etype = NULL;
@@ -1113,8 +1119,8 @@ biblatexin_bteprint( fields *bibin, int n, str *intag, str *invalue, int level,
 	neprint = fields_find( bibin, "eprint", -1 );
 	netype  = fields_find( bibin, "eprinttype", -1 );
 
-	if ( neprint!=-1 ) eprint = bibin->data[neprint].data;
-	if ( netype!=-1 )  etype =  bibin->data[netype].data;
+	if ( neprint!=-1 ) eprint = (char *) fields_value( bibin, neprint, FIELDS_CHRP_NOUSE );
+	if ( netype!=-1 )  etype =  (char *) fields_value( bibin, netype, FIELDS_CHRP_NOUSE );
 
 	if ( eprint && etype ) {
 		if ( !strncasecmp( etype, "arxiv", 5 ) ) {
@@ -1150,7 +1156,7 @@ biblatexin_bteprint( fields *bibin, int n, str *intag, str *invalue, int level,
 }
 
 static int
-biblatexin_btgenre( fields *bibin, int n, str *intag, str *invalue, int level, param *pm, char *outtag, fields *bibout )
+biblatexin_btgenre( fields *bibin, int n, const str *intag, str *invalue, int level, param *pm, char *outtag, fields *bibout )
 {
 	if ( fields_add( bibout, "NGENRE", str_cstr( invalue ), level ) == FIELDS_OK ) return BIBL_OK;
 	else return BIBL_ERR_MEMERR;
@@ -1169,7 +1175,7 @@ biblatexin_btgenre( fields *bibin, int n, str *intag, str *invalue, int level, p
  * into this field, so check for that first.
  */
 static int
-biblatexin_howpublished( fields *bibin, int n, str *intag, str *invalue, int level, param *pm, char *outtag, fields *bibout )
+biblatexin_howpublished( fields *bibin, int n, const str *intag, str *invalue, int level, param *pm, char *outtag, fields *bibout )
 {
 	int fstatus;
 
@@ -1207,7 +1213,7 @@ biblatexin_howpublished( fields *bibin, int n, str *intag, str *invalue, int lev
  *     "none" (for performer)
  */
 static int
-biblatexin_blteditor( fields *bibin, int m, str *intag, str *invalue, int level, param *pm, char *outtag, fields *bibout )
+biblatexin_blteditor( fields *bibin, int m, const str *intag, str *invalue, int level, param *pm, char *outtag, fields *bibout )
 {
 	char *editor_fields[] = { "editor", "editora", "editorb", "editorc" };
 	char *editor_types[]  = { "editortype", "editoratype", "editorbtype", "editorctype" };
@@ -1229,7 +1235,7 @@ biblatexin_blteditor( fields *bibin, int m, str *intag, str *invalue, int level,
 }
 
 static int
-biblatexin_person( fields *bibin, int n, str *intag, str *invalue, int level, param *pm, char *outtag, fields *bibout )
+biblatexin_person( fields *bibin, int n, const str *intag, str *invalue, int level, param *pm, char *outtag, fields *bibout )
 {
 	return biblatex_names( bibout, outtag, invalue, level, &(pm->asis), &(pm->corps) );
 }
@@ -1246,7 +1252,7 @@ biblatexin_notag( param *p, char *tag )
 static int
 biblatexin_convertf( fields *bibin, fields *bibout, int reftype, param *p )
 {
-	static int (*convertfns[NUM_REFTYPES])(fields *, int, str *, str *, int, param *, char *, fields *) = {
+	static int (*convertfns[NUM_REFTYPES])(fields *, int, const str *, str *, int, param *, char *, fields *) = {
 		[ 0 ... NUM_REFTYPES-1 ] = generic_null,
 		[ SIMPLE          ] = generic_simple,
 		[ PAGES           ] = generic_pages,
@@ -1265,7 +1271,8 @@ biblatexin_convertf( fields *bibin, fields *bibout, int reftype, param *p )
 	};
 
 	int process, level, i, nfields, status = BIBL_OK;
-	str *intag, *invalue;
+	const str *intag;
+	str *invalue;
 	char *outtag;
 
 	nfields = fields_num( bibin );
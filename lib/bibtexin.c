@@ -36,7 +36,7 @@ extern int bibtex_nall;
 static int  bibtexin_convertf( fields *bibin, fields *info, int reftype, param *p );
 static int  bibtexin_processf( fields *bibin, char *data, char *filename, long nref, param *p );
 static int  bibtexin_cleanf( bibl *bin, param *p );
-static int  bibtexin_readf( FILE *fp, char *buf, int bufsize, int *bufpos, str *line, str *reference, int *fcharset );
+static int  bibtexin_readf( reader *r, str *line, str *reference, int *fcharset );
 static int  bibtexin_typef( fields *bibin, char *filename, int nrefs, param *p );
 
 void
@@ -50,6 +50,9 @@ bibtexin_initparams( param *p, const char *progname )
 	p->utf8in           = 0;
 	p->nosplittitle     = 0;
 	p->verbose          = 0;
+	p->intern           = 0;
+	p->convcache        = 0;
+	p->borrow           = 0;
 	p->addcount         = 0;
 	p->output_raw       = 0;
 
@@ -81,10 +84,10 @@ bibtexin_initparams( param *p, const char *progname )
  *
  */
 static int
-readmore( FILE *fp, char *buf, int bufsize, int *bufpos, str *line )
+readmore( reader *r, str *line )
 {
 	if ( line->len ) return 1;
-	else return str_fget( fp, buf, bufsize, bufpos, line );
+	else return reader_getline( r, line );
 }
 
 /*
@@ -94,12 +97,12 @@ readmore( FILE *fp, char *buf, int bufsize, int *bufpos, str *line )
  * returns 1 if last reference in file, 2 if reference within file
  */
 static int
-bibtexin_readf( FILE *fp, char *buf, int bufsize, int *bufpos, str *line, str *reference, int *fcharset )
+bibtexin_readf( reader *r, str *line, str *reference, int *fcharset )
 {
 	int haveref = 0;
 	char *p;
 	*fcharset = CHARSET_UNKNOWN;
-	while ( haveref!=2 && readmore( fp, buf, bufsize, bufpos, line ) ) {
+	while ( haveref!=2 && readmore( r, line ) ) {
 		if ( line->len == 0 ) continue; /* blank line */
 		p = &(line->data[0]);
 		/* Recognize UTF8 BOM */
@@ -570,7 +573,7 @@ out:
 }
 
 static int
-is_url_tag( str *tag )
+is_url_tag( const str *tag )
 {
 	if ( str_has_value( tag ) ) {
 		if ( !strcasecmp( str_cstr( tag ), "url" ) ) return 1;
@@ -579,7 +582,7 @@ is_url_tag( str *tag )
 }
 
 static int
-is_name_tag( str *tag )
+is_name_tag( const str *tag )
 {
 	if ( str_has_value( tag ) ) {
 		if ( !strcasecmp( str_cstr( tag ), "author" ) ) return 1;
@@ -673,7 +676,7 @@ bibtex_cleantoken( str *s )
 }
 
 static int
-bibtex_cleandata( str *tag, str *s, fields *info, param *p )
+bibtex_cleandata( const str *tag, str *s, fields *info, param *p )
 {
 	int i, status;
 	slist tokens;
@@ -709,7 +712,8 @@ static int
 bibtexin_cleanref( fields *bibin, param *p )
 {
 	int i, n, status;
-	str *t, *d;
+	const str *t;
+	str *d;
 	n = fields_num( bibin );
 	for ( i=0; i<n; ++i ) {
 		t = fields_tag( bibin, i, FIELDS_STRP_NOUSE );
@@ -728,7 +732,7 @@ bibtexin_findref( bibl *bin, char *citekey )
 	for ( i=0; i<bin->nrefs; ++i ) {
 		n = fields_find( bin->ref[i], "refnum", LEVEL_ANY );
 		if ( n==-1 ) continue;
-		if ( !strcmp( bin->ref[i]->data[n].data, citekey ) ) return i;
+		if ( !strcmp( (char *) fields_value( bin->ref[i], n, FIELDS_CHRP_NOUSE ), citekey ) ) return i;
 	}
 	return -1;
 }
@@ -739,9 +743,9 @@ bibtexin_nocrossref( bibl *bin, long i, int n, param *p )
 	int n1 = fields_find( bin->ref[i], "REFNUM", LEVEL_ANY );
 	if ( p->progname ) fprintf( stderr, "%s: ", p->progname );
 	fprintf( stderr, "Cannot find cross-reference '%s'",
-			bin->ref[i]->data[n].data );
+			(char *) fields_value( bin->ref[i], n, FIELDS_CHRP_NOUSE ) );
 	if ( n1!=-1 ) fprintf( stderr, " for reference '%s'\n",
-			bin->ref[i]->data[n1].data );
+			(char *) fields_value( bin->ref[i], n1, FIELDS_CHRP_NOUSE ) );
 	fprintf( stderr, "\n" );
 }
 
@@ -749,14 +753,15 @@ static int
 bibtexin_crossref_oneref( fields *bibref, fields *bibcross )
 {
 	int j, n, nl, ntype, fstatus, status = BIBL_OK;
-	char *type, *nt, *nv;
+	const char *nt;
+	char *type, *nv;
 
 	ntype = fields_find( bibref, "INTERNAL_TYPE", LEVEL_ANY );
 	type = ( char * ) fields_value( bibref, ntype, FIELDS_CHRP_NOUSE );
 
 	n = fields_num( bibcross );
 	for ( j=0; j<n; ++j ) {
-		nt = ( char * ) fields_tag( bibcross, j, FIELDS_CHRP_NOUSE );
+		nt = fields_tag( bibcross, j, FIELDS_CHRP_NOUSE );
 		if ( !strcasecmp( nt, "INTERNAL_TYPE" ) ) continue;
 		if ( !strcasecmp( nt, "REFNUM" ) ) continue;
 		if ( !strcasecmp( nt, "TITLE" ) ) {
@@ -878,7 +883,7 @@ out:
  */
 
 static int
-bibtexin_btorg( fields *bibin, int m, str *intag, str *invalue, int level, param *pm, char *outtag, fields *bibout )
+bibtexin_btorg( fields *bibin, int m, const str *intag, str *invalue, int level, param *pm, char *outtag, fields *bibout )
 {
 	int n, fstatus;
 	n = fields_find( bibin, "publisher", LEVEL_ANY );
@@ -899,7 +904,7 @@ bibtexin_btorg( fields *bibin, int m, str *intag, str *invalue, int level, param
  */
 
 static int
-bibtexin_btsente( fields *bibin, int n, str *intag, str *invalue, int level, param *pm, char *outtag, fields *bibout )
+bibtexin_btsente( fields *bibin, int n, const str *intag, str *invalue, int level, param *pm, char *outtag, fields *bibout )
 {
 	int fstatus, status = BIBL_OK;
 	str link;
@@ -951,7 +956,7 @@ last_colon( char *p )
  * file={Description:/full/path/to/file.pdf:PDF}
  */
 static int
-bibtexin_linkedfile( fields *bibin, int m, str *intag, str *invalue, int level, param *pm, char *outtag, fields *bibout )
+bibtexin_linkedfile( fields *bibin, int m, const str *intag, str *invalue, int level, param *pm, char *outtag, fields *bibout )
 {
 	int fstatus, status = BIBL_OK;
 	char *p = invalue->data;
@@ -1005,7 +1010,7 @@ out:
  */
 
 static int
-bibtexin_howpublished( fields *bibin, int n, str *intag, str *invalue, int level, param *pm, char *outtag, fields *bibout )
+bibtexin_howpublished( fields *bibin, int n, const str *intag, str *invalue, int level, param *pm, char *outtag, fields *bibout )
 {
 	int fstatus, status = BIBL_OK;
 	if ( !strncasecmp( str_cstr( invalue ), "Diplom", 6 ) ) {
@@ -1090,7 +1095,7 @@ process_eprint_without_prefix( fields *bibout, str *value, int level )
 }
 
 static int
-bibtexin_eprint( fields *bibin, int m, str *intag, str *invalue, int level, param *pm, char *outtag, fields *bibout )
+bibtexin_eprint( fields *bibin, int m, const str *intag, str *invalue, int level, param *pm, char *outtag, fields *bibout )
 {
 	char *prefix;
 	int n;
@@ -1117,7 +1122,7 @@ bibtexin_eprint( fields *bibin, int m, str *intag, str *invalue, int level, para
  */
 
 static int
-bibtexin_keyword( fields *bibin, int m, str *intag, str *invalue, int level, param *pm, char *outtag, fields *bibout )
+bibtexin_keyword( fields *bibin, int m, const str *intag, str *invalue, int level, param *pm, char *outtag, fields *bibout )
 {
 	int fstatus, status = BIBL_OK;
 	str keyword;
@@ -1156,7 +1161,7 @@ out:
  */
 
 static int
-bibtexin_person( fields *bibin, int m, str *intag, str *invalue, int level, param *pm, char *outtag, fields *bibout )
+bibtexin_person( fields *bibin, int m, const str *intag, str *invalue, int level, param *pm, char *outtag, fields *bibout )
 {
 	int begin, end, ok, n, etal, i, status, match;
 	slist tokens;
@@ -1258,7 +1263,7 @@ bibtexin_titleinbook_isbooktitle( fields *bibin, char *intag )
 }
 
 static int
-bibtexin_title( fields *bibin, int n, str *intag, str *invalue, int level, param *pm, char *outtag, fields *bibout )
+bibtexin_title( fields *bibin, int n, const str *intag, str *invalue, int level, param *pm, char *outtag, fields *bibout )
 {
 	int ok;
 
@@ -1280,7 +1285,7 @@ bibtexin_notag( param *p, char *tag )
 static int
 bibtexin_convertf( fields *bibin, fields *bibout, int reftype, param *p )
 {
-	static int (*convertfns[NUM_REFTYPES])(fields *, int, str *, str *, int, param *, char *, fields *) = {
+	static int (*convertfns[NUM_REFTYPES])(fields *, int, const str *, str *, int, param *, char *, fields *) = {
 		[ 0 ... NUM_REFTYPES-1 ] = generic_null,
 		[ SIMPLE       ] = generic_simple,
 		[ TITLE        ] = bibtexin_title,
@@ -1297,7 +1302,8 @@ bibtexin_convertf( fields *bibin, fields *bibout, int reftype, param *p )
 	};
 
 	int process, level, i, nfields, status = BIBL_OK;
-	str *intag, *invalue;
+	const str *intag;
+	str *invalue;
 	char *outtag;
 
 	nfields = fields_num( bibin );
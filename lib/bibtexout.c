@@ -42,6 +42,8 @@ bibtexout_initparams( param *p, const char *progname )
 	p->verbose          = 0;
 	p->addcount         = 0;
 	p->singlerefperfile = 0;
+	p->sortkey          = BIBL_SORT_NONE;
+	p->dedup            = BIBL_DEDUP_NONE;
 
 	p->headerf = bibtexout_writeheader;
 	p->footerf = NULL;
@@ -76,7 +78,8 @@ static int
 bibtexout_type( fields *in, char *filename, int refnum, param *p )
 {
 	int type = TYPE_UNKNOWN, i, maxlevel, n, level;
-	char *tag, *genre;
+	const char *tag;
+	char *genre;
 
 	/* determine bibliography type */
 	for ( i=0; i<in->n; ++i ) {
@@ -85,7 +88,7 @@ bibtexout_type( fields *in, char *filename, int refnum, param *p )
 
 		genre = fields_value( in, i, FIELDS_CHRP );
 		Da1 fprintf( stderr, "GQMJr %d - genre %s\n", refnum+1, genre ); /* added to debug KTH DiVA */
-		level = in->level[i];
+		level = fields_level( in, i );
 		if ( !strcasecmp( genre, "periodical" ) ||
 		     !strcasecmp( genre, "academic journal" ) ||
 		     !strcasecmp( genre, "magazine" ) ||
@@ -162,8 +165,8 @@ bibtexout_type( fields *in, char *filename, int refnum, param *p )
 			if ( strcasecmp( tag, "ISSUANCE" ) ) continue;
 			genre = fields_value( in, i, FIELDS_CHRP );
 			if ( !strcasecmp( genre, "monographic" ) ) {
-				if ( in->level[i]==0 ) type = TYPE_BOOK;
-				else if ( in->level[i]==1 ) type = TYPE_MISC;
+				if ( fields_level( in, i )==0 ) type = TYPE_BOOK;
+				else if ( fields_level( in, i )==1 ) type = TYPE_MISC;
 			}
 		}
 	}
@@ -189,7 +192,8 @@ static void
 output( FILE *fp, fields *out, int format_opts )
 {
 	int i, j, len, nquotes;
-	char *tag, *value, ch;
+	const char *tag;
+	char *value, ch;
 
 	/* ...output type information "@article{" */
 	value = ( char * ) fields_value( out, 0, FIELDS_CHRP );
@@ -209,7 +213,7 @@ output( FILE *fp, fields *out, int format_opts )
 	/* ...rest of the references */
 	for ( j=2; j<out->n; ++j ) {
 		nquotes = 0;
-		tag   = ( char * ) fields_tag( out, j, FIELDS_CHRP );
+		tag   = fields_tag( out, j, FIELDS_CHRP );
 		value = ( char * ) fields_value( out, j, FIELDS_CHRP );
 		fprintf( fp, ",\n" );
 		if ( format_opts & BIBL_FORMAT_BIBOUT_WHITESPACE ) fprintf( fp, "  " );
@@ -351,28 +355,26 @@ append_simpleall( fields *in, char *intag, char *outtag, fields *out, int *statu
 static void
 append_keywords( fields *in, fields *out, int *status, int lang )
 {
-	str keywords, *word;
-	vplist_index i;
-	int fstatus;
-	vplist a;
+	str keywords;
+	char *word;
+	int i, fstatus;
+	fields_iter it;
 
 	str_init( &keywords );
-	vplist_init( &a );
 
 	if (lang & BIBL_LANGUAGE_ENGLISH )
-	  fields_findv_each( in, LEVEL_ANY, FIELDS_STRP, &a, "KEYWORD:EN" );
+	  fields_iter_init( &it, in, LEVEL_ANY, FIELDS_CHRP, "KEYWORD:EN", NULL );
 	else if (lang & BIBL_LANGUAGE_SWEDISH )
-	  fields_findv_each( in, LEVEL_ANY, FIELDS_STRP, &a, "KEYWORD:SV" );
+	  fields_iter_init( &it, in, LEVEL_ANY, FIELDS_CHRP, "KEYWORD:SV", NULL );
 	else 
-	  fields_findv_each( in, LEVEL_ANY, FIELDS_STRP, &a, "KEYWORD" );
+	  fields_iter_init( &it, in, LEVEL_ANY, FIELDS_CHRP, "KEYWORD", NULL );
 
-	if ( a.n ) {
+	for ( i=0; ( word = fields_iter_next( &it ) ); ++i ) {
+		if ( i>0 ) str_strcatc( &keywords, "; " );
+		str_strcatc( &keywords, word );
+	}
 
-		for ( i=0; i<a.n; ++i ) {
-			word = vplist_get( &a, i );
-			if ( i>0 ) str_strcatc( &keywords, "; " );
-			str_strcat( &keywords, word );
-		}
+	if ( i ) {
 
 		if ( str_memerr( &keywords ) ) { *status = BIBL_ERR_MEMERR; goto out; }
 
@@ -387,13 +389,13 @@ append_keywords( fields *in, fields *out, int *status, int lang )
 
 out:
 	str_free( &keywords );
-	vplist_free( &a );
 }
 
 static void
 append_fileattach( fields *in, fields *out, int *status )
 {
-	char *tag, *value;
+	const char *tag;
+	char *value;
 	int i, fstatus;
 	str data;
 
@@ -448,17 +450,17 @@ print_fields(fields *in)
  fprintf( stderr, "GQMJr::print_fields max = %d\n", in->max); /* added to debug KTH DiVA */
 
   for ( i=0; i<in->n; ++i ) {
-    fprintf( stderr, "GQMJr::print_fields in->tag[%d].data = %s\n", i, in->tag[i].data); /* added to debug KTH DiVA */
-    fprintf( stderr, "GQMJr::print_fields in->data[%d].data = %s\n", i, in->data[i].data); /* added to debug KTH DiVA */
+    fprintf( stderr, "GQMJr::print_fields in->tag[%d].data = %s\n", i, (char *) fields_tag( in, i, FIELDS_CHRP_NOUSE )); /* added to debug KTH DiVA */
+    fprintf( stderr, "GQMJr::print_fields in->data[%d].data = %s\n", i, (char *) fields_value( in, i, FIELDS_CHRP_NOUSE )); /* added to debug KTH DiVA */
 
-    if ((in->level[i]) == 0)
+    if (fields_level( in, i ) == 0)
       fprintf( stderr, "GQMJr::print_fields in->level[%d] = LEVEL_MAIN\n", i); /* added to debug KTH DiVA */
-    else if ((in->level[i]) == 1)
+    else if (fields_level( in, i ) == 1)
       fprintf( stderr, "GQMJr::print_fields in->level[%d] = LEVEL_HOST\n", i); /* added to debug KTH DiVA */
     else
-      fprintf( stderr, "GQMJr::print_fields in->level[%d] = %d\n", i, in->level[i]); /* added to debug KTH DiVA */
+      fprintf( stderr, "GQMJr::print_fields in->level[%d] = %d\n", i, fields_level( in, i )); /* added to debug KTH DiVA */
 
-    fprintf( stderr, "GQMJr::print_fields in->used[%d] = %d\n", i, in->used[i]); /* added to debug KTH DiVA */
+    fprintf( stderr, "GQMJr::print_fields in->used[%d] = %d\n", i, fields_used( in, i )); /* added to debug KTH DiVA */
   }
   
 }
@@ -477,13 +479,13 @@ append_people( fields *in, char *tag, char *ctag, char *atag,
 	/* primary citation authors */
 	npeople = 0;
 	for ( i=0; i<in->n; ++i ) {
-		if ( level!=LEVEL_ANY && in->level[i]!=level ) continue;
-		person = ( strcasecmp( in->tag[i].data, tag ) == 0 );
-		corp   = ( strcasecmp( in->tag[i].data, ctag ) == 0 );
-		asis   = ( strcasecmp( in->tag[i].data, atag ) == 0 );
+		if ( level!=LEVEL_ANY && fields_level( in, i )!=level ) continue;
+		person = fields_match_casetag( in, i, tag );
+		corp   = fields_match_casetag( in, i, ctag );
+		asis   = fields_match_casetag( in, i, atag );
 		if ( person || corp || asis ) {
-		  if (in->tag[i].data) {
-		    Da1 fprintf( stderr, "GQMJr::append_people in->tag[%d].data = %s\n", i, in->tag[i].data); /* added to debug KTH DiVA */
+		  if ( fields_tag( in, i, FIELDS_CHRP_NOUSE ) ) {
+		    Da1 fprintf( stderr, "GQMJr::append_people in->tag[%d].data = %s\n", i, (char *) fields_tag( in, i, FIELDS_CHRP_NOUSE )); /* added to debug KTH DiVA */
 		    Da1 fprintf( stderr, "GQMJr::append_people fields_value( in, %d, FIELDS_CHRP ) = %s\n", i, (char *)fields_value( in, i, FIELDS_CHRP )); /* added to debug KTH DiVA */
 		    
 		  }
@@ -998,7 +1000,7 @@ append_date( fields *in, fields *out, int *status )
 	n = find_date( in, "YEAR" );
 	if ( n!=-1 ) {
 		fields_setused( in, n );
-		fstatus = fields_add( out, "year", in->data[n].data, LEVEL_MAIN );
+		fstatus = fields_add( out, "year", (char *) fields_value( in, n, FIELDS_CHRP_NOUSE ), LEVEL_MAIN );
 		if ( fstatus!=FIELDS_OK ) {
 			*status = BIBL_ERR_MEMERR;
 			return;
@@ -1008,11 +1010,11 @@ append_date( fields *in, fields *out, int *status )
 	n = find_date( in, "MONTH" );
 	if ( n!=-1 ) {
 		fields_setused( in, n );
-		month = atoi( in->data[n].data );
+		month = atoi( (char *) fields_value( in, n, FIELDS_CHRP_NOUSE ) );
 		if ( month>0 && month<13 )
 			fstatus = fields_add( out, "month", months[month-1], LEVEL_MAIN );
 		else
-			fstatus = fields_add( out, "month", in->data[n].data, LEVEL_MAIN );
+			fstatus = fields_add( out, "month", (char *) fields_value( in, n, FIELDS_CHRP_NOUSE ), LEVEL_MAIN );
 		if ( fstatus!=FIELDS_OK ) {
 			*status = BIBL_ERR_MEMERR;
 			return;
@@ -1022,7 +1024,7 @@ append_date( fields *in, fields *out, int *status )
 	n = find_date( in, "DAY" );
 	if ( n!=-1 ) {
 		fields_setused( in, n );
-		fstatus = fields_add( out, "day", in->data[n].data, LEVEL_MAIN );
+		fstatus = fields_add( out, "day", (char *) fields_value( in, n, FIELDS_CHRP_NOUSE ), LEVEL_MAIN );
 		if ( fstatus!=FIELDS_OK ) {
 			*status = BIBL_ERR_MEMERR;
 			return;
@@ -1526,12 +1528,12 @@ append_subject( fields *in, char *intag, char *outtag, fields *out, int *status,
 	int fstatus;
 	char extended_intag[256];
 	int found = 0;
-	vplist_index i;
-	vplist a;
-	str subjects, *word;
+	fields_iter it;
+	int i;
+	str subjects;
+	char *word;
 
 	str_init( &subjects );
-	vplist_init( &a );
 
 	extended_intag[0]='\0';
 
@@ -1547,15 +1549,15 @@ append_subject( fields *in, char *intag, char *outtag, fields *out, int *status,
 	Da1 fprintf( stderr, "GQMJr::append_subject extended_intag=%s\n", extended_intag);
 
 	if ((lang & BIBL_LANGUAGE_ENGLISH ) || (lang & BIBL_LANGUAGE_SWEDISH )) {
-	  fields_findv_each( in, LEVEL_ANY, FIELDS_STRP, &a, extended_intag );
+	  fields_iter_init( &it, in, LEVEL_ANY, FIELDS_CHRP, extended_intag, NULL );
+
+	  for ( i=0; ( word = fields_iter_next( &it ) ); ++i ) {
+	    if ( i>0 ) str_strcatc( &subjects, "; " );
+	    str_strcatc( &subjects, word );
+	  }
 
-	  if ( a.n ) {
+	  if ( i ) {
 	    found = 1;
-	    for ( i=0; i<a.n; ++i ) {
-	      word = vplist_get( &a, i );
-	      if ( i>0 ) str_strcatc( &subjects, "; " );
-	      str_strcat( &subjects, word );
-	    }
 
 	    if ( str_memerr( &subjects ) ) { *status = BIBL_ERR_MEMERR; goto out; }
 
@@ -1577,15 +1579,15 @@ append_subject( fields *in, char *intag, char *outtag, fields *out, int *status,
 	  }
 	  Da1 fprintf( stderr, "GQMJr::append_subject extended_intag=%s\n", extended_intag);
 
-	  fields_findv_each( in, LEVEL_ANY, FIELDS_STRP, &a, extended_intag );
+	  fields_iter_init( &it, in, LEVEL_ANY, FIELDS_CHRP, extended_intag, NULL );
+
+	  for ( i=0; ( word = fields_iter_next( &it ) ); ++i ) {
+	    if ( i>0 ) str_strcatc( &subjects, "; " );
+	    str_strcatc( &subjects, word );
+	  }
 
-	  if ( a.n ) {
+	  if ( i ) {
 	    found = 1;
-	    for ( i=0; i<a.n; ++i ) {
-	      word = vplist_get( &a, i );
-	      if ( i>0 ) str_strcatc( &subjects, "; " );
-	      str_strcat( &subjects, word );
-	    }
 
 	    if ( str_memerr( &subjects ) ) { *status = BIBL_ERR_MEMERR; goto out; }
 
@@ -1598,7 +1600,6 @@ append_subject( fields *in, char *intag, char *outtag, fields *out, int *status,
 	}
  out:
 	str_free( &subjects );
-	vplist_free( &a );
 }
 
 /* added to support KTH DiVA - to support abstract with a given/optional language */
@@ -1691,7 +1692,7 @@ append_description(int type, fields *in, char *intag, char *outtag, fields *out,
 		  Da1 fprintf( stderr, "GQMJr::append_description intage=%s\n", intag);
 		  Da1 fprintf( stderr, "GQMJr::append_description outtage=%s\n", outtag);
 		  Da1 fprintf( stderr, "GQMJr::append_description n=%d\n", n);
-		  description_string=in->data[n].data;
+		  description_string=(char *) fields_value( in, n, FIELDS_CHRP_NOUSE );
 		  Da1 fprintf( stderr, "GQMJr::append_description description_string=%s\n", description_string);
 		  /* check the description string to see if it of the form roman_numerals,arabic_numerals or arabic_numerals  */
 		  /* if so, then this is a set of page numbers or simply the number of pages in the book */
@@ -1808,15 +1809,20 @@ append_data( fields *in, fields *out, param *p, unsigned long refnum )
 static int
 bibtexout_write( fields *in, FILE *fp, param *p, unsigned long refnum )
 {
+	fields local, *out = p->scratch;
 	int status;
-	fields out;
 
-	fields_init( &out );
+	/* fields to reuse for each reference, from bibl_write() */
+	if ( out ) fields_reset( out );
+	else {
+		fields_init( &local );
+		out = &local;
+	}
 
-	status = append_data( in, &out, p, refnum );
-	if ( status==BIBL_OK ) output( fp, &out, p->format_opts );
+	status = append_data( in, out, p, refnum );
+	if ( status==BIBL_OK ) output( fp, out, p->format_opts );
 
-	fields_free( &out );
+	if ( out==&local ) fields_free( &local );
 
 	return status;
 }
@@ -18,6 +18,7 @@ extern "C" {
 #include "slist.h"
 #include "charsets.h"
 #include "str_conv.h"
+#include "reader.h"
 
 #define BIBL_OK           (0)
 #define BIBL_ERR_BADINPUT (-1)
@@ -60,6 +61,15 @@ extern "C" {
 #define BIBL_FORMAT_BIBOUT_DROPKEY    (256)
 #define BIBL_FORMAT_MODSOUT_DROPKEY   (512)
 
+#define BIBL_SORT_NONE   (0)
+#define BIBL_SORT_REFNUM (1)  /* sort by citation key */
+#define BIBL_SORT_YEAR   (2)  /* sort by DATE:YEAR */
+#define BIBL_SORT_AUTHOR (3)  /* sort by first AUTHOR */
+
+#define BIBL_DEDUP_NONE  (0)
+#define BIBL_DEDUP_DROP  (1)  /* keep first reference of a duplicate cluster */
+#define BIBL_DEDUP_MERGE (2)  /* ...and fill in its missing fields from the rest */
+
 #define BIBL_RAW_WITHCHARCONVERT (4)
 #define BIBL_RAW_WITHMAKEREFID   (8)
 
@@ -111,6 +121,12 @@ typedef struct param {
 	uchar output_raw;
 	uchar verbose;
 	uchar singlerefperfile;
+	uchar sortkey;   /* BIBL_SORT_NONE, BIBL_SORT_REFNUM, ... */
+	uchar dedup;     /* BIBL_DEDUP_NONE, BIBL_DEDUP_DROP, BIBL_DEDUP_MERGE */
+	uchar intern;    /* If true, share identical field values, see fields_intern() */
+	long convcache;  /* Conversions kept for reuse, 0 for none, see str_conv_cache() */
+	uchar borrow;    /* If true, processf borrows values from the record, see fields_record() */
+	fields *scratch; /* Output fields writef can reuse, kept by bibl_write() */
 
 	slist asis;  /* Names that shouldn't be mangled */
 	slist corps; /* Names that shouldn't be mangled-MODS corporation type */
@@ -118,7 +134,7 @@ typedef struct param {
 	char *progname;
 
 
-        int  (*readf)(FILE*,char*,int,int*,str*,str*,int*);
+        int  (*readf)(reader*,str*,str*,int*);
         int  (*processf)(fields*,char*,char*,long,struct param*);
         int  (*cleanf)(bibl*,struct param*);
         int  (*typef) (fields*,char*,int,struct param*);
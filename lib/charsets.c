@@ -34612,15 +34612,98 @@ charset_lookupchar( int charsetin, char c )
 	return allcharconvert[charsetin].table[uc].unicode;
 }
 
+/*
+ * Reverse tables from Unicode to the charset, built the first time a
+ * charset is written. The upper bits of the character pick a page of
+ * 256 entries, which holds the charset index plus one (zero for none).
+ * Pages without any mapped character are never allocated.
+ */
+#define CHARSET_PAGEBITS ( 8 )
+#define CHARSET_PAGESIZE ( 1 << CHARSET_PAGEBITS )
+
+typedef struct charset_reverse_t {
+	int built;
+	unsigned int npages;
+	unsigned short **pages;
+} charset_reverse_t;
+
+static charset_reverse_t reverse[ ARRAYSIZE( allcharconvert ) ];
+
+static void
+charset_reverse_free( charset_reverse_t *r )
+{
+	unsigned int i;
+	if ( r->pages ) {
+		for ( i=0; i<r->npages; ++i )
+			if ( r->pages[i] ) free( r->pages[i] );
+		free( r->pages );
+	}
+	r->pages = NULL;
+	r->npages = 0;
+}
+
+/* returns 0 on a memory error, leaving r->pages NULL */
+static int
+charset_reverse_build( charset_reverse_t *r, allcharconvert_t *c )
+{
+	unsigned int maxuni = 0, page, slot;
+	unsigned short *p;
+	int i;
+
+	for ( i=0; i<c->ntable; ++i )
+		if ( c->table[i].unicode > maxuni ) maxuni = c->table[i].unicode;
+
+	r->npages = ( maxuni >> CHARSET_PAGEBITS ) + 1;
+	r->pages = ( unsigned short ** ) calloc( r->npages, sizeof( unsigned short * ) );
+	if ( !r->pages ) { r->npages = 0; return 0; }
+
+	for ( i=0; i<c->ntable; ++i ) {
+		page = c->table[i].unicode >> CHARSET_PAGEBITS;
+		slot = c->table[i].unicode & ( CHARSET_PAGESIZE - 1 );
+		p = r->pages[page];
+		if ( !p ) {
+			p = ( unsigned short * ) calloc( CHARSET_PAGESIZE, sizeof( unsigned short ) );
+			if ( !p ) { charset_reverse_free( r ); return 0; }
+			r->pages[page] = p;
+		}
+		/* the first entry for a character wins, as in a linear search */
+		if ( !p[slot] ) p[slot] = ( unsigned short )( c->table[i].index + 1 );
+	}
+	return 1;
+}
+
+static unsigned int
+charset_lookupuni_linear( allcharconvert_t *c, unsigned int unicode )
+{
+	int i;
+	for ( i=0; i<c->ntable; ++i ) {
+		if ( unicode == c->table[i].unicode )
+			return c->table[i].index;
+	}
+	return '?';
+}
+
 unsigned int
 charset_lookupuni( int charsetout, unsigned int unicode )
 {
-	int i;
+	charset_reverse_t *r;
+	unsigned short *p;
+	unsigned int page;
+
 	if ( charsetout==CHARSET_UNICODE ) return unicode;
-	for ( i=0; i<allcharconvert[charsetout].ntable; ++i ) {
-		if ( unicode == allcharconvert[charsetout].table[i].unicode )
-			return allcharconvert[charsetout].table[i].index;
+
+	r = &(reverse[charsetout]);
+	if ( !r->built ) {
+		charset_reverse_build( r, &(allcharconvert[charsetout]) );
+		r->built = 1;
 	}
-	return '?';
+	if ( !r->pages )
+		return charset_lookupuni_linear( &(allcharconvert[charsetout]), unicode );
+
+	page = unicode >> CHARSET_PAGEBITS;
+	if ( page >= r->npages ) return '?';
+	p = r->pages[page];
+	if ( !p || !p[ unicode & ( CHARSET_PAGESIZE - 1 ) ] ) return '?';
+	return p[ unicode & ( CHARSET_PAGESIZE - 1 ) ] - 1;
 }
 
@@ -26,7 +26,7 @@ extern int copac_nall;
  PUBLIC: void copacin_initparams()
 *****************************************************/
 
-static int copacin_readf( FILE *fp, char *buf, int bufsize, int *bufpos, str *line, str *reference, int *fcharset );
+static int copacin_readf( reader *r, str *line, str *reference, int *fcharset );
 static int copacin_processf( fields *bibin, char *p, char *filename, long nref, param *pm );
 static int copacin_convertf( fields *bibin, fields *info, int reftype, param *pm );
 
@@ -41,6 +41,9 @@ copacin_initparams( param *p, const char *progname )
 	p->utf8in           = 0;
 	p->nosplittitle     = 0;
 	p->verbose          = 0;
+	p->intern           = 0;
+	p->convcache        = 0;
+	p->borrow           = 0;
 	p->addcount         = 0;
 	p->output_raw       = 0;
 
@@ -81,19 +84,19 @@ copacin_istag( char *buf )
 	return 1; 
 }
 static int
-readmore( FILE *fp, char *buf, int bufsize, int *bufpos, str *line )
+readmore( reader *r, str *line )
 {
 	if ( line->len ) return 1;
-	else return str_fget( fp, buf, bufsize, bufpos, line );
+	else return reader_getline( r, line );
 }
 
 static int
-copacin_readf( FILE *fp, char *buf, int bufsize, int *bufpos, str *line, str *reference, int *fcharset )
+copacin_readf( reader *r, str *line, str *reference, int *fcharset )
 {
 	int haveref = 0, inref=0;
 	char *p;
 	*fcharset = CHARSET_UNKNOWN;
-	while ( !haveref && readmore( fp, buf, bufsize, bufpos, line ) ) {
+	while ( !haveref && readmore( r, line ) ) {
 		/* blank line separates */
 		if ( line->data==NULL ) continue;
 		if ( inref && line->len==0 ) haveref=1; 
@@ -195,7 +198,7 @@ copacin_processf( fields *copacin, char *p, char *filename, long nref, param *pm
  * editors seem to be stuck in as authors with the tag "[Editor]" in it
  */
 static int
-copacin_person( fields *bibin, int n, str *intag, str *invalue, int level, param *pm, char *outtag, fields *bibout )
+copacin_person( fields *bibin, int n, const str *intag, str *invalue, int level, param *pm, char *outtag, fields *bibout )
 {
 	char *usetag = outtag, editor[]="EDITOR";
 	int comma = 0, i, ok, status;
@@ -259,7 +262,7 @@ copacin_report_notag( param *p, char *tag )
 static int
 copacin_convertf( fields *bibin, fields *bibout, int reftype, param *p )
 {
-	static int (*convertfns[NUM_REFTYPES])(fields *, int, str *, str *, int, param *, char *, fields *) = {
+	static int (*convertfns[NUM_REFTYPES])(fields *, int, const str *, str *, int, param *, char *, fields *) = {
 		[ 0 ... NUM_REFTYPES-1 ] = generic_null,
 		[ SIMPLE       ] = generic_simple,
 		[ TITLE        ] = generic_title,
@@ -269,7 +272,8 @@ copacin_convertf( fields *bibin, fields *bibout, int reftype, param *p )
 	};
 
 	int  process, level, i, nfields, status = BIBL_OK;
-	str *intag, *invalue;
+	const str *intag;
+	str *invalue;
 	char *outtag;
 
 	nfields = fields_num( bibin );
@@ -0,0 +1,389 @@
+/*
+ * dedup.c
+ *
+ * Find references that describe the same work and merge or drop them.
+ *
+ * Each reference contributes up to three keys: its DOI, its ISBN (ISBN-10
+ * is folded to ISBN-13) and a normalized title+year+first author family
+ * name.  Keys go into a single hash table, and references sharing any key
+ * are joined into a cluster with union-find, so the whole pass is linear
+ * in the number of references.  The earliest reference of each cluster is
+ * kept.
+ *
+ * Copyright (c) Chris Putnam 2017
+ *
+ * Source code released under the GPL version 2
+ *
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include "bibutils.h"
+#include "dedup.h"
+
+#define DEDUP_KEY_DOI   (0)
+#define DEDUP_KEY_ISBN  (1)
+#define DEDUP_KEY_TITLE (2)
+#define DEDUP_NKEYS     (3)
+
+static char *dedup_keyname[ DEDUP_NKEYS+1 ] = { "doi", "isbn", "title/year/author", "linked" };
+
+typedef struct {
+	char **key;
+	long  *ref;
+	unsigned long size;
+} dedup_table;
+
+/*
+ * key construction
+ */
+
+/* keep ASCII letters and digits (lowercased) and all non-ASCII bytes */
+static void
+dedup_addnormalized( str *key, const char *p, const char *stop )
+{
+	unsigned char ch;
+	while ( *p && ( !stop || !strchr( stop, *p ) ) ) {
+		ch = (unsigned char) *p++;
+		if ( ch & 0x80 ) str_addchar( key, ch );
+		else if ( isalnum( ch ) ) str_addchar( key, tolower( ch ) );
+	}
+}
+
+static int
+dedup_doikey( fields *f, str *key )
+{
+	char *doi, *p;
+
+	str_empty( key );
+
+	doi = fields_findv( f, LEVEL_MAIN, FIELDS_CHRP_NOUSE, "DOI" );
+	if ( !doi ) return 0;
+
+	/* drop resolver prefixes such as "https://doi.org/" or "doi:" */
+	p = strstr( doi, "10." );
+	if ( !p ) p = doi;
+
+	str_strcpyc( key, "d:" );
+	while ( *p ) {
+		if ( !isspace( (unsigned char) *p ) )
+			str_addchar( key, tolower( (unsigned char) *p ) );
+		p++;
+	}
+
+	return ( key->len > 2 );
+}
+
+static int
+dedup_isbnkey( fields *f, str *key )
+{
+	char *isbn, digits[14];
+	int i, n = 0, sum = 0;
+
+	str_empty( key );
+
+	isbn = fields_findv_firstof( f, LEVEL_MAIN, FIELDS_CHRP_NOUSE,
+			"ISBN13", "ISBN", NULL );
+	if ( !isbn ) return 0;
+
+	while ( *isbn && n < 14 ) {
+		if ( isdigit( (unsigned char) *isbn ) ) digits[n++] = *isbn;
+		else if ( *isbn=='x' || *isbn=='X' ) digits[n++] = 'X';
+		isbn++;
+	}
+
+	if ( n==10 ) {
+		/* ISBN-10 -> ISBN-13: prefix 978, recompute check digit */
+		memmove( digits+3, digits, 9 );
+		memcpy( digits, "978", 3 );
+		for ( i=0; i<12; ++i )
+			sum += ( digits[i]-'0' ) * ( ( i%2 ) ? 3 : 1 );
+		digits[12] = '0' + ( 10 - sum%10 ) % 10;
+		n = 13;
+	}
+	if ( n!=13 ) return 0;
+	digits[13] = '\0';
+
+	str_strcpyc( key, "i:" );
+	str_strcatc( key, digits );
+
+	return 1;
+}
+
+static int
+dedup_titlekey( fields *f, str *key )
+{
+	char *title, *subtitle, *year, *author;
+
+	str_empty( key );
+
+	title = fields_findv( f, LEVEL_MAIN, FIELDS_CHRP_NOUSE, "TITLE" );
+	if ( !title ) return 0;
+	subtitle = fields_findv( f, LEVEL_MAIN, FIELDS_CHRP_NOUSE, "SUBTITLE" );
+
+	year = fields_findv( f, LEVEL_MAIN, FIELDS_CHRP_NOUSE, "DATE:YEAR" );
+	if ( !year )
+		year = fields_findv_firstof( f, LEVEL_ANY, FIELDS_CHRP_NOUSE,
+			"DATE:YEAR", "PARTDATE:YEAR", NULL );
+	if ( !year ) return 0;
+
+	author = fields_findv( f, LEVEL_MAIN, FIELDS_CHRP_NOUSE, "AUTHOR" );
+	if ( !author )
+		author = fields_findv_firstof( f, LEVEL_ANY, FIELDS_CHRP_NOUSE,
+			"AUTHOR", "AUTHOR:CORP", "AUTHOR:ASIS", NULL );
+	if ( !author ) return 0;
+
+	str_strcpyc( key, "t:" );
+	dedup_addnormalized( key, title, NULL );
+	if ( subtitle ) dedup_addnormalized( key, subtitle, NULL );
+	if ( key->len==2 ) return 0;
+
+	str_addchar( key, '|' );
+	while ( *year && !isdigit( (unsigned char) *year ) ) year++;
+	while ( isdigit( (unsigned char) *year ) ) str_addchar( key, *year++ );
+
+	str_addchar( key, '|' );
+	dedup_addnormalized( key, author, "|" );
+
+	return 1;
+}
+
+/*
+ * hash table of key -> first reference with that key
+ */
+
+static unsigned long
+dedup_hash( const char *p )
+{
+	unsigned long h = 2166136261UL;
+	while ( *p ) {
+		h ^= (unsigned char) *p++;
+		h *= 16777619UL;
+	}
+	return h;
+}
+
+static int
+dedup_table_init( dedup_table *t, long nkeys )
+{
+	unsigned long size = 16;
+
+	while ( size < 2 * (unsigned long) nkeys ) size *= 2;
+
+	t->key = ( char ** ) calloc( size, sizeof( char * ) );
+	t->ref = ( long * ) malloc( sizeof( long ) * size );
+	if ( !t->key || !t->ref ) {
+		if ( t->key ) free( t->key );
+		if ( t->ref ) free( t->ref );
+		return 0;
+	}
+	t->size = size;
+	return 1;
+}
+
+static void
+dedup_table_free( dedup_table *t )
+{
+	unsigned long i;
+	for ( i=0; i<t->size; ++i )
+		if ( t->key[i] ) free( t->key[i] );
+	free( t->key );
+	free( t->ref );
+}
+
+/* returns the reference already holding key, -1 if key was added, -2 on memory error */
+static long
+dedup_table_lookupadd( dedup_table *t, const char *key, long ref )
+{
+	unsigned long h = dedup_hash( key ) & ( t->size - 1 );
+
+	while ( t->key[h] ) {
+		if ( !strcmp( t->key[h], key ) ) return t->ref[h];
+		h = ( h + 1 ) & ( t->size - 1 );
+	}
+
+	t->key[h] = strdup( key );
+	if ( !t->key[h] ) return -2;
+	t->ref[h] = ref;
+
+	return -1;
+}
+
+/*
+ * union-find over reference positions, earliest reference is the root
+ */
+
+static long
+dedup_root( long *parent, long n )
+{
+	while ( parent[n]!=n ) {
+		parent[n] = parent[ parent[n] ];
+		n = parent[n];
+	}
+	return n;
+}
+
+static void
+dedup_join( long *parent, long a, long b )
+{
+	a = dedup_root( parent, a );
+	b = dedup_root( parent, b );
+	if ( a < b ) parent[b] = a;
+	else if ( b < a ) parent[a] = b;
+}
+
+/* copy over fields from dup whose tag/level is missing from keep; all of
+ * the values of such a tag are copied, so which are missing is settled
+ * against keep as it was before any are added */
+static int
+dedup_merge( fields *keep, fields *dup )
+{
+	int i, n, level, status = BIBL_OK;
+	const char *tag;
+	char *value, *add;
+
+	n = fields_num( dup );
+	if ( n==0 ) return BIBL_OK;
+
+	add = ( char * ) malloc( n );
+	if ( !add ) return BIBL_ERR_MEMERR;
+
+	for ( i=0; i<n; ++i ) {
+		tag   = fields_tag( dup, i, FIELDS_CHRP_NOUSE );
+		value = fields_value( dup, i, FIELDS_CHRP_NOUSE );
+		level = fields_level( dup, i );
+		add[i] = ( value[0]!='\0' && fields_find( keep, tag, level )==-1 );
+	}
+
+	for ( i=0; i<n && status==BIBL_OK; ++i ) {
+		if ( !add[i] ) continue;
+		tag   = fields_tag( dup, i, FIELDS_CHRP_NOUSE );
+		value = fields_value( dup, i, FIELDS_CHRP_NOUSE );
+		level = fields_level( dup, i );
+		if ( fields_add( keep, tag, value, level )!=FIELDS_OK )
+			status = BIBL_ERR_MEMERR;
+	}
+
+	free( add );
+	return status;
+}
+
+static char *
+dedup_refname( fields *f )
+{
+	char *refnum = fields_findv( f, LEVEL_ANY, FIELDS_CHRP_NOUSE, "REFNUM" );
+	return ( refnum ) ? refnum : "";
+}
+
+static void
+dedup_report( FILE *fp, char *progname, bibl *b, long *parent, long *next, int *why )
+{
+	long i, j, nclusters = 0, ndups = 0;
+
+	for ( i=0; i<b->nrefs; ++i ) {
+		if ( parent[i]!=i || next[i]==-1 ) continue;
+		nclusters++;
+		if ( progname ) fprintf( fp, "%s: ", progname );
+		fprintf( fp, "Duplicates of reference %ld '%s':", i+1, dedup_refname( b->ref[i] ) );
+		for ( j=next[i]; j!=-1; j=next[j] ) {
+			fprintf( fp, " %ld '%s' (%s)", j+1, dedup_refname( b->ref[j] ),
+				dedup_keyname[ why[j] ] );
+			ndups++;
+		}
+		fprintf( fp, "\n" );
+	}
+	if ( progname ) fprintf( fp, "%s: ", progname );
+	fprintf( fp, "Found %ld duplicate references in %ld clusters.\n", ndups, nclusters );
+}
+
+/* bibl_dedup()
+ *
+ * mode is BIBL_DEDUP_DROP (keep the first reference of each cluster) or
+ * BIBL_DEDUP_MERGE (also copy fields missing from the first reference
+ * out of its duplicates).  If report is non-NULL, clusters are listed.
+ *
+ * returns BIBL_OK or BIBL_ERR_MEMERR
+ */
+int
+bibl_dedup( bibl *b, int mode, FILE *report, char *progname )
+{
+	int (*keyf[ DEDUP_NKEYS ])( fields *, str * ) = { dedup_doikey, dedup_isbnkey, dedup_titlekey };
+	long i, k, n, *parent = NULL, *next = NULL, *tail = NULL;
+	int j, *why = NULL, status = BIBL_OK;
+	dedup_table table;
+	str key;
+
+	if ( mode==BIBL_DEDUP_NONE || b->nrefs < 2 ) return BIBL_OK;
+
+	if ( !dedup_table_init( &table, DEDUP_NKEYS * b->nrefs ) )
+		return BIBL_ERR_MEMERR;
+
+	str_init( &key );
+
+	parent = ( long * ) malloc( sizeof( long ) * b->nrefs );
+	next   = ( long * ) malloc( sizeof( long ) * b->nrefs );
+	tail   = ( long * ) malloc( sizeof( long ) * b->nrefs );
+	why    = ( int * )  malloc( sizeof( int ) * b->nrefs );
+	if ( !parent || !next || !tail || !why ) {
+		status = BIBL_ERR_MEMERR;
+		goto out;
+	}
+
+	for ( i=0; i<b->nrefs; ++i ) {
+		parent[i] = tail[i] = i;
+		next[i] = -1;
+		why[i] = -1;
+		for ( j=0; j<DEDUP_NKEYS; ++j ) {
+			if ( !keyf[j]( b->ref[i], &key ) ) continue;
+			if ( str_memerr( &key ) ) {
+				status = BIBL_ERR_MEMERR;
+				goto out;
+			}
+			n = dedup_table_lookupadd( &table, str_cstr( &key ), i );
+			if ( n==-2 ) {
+				status = BIBL_ERR_MEMERR;
+				goto out;
+			}
+			if ( n < 0 ) continue;
+			if ( why[i]==-1 ) why[i] = j;
+			dedup_join( parent, n, i );
+		}
+	}
+
+	/* flatten clusters and chain members behind their root, in order */
+	for ( i=0; i<b->nrefs; ++i ) {
+		parent[i] = dedup_root( parent, i );
+		if ( parent[i]==i ) continue;
+		if ( why[i]==-1 ) why[i] = DEDUP_NKEYS;
+		next[ tail[ parent[i] ] ] = i;
+		tail[ parent[i] ] = i;
+	}
+
+	if ( report ) dedup_report( report, progname, b, parent, next, why );
+
+	if ( mode==BIBL_DEDUP_MERGE ) {
+		for ( i=0; i<b->nrefs && status==BIBL_OK; ++i ) {
+			if ( parent[i]==i ) continue;
+			status = dedup_merge( b->ref[ parent[i] ], b->ref[i] );
+		}
+	}
+
+	for ( i=k=0; i<b->nrefs; ++i ) {
+		if ( parent[i]==i ) b->ref[k++] = b->ref[i];
+		else {
+			fields_free( b->ref[i] );
+			free( b->ref[i] );
+		}
+	}
+	b->nrefs = k;
+
+out:
+	dedup_table_free( &table );
+	str_free( &key );
+	if ( parent ) free( parent );
+	if ( next )   free( next );
+	if ( tail )   free( tail );
+	if ( why )    free( why );
+	return status;
+}
@@ -0,0 +1,17 @@
+/*
+ * dedup.h
+ *
+ * Copyright (c) Chris Putnam 2017
+ *
+ * Source code released under the GPL version 2
+ *
+ */
+#ifndef DEDUP_H
+#define DEDUP_H
+
+#include <stdio.h>
+#include "bibl.h"
+
+int bibl_dedup( bibl *b, int mode, FILE *report, char *progname );
+
+#endif
@@ -16,7 +16,7 @@
 #include "xml_encoding.h"
 #include "bibformats.h"
 
-static int ebiin_readf( FILE *fp, char *buf, int bufsize, int *bufpos, str *line, str *reference, int *fcharset );
+static int ebiin_readf( reader *r, str *line, str *reference, int *fcharset );
 static int ebiin_processf( fields *ebiin, char *data, char *filename, long nref, param *p );
 
 
@@ -34,6 +34,9 @@ ebiin_initparams( param *p, const char *progname )
 	p->utf8in           = 1;
 	p->nosplittitle     = 0;
 	p->verbose          = 0;
+	p->intern           = 0;
+	p->convcache        = 0;
+	p->borrow           = 0;
 	p->addcount         = 0;
 	p->output_raw       = BIBL_RAW_WITHMAKEREFID |
 	                      BIBL_RAW_WITHCHARCONVERT;
@@ -57,13 +60,13 @@ ebiin_initparams( param *p, const char *progname )
  PUBLIC: int ebiin_readf()
 *****************************************************/
 static int
-ebiin_readf( FILE *fp, char *buf, int bufsize, int *bufpos, str *line, str *reference, int *fcharset )
+ebiin_readf( reader *r, str *line, str *reference, int *fcharset )
 {
 	int haveref = 0, inref = 0, file_charset = CHARSET_UNKNOWN, m;
 	char *startptr = NULL, *endptr;
 	str tmp;
 	str_init( &tmp );
-	while ( !haveref && str_fget( fp, buf, bufsize, bufpos, line ) ) {
+	while ( !haveref && reader_getline( r, line ) ) {
 		if ( line->data ) {
 			m = xml_getencoding( line );
 			if ( m!=CHARSET_UNKNOWN ) file_charset = m;
@@ -26,7 +26,7 @@ extern int end_nall;
  PUBLIC: void endin_initparams()
 *****************************************************/
 
-static int endin_readf( FILE *fp, char *buf, int bufsize, int *bufpos, str *line, str *reference, int *fcharset );
+static int endin_readf( reader *r, str *line, str *reference, int *fcharset );
 static int endin_processf( fields *endin, char *p, char *filename, long nref, param *pm );
 int endin_typef( fields *endin, char *filename, int nrefs, param *p );
 int endin_convertf( fields *endin, fields *info, int reftype, param *p );
@@ -43,6 +43,9 @@ endin_initparams( param *p, const char *progname )
 	p->utf8in           = 0;
 	p->nosplittitle     = 0;
 	p->verbose          = 0;
+	p->intern           = 0;
+	p->convcache        = 0;
+	p->borrow           = 0;
 	p->addcount         = 0;
 	p->output_raw       = 0;
 
@@ -84,20 +87,20 @@ endin_istag( char *buf )
 }
 
 static int
-readmore( FILE *fp, char *buf, int bufsize, int *bufpos, str *line )
+readmore( reader *r, str *line )
 {
 	if ( line->len ) return 1;
-	else return str_fget( fp, buf, bufsize, bufpos, line );
+	else return reader_getline( r, line );
 }
 
 static int
-endin_readf( FILE *fp, char *buf, int bufsize, int *bufpos, str *line, str *reference, int *fcharset )
+endin_readf( reader *r, str *line, str *reference, int *fcharset )
 {
 	int haveref = 0, inref = 0;
 	unsigned char *up;
 	char *p;
 	*fcharset = CHARSET_UNKNOWN;
-	while ( !haveref && readmore( fp, buf, bufsize, bufpos, line ) ) {
+	while ( !haveref && readmore( r, line ) ) {
 		if ( !line->data ) continue;
 		p = &(line->data[0]);
 
@@ -167,7 +170,7 @@ process_endline2( str *tag, str *data, char *p )
 static int
 endin_processf( fields *endin, char *p, char *filename, long nref, param *pm )
 {
-	str tag, data;
+	str tag, data, *value;
 	int status, n;
 	strs_init( &tag, &data, NULL );
 	while ( *p ) {
@@ -182,12 +185,13 @@ endin_processf( fields *endin, char *p, char *filename, long nref, param *pm )
 			/* endnote puts %K only on 1st line of keywords */
 			n = fields_num( endin );
 			if ( n>0 && str_has_value( &data ) ) {
-			if ( !strncmp( endin->tag[n-1].data, "%K", 2 ) ) {
+			if ( !strncmp( fields_tag( endin, n-1, FIELDS_CHRP_NOUSE ), "%K", 2 ) ) {
 				status = fields_add( endin, "%K", str_cstr( &data ), 0 );
 				if ( status!=FIELDS_OK ) return 0;
 			} else {
-				str_addchar( &(endin->data[n-1]), ' ' );
-				str_strcat( &(endin->data[n-1]), &data );
+				value = fields_value( endin, n-1, FIELDS_STRP_NOUSE );
+				str_addchar( value, ' ' );
+				str_strcat( value, &data );
 			}
 			}
 		}
@@ -254,7 +258,8 @@ endin_typef( fields *endin, char *filename, int nrefs, param *p )
 static int
 is_wiley_author( fields *endin, int n )
 {
-	str *t, *v;
+	const str *t;
+	str *v;
 	t = fields_tag( endin, n, FIELDS_STRP_NOUSE );
 	if ( str_is_empty( t ) || strcmp( t->data, "%A" ) ) return 0;
 	v = fields_value( endin, n, FIELDS_STRP_NOUSE );
@@ -272,7 +277,7 @@ cleanup_wiley_author( fields *endin, int n )
 
 	strs_init( &copy, &name, NULL );
 
-	instring = &( endin->data[n] );
+	instring = fields_value( endin, n, FIELDS_STRP_NOUSE );
 	str_strcpy( &copy, instring );
 
 	p = copy.data;
@@ -286,8 +291,8 @@ cleanup_wiley_author( fields *endin, int n )
 				if ( str_memerr( instring ) )
 					return BIBL_ERR_MEMERR;
 			} else {
-				status = fields_add( endin, endin->tag[n].data,
-					name.data, endin->level[n] );
+				status = fields_add( endin, fields_tag( endin, n, FIELDS_CHRP_NOUSE ),
+					name.data, fields_level( endin, n ) );
 				if ( status!=FIELDS_OK )
 					return BIBL_ERR_MEMERR;
 			}
@@ -374,7 +379,7 @@ month_convert( char *in, char *out )
 }
 
 static int
-endin_date( fields *bibin, int n, str *intag, str *invalue, int level, param *pm, char *outtag, fields *bibout )
+endin_date( fields *bibin, int n, const str *intag, str *invalue, int level, param *pm, char *outtag, fields *bibout )
 {
 	char *tags[3][2] = {
 		{ "DATE:YEAR",  "PARTDATE:YEAR" },
@@ -446,7 +451,7 @@ endin_date( fields *bibin, int n, str *intag, str *invalue, int level, param *pm
 }
 
 static int
-endin_type( fields *bibin, int n, str *intag, str *invalue, int level, param *pm, char *outtag, fields *bibout )
+endin_type( fields *bibin, int n, const str *intag, str *invalue, int level, param *pm, char *outtag, fields *bibout )
 {
 	lookups types[] = {
 		{ "GENERIC",                "ARTICLE" },
@@ -505,7 +510,7 @@ endin_notag( param *p, char *tag, char *data )
 int
 endin_convertf( fields *bibin, fields *bibout, int reftype, param *p )
 {
-	static int (*convertfns[NUM_REFTYPES])(fields *, int, str *, str *, int, param *, char *, fields *) = {
+	static int (*convertfns[NUM_REFTYPES])(fields *, int, const str *, str *, int, param *, char *, fields *) = {
 		[ 0 ... NUM_REFTYPES-1 ] = generic_null,
 		[ SIMPLE       ] = generic_simple,
 		[ TITLE        ] = generic_title,
@@ -520,7 +525,8 @@ endin_convertf( fields *bibin, fields *bibout, int reftype, param *p )
 
 	int i, level, process, nfields, fstatus, status = BIBL_OK;
 	char *outtag;
-	str *intag, *invalue;
+	const str *intag;
+	str *invalue;
 
 	nfields = fields_num( bibin );
 	for ( i=0; i<nfields; ++i ) {
@@ -540,7 +546,7 @@ endin_convertf( fields *bibin, fields *bibout, int reftype, param *p )
 		 * and just copy and paste to output
 		 */
 		if ( str_has_value( intag ) && intag->data[0]!='%' ) {
-			fstatus = fields_add( bibout, str_cstr( intag ), str_cstr( invalue ), bibin->level[i] );
+			fstatus = fields_add( bibout, str_cstr( intag ), str_cstr( invalue ), fields_level( bibin, i ) );
 			if ( fstatus!=FIELDS_OK ) return BIBL_ERR_MEMERR;
 			continue;
 		}
@@ -38,6 +38,8 @@ endout_initparams( param *p, const char *progname )
 	p->verbose          = 0;
 	p->addcount         = 0;
 	p->singlerefperfile = 0;
+	p->sortkey          = BIBL_SORT_NONE;
+	p->dedup            = BIBL_DEDUP_NONE;
 
 	if ( p->charsetout == BIBL_CHARSET_UNICODE ) {
 		p->utf8out = p->utf8bom = 1;
@@ -259,7 +261,8 @@ get_type( fields *in, param *p, unsigned long refnum )
 	int nmatch_genres = sizeof( match_genres ) / sizeof( match_genres[0] );
 
 	int i, j, n, maxlevel, type = TYPE_UNKNOWN;
-	char *tag, *data;
+	const char *tag;
+	char *data;
 
 	/* Determine type from genre information */
 	for ( i=0; i<in->n; ++i ) {
@@ -285,17 +288,17 @@ get_type( fields *in, param *p, unsigned long refnum )
 			else if ( !strcasecmp( data, "thesis" ) )
 				type = TYPE_THESIS;
 			else if ( !strcasecmp( data, "book" ) ) {
-				if ( in->level[i]==0 ) type = TYPE_BOOK;
+				if ( fields_level( in, i )==0 ) type = TYPE_BOOK;
 				else type = TYPE_INBOOK;
 			}
 			else if ( !strcasecmp( data, "collection" ) ) {
-				if ( in->level[i]==0 ) type = TYPE_BOOK;
+				if ( fields_level( in, i )==0 ) type = TYPE_BOOK;
 				else type = TYPE_INBOOK;
 			}
 			if ( type!=TYPE_UNKNOWN ) fields_setused( in, i );
 		}
 		/* the inbook type should be defined if 'book' in host */
-		if ( type==TYPE_BOOK && in->level[i]>0 ) type = TYPE_INBOOK;
+		if ( type==TYPE_BOOK && fields_level( in, i )>0 ) type = TYPE_INBOOK;
 	}
 	if ( p->verbose ) {
 		if ( p->progname ) fprintf( stderr, "%s: ", p->progname );
@@ -331,7 +334,7 @@ get_type( fields *in, param *p, unsigned long refnum )
 				continue;
 			data = fields_value( in, i, FIELDS_CHRP );
 			if ( !strcasecmp( data, "monographic" ) ) {
-				if ( in->level[i]==0 ) type = TYPE_BOOK;
+				if ( fields_level( in, i )==0 ) type = TYPE_BOOK;
 				else type = TYPE_INBOOK;
 			}
 		}
@@ -462,7 +465,7 @@ append_people( fields *in, char *tag, char *entag, int level, fields *out, int *
 {
 	int i, n, flvl, fstatus;
 	str oneperson;
-	char *ftag;
+	const char *ftag;
 
 	str_init( &oneperson );
 	n = fields_num( in );
@@ -594,16 +597,14 @@ append_thesishint( int type, fields *out, int *status )
 static void
 append_easyall( fields *in, char *tag, char *entag, int level, fields *out, int *status )
 {
-	vplist_index i;
+	fields_iter it;
+	char *value;
 	int fstatus;
-	vplist a;
-	vplist_init( &a );
-	fields_findv_each( in, level, FIELDS_CHRP, &a, tag );
-	for ( i=0; i<a.n; ++i ) {
-		fstatus = fields_add( out, entag, (char *) vplist_get( &a, i ), LEVEL_MAIN );
+	fields_iter_init( &it, in, level, FIELDS_CHRP, tag, NULL );
+	while ( ( value = fields_iter_next( &it ) ) ) {
+		fstatus = fields_add( out, entag, value, LEVEL_MAIN );
 		if ( fstatus!=FIELDS_OK ) *status = BIBL_ERR_MEMERR;
 	}
-	vplist_free( &a );
 }
 
 static void
@@ -735,13 +736,19 @@ output( FILE *fp, fields *out )
 static int
 endout_write( fields *in, FILE *fp, param *p, unsigned long refnum )
 {
+	fields local, *out = p->scratch;
 	int status;
-	fields out;
 
-	fields_init( &out );
-	status = append_data( in, &out, p, refnum );
-	if ( status==BIBL_OK ) output( fp, &out );
-	fields_free( &out );
+	/* fields to reuse for each reference, from bibl_write() */
+	if ( out ) fields_reset( out );
+	else {
+		fields_init( &local );
+		out = &local;
+	}
+	status = append_data( in, out, p, refnum );
+	if ( status==BIBL_OK ) output( fp, out );
+
+	if ( out==&local ) fields_free( &local );
 
 	return status;
 }
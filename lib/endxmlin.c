@@ -25,7 +25,7 @@ typedef struct {
 extern variants end_all[];
 extern int end_nall;
 
-static int endxmlin_readf( FILE *fp, char *buf, int bufsize, int *bufpos, str *line, str *reference, int *fcharset );
+static int endxmlin_readf( reader *r, str *line, str *reference, int *fcharset );
 static int endxmlin_processf( fields *endin, char *p, char *filename, long nref, param *pm );
 extern int endin_typef( fields *endin, char *filename, int nrefs, param *p );
 extern int endin_convertf( fields *endin, fields *info, int reftype, param *p );
@@ -46,6 +46,9 @@ endxmlin_initparams( param *p, const char *progname )
 	p->utf8in           = 1;
 	p->nosplittitle     = 0;
 	p->verbose          = 0;
+	p->intern           = 0;
+	p->convcache        = 0;
+	p->borrow           = 0;
 	p->addcount         = 0;
 	p->output_raw       = 0;
 
@@ -68,27 +71,28 @@ endxmlin_initparams( param *p, const char *progname )
  PUBLIC: int endxmlin_readf()
 *****************************************************/
 
+/* append the next line, returns 1 at the end of input */
 static int
-xml_readmore( FILE *fp, char *buf, int bufsize, int *bufpos )
+xml_readmore( reader *r, str *line, str *more )
 {
-	if ( !feof( fp ) && fgets( buf, bufsize, fp ) ) return 0;
-	return 1;
+	if ( !reader_getline( r, more ) ) return 1;
+	str_strcat( line, more );
+	str_addchar( line, '\n' );
+	return 0;
 }
 
 static int
-endxmlin_readf( FILE *fp, char *buf, int bufsize, int *bufpos, str *line, str *reference, int *fcharset )
+endxmlin_readf( reader *r, str *line, str *reference, int *fcharset )
 {
 	str tmp;
 	char *startptr = NULL, *endptr = NULL;
-	int haveref = 0, inref = 0, done = 0, file_charset = CHARSET_UNKNOWN, m;
+	int haveref = 0, eof = 0, done = 0, file_charset = CHARSET_UNKNOWN, m;
 	str_init( &tmp );
 	while ( !haveref && !done ) {
+		/* look for both tags in the same pass, a line can hold whole records */
 		if ( line->data ) {
-			if ( !inref ) {
-				startptr = xml_findstart( line->data, "RECORD" );
-				if ( startptr ) inref = 1;
-			} else
-				endptr = xml_findend( line->data, "RECORD" );
+			startptr = xml_findstart( line->data, "RECORD" );
+			if ( startptr ) endptr = xml_findend( startptr, "RECORD" );
 		}
 
 		/* If no <record> tag, we can trim up to last 8 bytes */
@@ -103,12 +107,10 @@ endxmlin_readf( FILE *fp, char *buf, int bufsize, int *bufpos, str *line, str *r
 		}
 
 		if ( !startptr || !endptr ) {
-			done = xml_readmore( fp, buf, bufsize, bufpos );
-			str_strcatc( line, buf );
+			/* at the end of input, stop only after checking the last line */
+			if ( eof ) done = 1;
+			else eof = xml_readmore( r, line, &tmp );
 		} else {
-			/* we can reallocate in the str_strcat, so re-find */
-			startptr = xml_findstart( line->data, "RECORD" );
-			endptr = xml_findend( line->data, "RECORD" );
 			str_segcpy( reference, startptr, endptr );
 			/* clear out information in line */
 			str_strcpyc( &tmp, endptr );
@@ -11,295 +11,2111 @@
 #include <ctype.h>
 #include "entities.h"
 
-/* HTML 4.0 entities */
+/* Named character references of HTML5 that stand for a single character
+ * (a few of them as HTML 4.0 had them), plus some in use that were never
+ * defined. Sorted by name, which is case sensitive, for a binary search.
+ */
 
 typedef struct entities {
-	char html[20];
+	char name[32];
 	unsigned int unicode;
 } entities;
 
-entities html_entities[] = {
-	/* Special Entities */
-	{ "&quot;",     34 },  /* quotation mark */
-	{ "&amp;",      38 },  /* ampersand */
-	{ "&apos;",     39 },  /* apostrophe (note not defined in HTML) */
-	{ "&lpar;",     40 },  /* left parenthesis */
-	{ "&rpar;",     41 },  /* right parenthesis */
-	{ "&hyphen;",   45 },  /* hyphen */
-	{ "&lt;",       60 },  /* less-than sign */
-	{ "&gt;",       62 },  /* greater-than sign */
-	{ "&quest;",    63 },  /* question mark */
-	{ "&OElig;",   338 },  /* Latin cap ligature OE */
-	{ "&oelig;",   339 },  /* Latin small ligature OE */
-	{ "&Scaron;",  352 },  /* Latin cap S with caron */
-	{ "&scaron;",  353 },  /* Latin cap S with caron */
-	{ "&Yuml;",    376 },  /* Latin cap y with diaeresis */
-	{ "&circ;",    710 },  /* modifier letter circumflex */
-	{ "&tilde;",   732 },  /* small tilde */
-	{ "&ensp;",   8194 }, /* en space */
-	{ "&emsp;",   8195 }, /* em space */
-	{ "&thinsp;", 8201 }, /* thin space */
-	{ "&zwnj;",   8204 }, /* zero width non-joiner */
-	{ "&zwj;",    8205 }, /* zero width joiner */
-	{ "&lrm;",    8206 }, /* left-to-right mark */
-	{ "&rlm;",    8207 }, /* right-to-left mark */
-	{ "&ndash;",  8211 }, /* en dash */
-	{ "&mdash;",  8212 }, /* em dash */
-	{ "&lsquo;",  8216 }, /* left single quotation mark */
-	{ "&rsquo;",  8217 }, /* right single quot. mark */
-	{ "&sbquo;",  8218 }, /* single low-9 quot. mark */
-	{ "&ldquo;",  8220 }, /* left double quot. mark */
-	{ "&rdquo;",  8221 }, /* right double quot. mark */
-	{ "&bdquo;",  8222 }, /* double low-9 quot. mark */
-	{ "&dagger;", 8224 }, /* dagger */
-	{ "&Dagger;", 8225 }, /* double dagger */
-	{ "&permil;", 8240 }, /* per mille sign */
-	{ "&lsaquo;", 8249 }, /* sin. left angle quot mark */
-	{ "&rsaquo;", 8250 }, /* sin. right angle quot mark */
-	{ "&euro;",   8364 }, /* euro sign */
-	/* Symbols and Greek characters */
-	{ "&fnof;",    402 }, /* small f with hook = function */
-	{ "&Alpha;",   913 }, /* capital alpha */
-	{ "&Beta;",    914 }, /* capital beta */
-	{ "&Gamma;",   915 }, /* capital gamma */
-	{ "&Delta;",   916 }, /* capital delta */
-	{ "&Epsilon;", 917 }, /* capital epsilon */
-	{ "&Zeta;",    918 }, /* capital zeta */
-	{ "&Eta;",     919 }, /* capital eta */
-	{ "&Theta;",   920 }, /* capital theta */
-	{ "&Iota;",    921 }, /* capital iota */
-	{ "&Kappa;",   922 }, /* capital kappa */
-	{ "&Lambda;",  923 }, /* capital lambda */
-	{ "&Mu;",      924 }, /* capital mu */
-	{ "&Nu;",      925 }, /* capital nu */
-	{ "&Xi;",      926 }, /* capital xi */
-	{ "&Omicron;", 927 }, /* capital omicron */
-	{ "&Pi;",      928 }, /* capital pi */
-	{ "&Rho;",     929 }, /* capital rho */
-	{ "&Sigma;",   931 }, /* capital sigma */
-	{ "&Tau;",     932 }, /* capital tau */
-	{ "&Upsilon;", 933 }, /* capital upsilon */
-	{ "&Phi;",     934 }, /* capital phi */
-	{ "&Chi;",     935 }, /* capital chi */
-	{ "&Psi;",     936 }, /* capital psi */
-	{ "&Omega;",   937 }, /* capital omega */
-	{ "&alpha;",   945 }, /* small alpha */
-	{ "&beta;",    946 }, /* small beta */
-	{ "&gamma;",   947 }, /* small gamma */
-	{ "&delta;",   948 }, /* small delta */
-	{ "&epsilon;", 949 }, /* small epsilon */
-	{ "&zeta;",    950 }, /* small zeta */
-	{ "&eta;",     951 }, /* small eta */
-	{ "&theta;",   952 }, /* small theta */
-	{ "&iota;",    953 }, /* small iota */
-	{ "&kappa;",   954 }, /* small kappa */
-	{ "&lambda;",  955 }, /* small lambda */
-	{ "&mu;",      956 }, /* small mu */
-	{ "&nu;",      957 }, /* small nu */
-	{ "&xi;",      958 }, /* small xi */
-	{ "&omicron;", 959 }, /* small omicron */
-	{ "&pi;",      960 }, /* small pi */
-	{ "&rho;",     961 }, /* small rho */
-	{ "&sigmaf;",  962 }, /* small final sigma */
-	{ "&sigma;",   963 }, /* small simga */
-	{ "&tau;",     964 }, /* small tau */
-	{ "&upsilon;", 965 }, /* small upsilon */
-	{ "&phi;",     966 }, /* small phi */
-	{ "&chi;",     967 }, /* small chi */
-	{ "&psi;",     968 }, /* small psi */
-	{ "&omega;",   969 }, /* small omega */
-	{ "&thetasym;",977 }, /* small theta symbol */
-	{ "&upsih;",   978 }, /* small upsilon with hook */
-	{ "&piv;",     982 }, /* pi symbol */
-	{ "&bull;",   8226 }, /* bullet = small blk circle */
-	{ "&hellip;", 8230 }, /* horizontal ellipsis */
-	{ "&prime;",  8242 }, /* prime = minutes = feet */
-	{ "&Prime;",  8243 }, /* double prime */
-	{ "&oline;",  8254 }, /* overline */
-	{ "&frasl;",  8260 }, /* fraction slash */
-	{ "&weierp;", 8472 }, /* Weierstrass p = power set */
-	{ "&image;",  8465 }, /* imaginary part-black cap I */
-	{ "&real;",   8476 }, /* real part-black cap R */
-	{ "&trade;",  8482 }, /* trademark sign */
-	{ "&alefsym;",8501 }, /* alef symbol */
-	{ "&larr;",   8592 }, /* left arrow */
-	{ "&uarr;",   8593 }, /* up arrow */
-	{ "&rarr;",   8594 }, /* right arrow */
-	{ "&darr;",   8595 }, /* down arrow */
-	{ "&harr;",   8596 }, /* left/right arrow */
-	{ "&crarr;",  8629 }, /* down arrow with corner left */
-	{ "&lArr;",   8656 }, /* left double arrow */
-	{ "&uArr;",   8657 }, /* up double arrow */
-	{ "&rArr;",   8658 }, /* up double arrow */
-	{ "&dArr;",   8659 }, /* up double arrow */
-	{ "&hArr;",   8660 }, /* up double arrow */
-	{ "&forall;", 8704}, /* for all */
-	{ "&part;",   8706}, /* partial differential */
-	{ "&exist;",  8707}, /* there exists */
-	{ "&empty;",  8709}, /* empty set */
-	{ "&nabla;",  8711}, /* nabla=backwards difference */
-	{ "&isin;",   8712}, /* element of */
-	{ "&notin;",  8713}, /* not an element of */
-	{ "&ni;",     8715}, /* contains as member */
-	{ "&prod;",   8719}, /* n-ary product */
-	{ "&sum;",    8721}, /* n-ary summation */
-	{ "&minus;",  8722}, /* minuss sign */
-	{ "&lowast;", 8727}, /* asterisk operator */
-	{ "&radic;",  8730}, /* square root */
-	{ "&prop;",   8733}, /* proportional to */
-	{ "&infin;",  8734}, /* infinity */
-	{ "&ang;",    8736}, /* angle */
-	{ "&and;",    8743}, /* logical and */
-	{ "&or;",     8744}, /* logical or */
-	{ "&cap;",    8745}, /* intersection */
-	{ "&cup;",    8746}, /* union */
-	{ "&int;",    8747}, /* integral */
-	{ "&there4;", 8756}, /* therefore */
-	{ "&sim;",    8764}, /* tilde operator */
-	{ "&cong;",   8773}, /* approximately equal to */
-	{ "&asymp;",  8776}, /* asymptotic to */
-	{ "&ne;",     8800}, /* not equal to */
-	{ "&equiv;",  8801}, /* identical to */
-	{ "&le;",     8804}, /* less-than or equal to */
-	{ "&ge;",     8805}, /* greater-than or equal to */
-	{ "&sub;",    8834}, /* subset of */
-	{ "&sup;",    8835}, /* superset of */
-	{ "&nsub;",   8836}, /* not a subset of */
-	{ "&sube;",   8838}, /* subset of or equal to */
-	{ "&supe;",   8839}, /* superset of or equal to */
-	{ "&oplus;",  8853}, /* circled plus = direct sum */
-	{ "&otimes;", 8855}, /* circled times = vec prod */
-	{ "&perp;",   8869}, /* perpendicular */
-	{ "&sdot;",   8901}, /* dot operator */
-	{ "&lceil;",  8968}, /* left ceiling */
-	{ "&rceil;",  8969}, /* right ceiling */
-	{ "&lfloor;", 8970}, /* left floor */
-	{ "&rfloor;", 8971}, /* right floor */
-	{ "&lang;",   9001}, /* left angle bracket */
-	{ "&rang;",   9002}, /* right angle bracket */
-	{ "&loz;",    9674}, /* lozenge */
-	{ "&spades;", 9824}, /* spades */
-	{ "&clubs;",  9827}, /* clubs */
-	{ "&hearts;", 9829}, /* hearts */
-	{ "&diams;",  9830}, /* diamonds */
-	/* Latin-1 */
-	{ "&nbsp;",    32 },  /* non-breaking space */
-	{ "&iexcl;",  161 },  /* inverted exclamation mark */
-	{ "&cent;",   162 },  /* cent sign */
-	{ "&pound;",  163 },  /* pound sign */
-	{ "&curren;", 164 },  /* currency sign */
-	{ "&yen;",    165 },  /* yen sign */
-	{ "&brvbar;", 166 },  /* broken vertical bar */
-	{ "&sect;",   167 },  /* section sign */
-	{ "&uml;",    168 },  /* diaeresis - spacing diaeresis */
-	{ "&copy;",   169 },  /* copyright sign */
-	{ "&ordf;",   170 },  /* feminine ordinal indicator */
-	{ "&laquo;",  171 },  /* left-pointing guillemet */
-	{ "&not;",    172 },  /* not sign */
-	{ "&shy;",    173 },  /* soft (discretionary) hyphen */
-	{ "&reg;",    174 },  /* registered sign */
-	{ "&macr;",   175 },  /* macron = overline */
-	{ "&deg;",    176 },  /* degree sign */
-	{ "&plusmn;", 177 },  /* plus-minus sign */
-	{ "&sup2;",   178 },  /* superscript two */
-	{ "&sup3;",   179 },  /* superscript three */
-	{ "&acute;",  180 },  /* acute accent = spacing acute */
-	{ "&micro;",  181 },  /* micro sign */
-	{ "&para;",   182 },  /* pilcrow (paragraph) sign */
-	{ "&middot;", 183 },  /* middle dot (georgian comma) */
-	{ "&cedil;",  184 },  /* cedilla = spacing cedilla */
-	{ "&sup1;",   185 },  /* superscript one */
-	{ "&ordm;",   186 },  /* masculine ordinal indicator */
-	{ "&raquo;",  187 },  /* right pointing guillemet */
-	{ "&frac14;", 188 },  /* 1/4 */
-	{ "&frac12;", 189 },  /* 1/2 */
-	{ "&frac34;", 190 },  /* 3/4 */
-	{ "&iquest;", 191 },  /* inverted question mark */
-	{ "&Agrave;", 192 },  /* cap A with grave */
-	{ "&Aacute;", 193 },  /* cap A with acute */
-	{ "&Acirc;",  194 },  /* cap A with circumflex */
-	{ "&Atilde;", 195 },  /* cap A with tilde */
-	{ "&Auml;",   196 },  /* cap A with diaeresis */
-	{ "&Aring;",  197 },  /* cap A with ring */
-	{ "&AElig;",  198 },  /* cap AE ligature */
-	{ "&Ccedil;", 199 },  /* cap C with cedilla */
-	{ "&Egrave;", 200 },  /* cap E with grave */
-	{ "&Eacute;", 201 },  /* cap E with acute */
-	{ "&Ecirc;",  202 },  /* cap E with circumflex */
-	{ "&Euml;",   203 },  /* cap E with diaeresis */
-	{ "&Igrave;", 204 },  /* cap I with grave */
-	{ "&Iacute;", 205 },  /* cap I with acute */
-	{ "&Icirc;",  206 },  /* cap I with circumflex */
-	{ "&Iuml;",   207 },  /* cap I with diaeresis */
-	{ "&ETH;",    208 },  /* cap letter ETH */
-	{ "&Ntilde;", 209 },  /* cap N with tilde */
-	{ "&Ograve;", 210 },  /* cap O with grave */
-	{ "&Oacute;", 211 },  /* cap O with acute */
-	{ "&Ocirc;",  212 },  /* cap O with circumflex */
-	{ "&Otilde;", 213 },  /* cap O with tilde */
-	{ "&Ouml;",   214 },  /* cap O with diaeresis */
-	{ "&times;",  215 },  /* multiplication sign */
-	{ "&Oslash;", 216 },  /* cap O with stroke */
-	{ "&Ugrave;", 217 },  /* cap U with grave */
-	{ "&Uacute;", 218 },  /* cap U with acute */
-	{ "&Ucirc;",  219 },  /* cap U with circumflex */
-	{ "&Uuml;",   220 },  /* cap U with diaeresis */
-	{ "&Yacute;", 221 },  /* cap Y with acute */
-	{ "&THORN;",  222 },  /* cap letter THORN */
-	{ "&szlig;",  223 },  /* small sharp s = ess-zed */
-	{ "&agrave;", 224 },  /* small a with grave */
-	{ "&aacute;", 225 },  /* small a with acute */
-	{ "&acirc;",  226 },  /* small a with cirucmflex */
-	{ "&atilde;", 227 },  /* small a with tilde */
-	{ "&amul;",   228 },  /* small a with diaeresis */
-	{ "&aring;",  229 },  /* small a with ring */
-	{ "&aelig;",  230 },  /* small ligature ae */
-	{ "&ccedil;", 231 },  /* small c with cedilla */
-	{ "&egrave;", 232 },  /* small e with grave */
-	{ "&eacute;", 233 },  /* small e with acute */
-	{ "&ecirc;",  234 },  /* small e with circumflex */
-	{ "&emul;",   235 },  /* small e with diaeresis */
-	{ "&igrave;", 236 },  /* small i with grave */
-	{ "&iacute;", 237 },  /* small i with acute */
-	{ "&icirc;",  238 },  /* small i with circumflex */
-	{ "&iuml;",   239 },  /* small i with diaeresis */
-	{ "&eth;",    240 },  /* latin small letter eth */
-	{ "&ntilde;", 241 },  /* small n with tilde */
-	{ "&ograve;", 242 },  /* small o with grave */
-	{ "&oacute;", 243 },  /* small o with acute */
-	{ "&ocirc;",  244 },  /* small o with circumflex */
-	{ "&otilde;", 245 },  /* small o with tilde */
-	{ "&ouml;",   246 },  /* small o with diaeresis */
-	{ "&divide;", 247 },  /* division sign */
-	{ "&oslash;", 248 },  /* small o with slash */
-	{ "&ugrave;", 249 },  /* small u with grave */
-	{ "&uacute;", 250 },  /* small u with acute */
-	{ "&ucirc;",  251 },  /* small u with circumflex */
-	{ "&uuml;",   252 },  /* small u with diaeresis */
-	{ "&yacute;", 253 },  /* small y with acute */
-	{ "&thorn;",  254 },  /* latin small letter thorn */
-	{ "&yuml;",   255 },  /* small y with diaeresis */
+static entities html_entities[] = {
+	{ "AElig",                              198 },  /* cap AE ligature */
+	{ "AMP",                                 38 },  /* ampersand */
+	{ "Aacute",                             193 },  /* cap A with acute */
+	{ "Abreve",                             258 },  /* latin capital letter a with breve */
+	{ "Acirc",                              194 },  /* cap A with circumflex */
+	{ "Acy",                               1040 },  /* cyrillic capital letter a */
+	{ "Afr",                             120068 },  /* mathematical fraktur capital a */
+	{ "Agrave",                             192 },  /* cap A with grave */
+	{ "Alpha",                              913 },  /* capital alpha */
+	{ "Amacr",                              256 },  /* latin capital letter a with macron */
+	{ "And",                              10835 },  /* double logical and */
+	{ "Aogon",                              260 },  /* latin capital letter a with ogonek */
+	{ "Aopf",                            120120 },  /* mathematical double-struck capital a */
+	{ "ApplyFunction",                     8289 },  /* function application */
+	{ "Aring",                              197 },  /* cap A with ring */
+	{ "Ascr",                            119964 },  /* mathematical script capital a */
+	{ "Assign",                            8788 },  /* colon equals */
+	{ "Atilde",                             195 },  /* cap A with tilde */
+	{ "Auml",                               196 },  /* cap A with diaeresis */
+	{ "Backslash",                         8726 },  /* set minus */
+	{ "Barv",                             10983 },  /* short down tack with overbar */
+	{ "Barwed",                            8966 },  /* perspective */
+	{ "Bcy",                               1041 },  /* cyrillic capital letter be */
+	{ "Because",                           8757 },  /* because */
+	{ "Bernoullis",                        8492 },  /* script capital b */
+	{ "Beta",                               914 },  /* capital beta */
+	{ "Bfr",                             120069 },  /* mathematical fraktur capital b */
+	{ "Bopf",                            120121 },  /* mathematical double-struck capital b */
+	{ "Breve",                              728 },  /* breve */
+	{ "Bscr",                              8492 },  /* script capital b */
+	{ "Bumpeq",                            8782 },  /* geometrically equivalent to */
+	{ "CHcy",                              1063 },  /* cyrillic capital letter che */
+	{ "COPY",                               169 },  /* copyright sign */
+	{ "Cacute",                             262 },  /* latin capital letter c with acute */
+	{ "Cap",                               8914 },  /* double intersection */
+	{ "CapitalDifferentialD",              8517 },  /* double-struck italic capital d */
+	{ "Cayleys",                           8493 },  /* black-letter capital c */
+	{ "Ccaron",                             268 },  /* latin capital letter c with caron */
+	{ "Ccedil",                             199 },  /* cap C with cedilla */
+	{ "Ccirc",                              264 },  /* latin capital letter c with circumflex */
+	{ "Cconint",                           8752 },  /* volume integral */
+	{ "Cdot",                               266 },  /* latin capital letter c with dot above */
+	{ "Cedilla",                            184 },  /* cedilla */
+	{ "CenterDot",                          183 },  /* middle dot */
+	{ "Cfr",                               8493 },  /* black-letter capital c */
+	{ "Chi",                                935 },  /* capital chi */
+	{ "CircleDot",                         8857 },  /* circled dot operator */
+	{ "CircleMinus",                       8854 },  /* circled minus */
+	{ "CirclePlus",                        8853 },  /* circled plus */
+	{ "CircleTimes",                       8855 },  /* circled times */
+	{ "ClockwiseContourIntegral",          8754 },  /* clockwise contour integral */
+	{ "CloseCurlyDoubleQuote",             8221 },  /* right double quotation mark */
+	{ "CloseCurlyQuote",                   8217 },  /* right single quotation mark */
+	{ "Colon",                             8759 },  /* proportion */
+	{ "Colone",                           10868 },  /* double colon equal */
+	{ "Congruent",                         8801 },  /* identical to */
+	{ "Conint",                            8751 },  /* surface integral */
+	{ "ContourIntegral",                   8750 },  /* contour integral */
+	{ "Copf",                              8450 },  /* double-struck capital c */
+	{ "Coproduct",                         8720 },  /* n-ary coproduct */
+	{ "CounterClockwiseContourIntegral",   8755 },  /* anticlockwise contour integral */
+	{ "Cross",                            10799 },  /* vector or cross product */
+	{ "Cscr",                            119966 },  /* mathematical script capital c */
+	{ "Cup",                               8915 },  /* double union */
+	{ "CupCap",                            8781 },  /* equivalent to */
+	{ "DD",                                8517 },  /* double-struck italic capital d */
+	{ "DDotrahd",                         10513 },  /* rightwards arrow with dotted stem */
+	{ "DJcy",                              1026 },  /* cyrillic capital letter dje */
+	{ "DScy",                              1029 },  /* cyrillic capital letter dze */
+	{ "DZcy",                              1039 },  /* cyrillic capital letter dzhe */
+	{ "Dagger",                            8225 },  /* double dagger */
+	{ "Darr",                              8609 },  /* downwards two headed arrow */
+	{ "Dashv",                            10980 },  /* vertical bar double left turnstile */
+	{ "Dcaron",                             270 },  /* latin capital letter d with caron */
+	{ "Dcy",                               1044 },  /* cyrillic capital letter de */
+	{ "Del",                               8711 },  /* nabla */
+	{ "Delta",                              916 },  /* capital delta */
+	{ "Dfr",                             120071 },  /* mathematical fraktur capital d */
+	{ "DiacriticalAcute",                   180 },  /* acute accent */
+	{ "DiacriticalDot",                     729 },  /* dot above */
+	{ "DiacriticalDoubleAcute",             733 },  /* double acute accent */
+	{ "DiacriticalGrave",                    96 },  /* grave accent */
+	{ "DiacriticalTilde",                   732 },  /* small tilde */
+	{ "Diamond",                           8900 },  /* diamond operator */
+	{ "DifferentialD",                     8518 },  /* double-struck italic small d */
+	{ "Dopf",                            120123 },  /* mathematical double-struck capital d */
+	{ "Dot",                                168 },  /* diaeresis */
+	{ "DotDot",                            8412 },  /* combining four dots above */
+	{ "DotEqual",                          8784 },  /* approaches the limit */
+	{ "DoubleContourIntegral",             8751 },  /* surface integral */
+	{ "DoubleDot",                          168 },  /* diaeresis */
+	{ "DoubleDownArrow",                   8659 },  /* downwards double arrow */
+	{ "DoubleLeftArrow",                   8656 },  /* leftwards double arrow */
+	{ "DoubleLeftRightArrow",              8660 },  /* left right double arrow */
+	{ "DoubleLeftTee",                    10980 },  /* vertical bar double left turnstile */
+	{ "DoubleLongLeftArrow",              10232 },  /* long leftwards double arrow */
+	{ "DoubleLongLeftRightArrow",         10234 },  /* long left right double arrow */
+	{ "DoubleLongRightArrow",             10233 },  /* long rightwards double arrow */
+	{ "DoubleRightArrow",                  8658 },  /* rightwards double arrow */
+	{ "DoubleRightTee",                    8872 },  /* true */
+	{ "DoubleUpArrow",                     8657 },  /* upwards double arrow */
+	{ "DoubleUpDownArrow",                 8661 },  /* up down double arrow */
+	{ "DoubleVerticalBar",                 8741 },  /* parallel to */
+	{ "DownArrow",                         8595 },  /* downwards arrow */
+	{ "DownArrowBar",                     10515 },  /* downwards arrow to bar */
+	{ "DownArrowUpArrow",                  8693 },  /* downwards arrow leftwards of upwards arrow */
+	{ "DownBreve",                          785 },  /* combining inverted breve */
+	{ "DownLeftRightVector",              10576 },  /* left barb down right barb down harpoon */
+	{ "DownLeftTeeVector",                10590 },  /* leftwards harpoon with barb down from bar */
+	{ "DownLeftVector",                    8637 },  /* leftwards harpoon with barb downwards */
+	{ "DownLeftVectorBar",                10582 },  /* leftwards harpoon with barb down to bar */
+	{ "DownRightTeeVector",               10591 },  /* rightwards harpoon with barb down from bar */
+	{ "DownRightVector",                   8641 },  /* rightwards harpoon with barb downwards */
+	{ "DownRightVectorBar",               10583 },  /* rightwards harpoon with barb down to bar */
+	{ "DownTee",                           8868 },  /* down tack */
+	{ "DownTeeArrow",                      8615 },  /* downwards arrow from bar */
+	{ "Downarrow",                         8659 },  /* downwards double arrow */
+	{ "Dscr",                            119967 },  /* mathematical script capital d */
+	{ "Dstrok",                             272 },  /* latin capital letter d with stroke */
+	{ "ENG",                                330 },  /* latin capital letter eng */
+	{ "ETH",                                208 },  /* cap letter ETH */
+	{ "Eacute",                             201 },  /* cap E with acute */
+	{ "Ecaron",                             282 },  /* latin capital letter e with caron */
+	{ "Ecirc",                              202 },  /* cap E with circumflex */
+	{ "Ecy",                               1069 },  /* cyrillic capital letter e */
+	{ "Edot",                               278 },  /* latin capital letter e with dot above */
+	{ "Efr",                             120072 },  /* mathematical fraktur capital e */
+	{ "Egrave",                             200 },  /* cap E with grave */
+	{ "Element",                           8712 },  /* element of */
+	{ "Emacr",                              274 },  /* latin capital letter e with macron */
+	{ "EmptySmallSquare",                  9723 },  /* white medium square */
+	{ "EmptyVerySmallSquare",              9643 },  /* white small square */
+	{ "Eogon",                              280 },  /* latin capital letter e with ogonek */
+	{ "Eopf",                            120124 },  /* mathematical double-struck capital e */
+	{ "Epsilon",                            917 },  /* capital epsilon */
+	{ "Equal",                            10869 },  /* two consecutive equals signs */
+	{ "EqualTilde",                        8770 },  /* minus tilde */
+	{ "Equilibrium",                       8652 },  /* rightwards harpoon over leftwards harpoon */
+	{ "Escr",                              8496 },  /* script capital e */
+	{ "Esim",                             10867 },  /* equals sign above tilde operator */
+	{ "Eta",                                919 },  /* capital eta */
+	{ "Euml",                               203 },  /* cap E with diaeresis */
+	{ "Exists",                            8707 },  /* there exists */
+	{ "ExponentialE",                      8519 },  /* double-struck italic small e */
+	{ "Fcy",                               1060 },  /* cyrillic capital letter ef */
+	{ "Ffr",                             120073 },  /* mathematical fraktur capital f */
+	{ "FilledSmallSquare",                 9724 },  /* black medium square */
+	{ "FilledVerySmallSquare",             9642 },  /* black small square */
+	{ "Fopf",                            120125 },  /* mathematical double-struck capital f */
+	{ "ForAll",                            8704 },  /* for all */
+	{ "Fouriertrf",                        8497 },  /* script capital f */
+	{ "Fscr",                              8497 },  /* script capital f */
+	{ "GJcy",                              1027 },  /* cyrillic capital letter gje */
+	{ "GT",                                  62 },  /* greater-than sign */
+	{ "Gamma",                              915 },  /* capital gamma */
+	{ "Gammad",                             988 },  /* greek letter digamma */
+	{ "Gbreve",                             286 },  /* latin capital letter g with breve */
+	{ "Gcedil",                             290 },  /* latin capital letter g with cedilla */
+	{ "Gcirc",                              284 },  /* latin capital letter g with circumflex */
+	{ "Gcy",                               1043 },  /* cyrillic capital letter ghe */
+	{ "Gdot",                               288 },  /* latin capital letter g with dot above */
+	{ "Gfr",                             120074 },  /* mathematical fraktur capital g */
+	{ "Gg",                                8921 },  /* very much greater-than */
+	{ "Gopf",                            120126 },  /* mathematical double-struck capital g */
+	{ "GreaterEqual",                      8805 },  /* greater-than or equal to */
+	{ "GreaterEqualLess",                  8923 },  /* greater-than equal to or less-than */
+	{ "GreaterFullEqual",                  8807 },  /* greater-than over equal to */
+	{ "GreaterGreater",                   10914 },  /* double nested greater-than */
+	{ "GreaterLess",                       8823 },  /* greater-than or less-than */
+	{ "GreaterSlantEqual",                10878 },  /* greater-than or slanted equal to */
+	{ "GreaterTilde",                      8819 },  /* greater-than or equivalent to */
+	{ "Gscr",                            119970 },  /* mathematical script capital g */
+	{ "Gt",                                8811 },  /* much greater-than */
+	{ "HARDcy",                            1066 },  /* cyrillic capital letter hard sign */
+	{ "Hacek",                              711 },  /* caron */
+	{ "Hat",                                 94 },  /* circumflex accent */
+	{ "Hcirc",                              292 },  /* latin capital letter h with circumflex */
+	{ "Hfr",                               8460 },  /* black-letter capital h */
+	{ "HilbertSpace",                      8459 },  /* script capital h */
+	{ "Hopf",                              8461 },  /* double-struck capital h */
+	{ "HorizontalLine",                    9472 },  /* box drawings light horizontal */
+	{ "Hscr",                              8459 },  /* script capital h */
+	{ "Hstrok",                             294 },  /* latin capital letter h with stroke */
+	{ "HumpDownHump",                      8782 },  /* geometrically equivalent to */
+	{ "HumpEqual",                         8783 },  /* difference between */
+	{ "IEcy",                              1045 },  /* cyrillic capital letter ie */
+	{ "IJlig",                              306 },  /* latin capital ligature ij */
+	{ "IOcy",                              1025 },  /* cyrillic capital letter io */
+	{ "Iacute",                             205 },  /* cap I with acute */
+	{ "Icirc",                              206 },  /* cap I with circumflex */
+	{ "Icy",                               1048 },  /* cyrillic capital letter i */
+	{ "Idot",                               304 },  /* latin capital letter i with dot above */
+	{ "Ifr",                               8465 },  /* black-letter capital i */
+	{ "Igrave",                             204 },  /* cap I with grave */
+	{ "Im",                                8465 },  /* black-letter capital i */
+	{ "Imacr",                              298 },  /* latin capital letter i with macron */
+	{ "ImaginaryI",                        8520 },  /* double-struck italic small i */
+	{ "Implies",                           8658 },  /* rightwards double arrow */
+	{ "Int",                               8748 },  /* double integral */
+	{ "Integral",                          8747 },  /* integral */
+	{ "Intersection",                      8898 },  /* n-ary intersection */
+	{ "InvisibleComma",                    8291 },  /* invisible separator */
+	{ "InvisibleTimes",                    8290 },  /* invisible times */
+	{ "Iogon",                              302 },  /* latin capital letter i with ogonek */
+	{ "Iopf",                            120128 },  /* mathematical double-struck capital i */
+	{ "Iota",                               921 },  /* capital iota */
+	{ "Iscr",                              8464 },  /* script capital i */
+	{ "Itilde",                             296 },  /* latin capital letter i with tilde */
+	{ "Iukcy",                             1030 },  /* cyrillic capital letter byelorussian-ukrainian i */
+	{ "Iuml",                               207 },  /* cap I with diaeresis */
+	{ "Jcirc",                              308 },  /* latin capital letter j with circumflex */
+	{ "Jcy",                               1049 },  /* cyrillic capital letter short i */
+	{ "Jfr",                             120077 },  /* mathematical fraktur capital j */
+	{ "Jopf",                            120129 },  /* mathematical double-struck capital j */
+	{ "Jscr",                            119973 },  /* mathematical script capital j */
+	{ "Jsercy",                            1032 },  /* cyrillic capital letter je */
+	{ "Jukcy",                             1028 },  /* cyrillic capital letter ukrainian ie */
+	{ "KHcy",                              1061 },  /* cyrillic capital letter ha */
+	{ "KJcy",                              1036 },  /* cyrillic capital letter kje */
+	{ "Kappa",                              922 },  /* capital kappa */
+	{ "Kcedil",                             310 },  /* latin capital letter k with cedilla */
+	{ "Kcy",                               1050 },  /* cyrillic capital letter ka */
+	{ "Kfr",                             120078 },  /* mathematical fraktur capital k */
+	{ "Kopf",                            120130 },  /* mathematical double-struck capital k */
+	{ "Kscr",                            119974 },  /* mathematical script capital k */
+	{ "LJcy",                              1033 },  /* cyrillic capital letter lje */
+	{ "LT",                                  60 },  /* less-than sign */
+	{ "Lacute",                             313 },  /* latin capital letter l with acute */
+	{ "Lambda",                             923 },  /* capital lambda */
+	{ "Lang",                             10218 },  /* mathematical left double angle bracket */
+	{ "Laplacetrf",                        8466 },  /* script capital l */
+	{ "Larr",                              8606 },  /* leftwards two headed arrow */
+	{ "Lcaron",                             317 },  /* latin capital letter l with caron */
+	{ "Lcedil",                             315 },  /* latin capital letter l with cedilla */
+	{ "Lcy",                               1051 },  /* cyrillic capital letter el */
+	{ "LeftAngleBracket",                 10216 },  /* mathematical left angle bracket */
+	{ "LeftArrow",                         8592 },  /* leftwards arrow */
+	{ "LeftArrowBar",                      8676 },  /* leftwards arrow to bar */
+	{ "LeftArrowRightArrow",               8646 },  /* leftwards arrow over rightwards arrow */
+	{ "LeftCeiling",                       8968 },  /* left ceiling */
+	{ "LeftDoubleBracket",                10214 },  /* mathematical left white square bracket */
+	{ "LeftDownTeeVector",                10593 },  /* downwards harpoon with barb left from bar */
+	{ "LeftDownVector",                    8643 },  /* downwards harpoon with barb leftwards */
+	{ "LeftDownVectorBar",                10585 },  /* downwards harpoon with barb left to bar */
+	{ "LeftFloor",                         8970 },  /* left floor */
+	{ "LeftRightArrow",                    8596 },  /* left right arrow */
+	{ "LeftRightVector",                  10574 },  /* left barb up right barb up harpoon */
+	{ "LeftTee",                           8867 },  /* left tack */
+	{ "LeftTeeArrow",                      8612 },  /* leftwards arrow from bar */
+	{ "LeftTeeVector",                    10586 },  /* leftwards harpoon with barb up from bar */
+	{ "LeftTriangle",                      8882 },  /* normal subgroup of */
+	{ "LeftTriangleBar",                  10703 },  /* left triangle beside vertical bar */
+	{ "LeftTriangleEqual",                 8884 },  /* normal subgroup of or equal to */
+	{ "LeftUpDownVector",                 10577 },  /* up barb left down barb left harpoon */
+	{ "LeftUpTeeVector",                  10592 },  /* upwards harpoon with barb left from bar */
+	{ "LeftUpVector",                      8639 },  /* upwards harpoon with barb leftwards */
+	{ "LeftUpVectorBar",                  10584 },  /* upwards harpoon with barb left to bar */
+	{ "LeftVector",                        8636 },  /* leftwards harpoon with barb upwards */
+	{ "LeftVectorBar",                    10578 },  /* leftwards harpoon with barb up to bar */
+	{ "Leftarrow",                         8656 },  /* leftwards double arrow */
+	{ "Leftrightarrow",                    8660 },  /* left right double arrow */
+	{ "LessEqualGreater",                  8922 },  /* less-than equal to or greater-than */
+	{ "LessFullEqual",                     8806 },  /* less-than over equal to */
+	{ "LessGreater",                       8822 },  /* less-than or greater-than */
+	{ "LessLess",                         10913 },  /* double nested less-than */
+	{ "LessSlantEqual",                   10877 },  /* less-than or slanted equal to */
+	{ "LessTilde",                         8818 },  /* less-than or equivalent to */
+	{ "Lfr",                             120079 },  /* mathematical fraktur capital l */
+	{ "Ll",                                8920 },  /* very much less-than */
+	{ "Lleftarrow",                        8666 },  /* leftwards triple arrow */
+	{ "Lmidot",                             319 },  /* latin capital letter l with middle dot */
+	{ "LongLeftArrow",                    10229 },  /* long leftwards arrow */
+	{ "LongLeftRightArrow",               10231 },  /* long left right arrow */
+	{ "LongRightArrow",                   10230 },  /* long rightwards arrow */
+	{ "Longleftarrow",                    10232 },  /* long leftwards double arrow */
+	{ "Longleftrightarrow",               10234 },  /* long left right double arrow */
+	{ "Longrightarrow",                   10233 },  /* long rightwards double arrow */
+	{ "Lopf",                            120131 },  /* mathematical double-struck capital l */
+	{ "LowerLeftArrow",                    8601 },  /* south west arrow */
+	{ "LowerRightArrow",                   8600 },  /* south east arrow */
+	{ "Lscr",                              8466 },  /* script capital l */
+	{ "Lsh",                               8624 },  /* upwards arrow with tip leftwards */
+	{ "Lstrok",                             321 },  /* latin capital letter l with stroke */
+	{ "Lt",                                8810 },  /* much less-than */
+	{ "Map",                              10501 },  /* rightwards two-headed arrow from bar */
+	{ "Mcy",                               1052 },  /* cyrillic capital letter em */
+	{ "MediumSpace",                       8287 },  /* medium mathematical space */
+	{ "Mellintrf",                         8499 },  /* script capital m */
+	{ "Mfr",                             120080 },  /* mathematical fraktur capital m */
+	{ "MinusPlus",                         8723 },  /* minus-or-plus sign */
+	{ "Mopf",                            120132 },  /* mathematical double-struck capital m */
+	{ "Mscr",                              8499 },  /* script capital m */
+	{ "Mu",                                 924 },  /* capital mu */
+	{ "NJcy",                              1034 },  /* cyrillic capital letter nje */
+	{ "Nacute",                             323 },  /* latin capital letter n with acute */
+	{ "Ncaron",                             327 },  /* latin capital letter n with caron */
+	{ "Ncedil",                             325 },  /* latin capital letter n with cedilla */
+	{ "Ncy",                               1053 },  /* cyrillic capital letter en */
+	{ "NegativeMediumSpace",               8203 },  /* zero width space */
+	{ "NegativeThickSpace",                8203 },  /* zero width space */
+	{ "NegativeThinSpace",                 8203 },  /* zero width space */
+	{ "NegativeVeryThinSpace",             8203 },  /* zero width space */
+	{ "NestedGreaterGreater",              8811 },  /* much greater-than */
+	{ "NestedLessLess",                    8810 },  /* much less-than */
+	{ "NewLine",                             10 },  /* line feed */
+	{ "Nfr",                             120081 },  /* mathematical fraktur capital n */
+	{ "NoBreak",                           8288 },  /* word joiner */
+	{ "NonBreakingSpace",                   160 },  /* no-break space */
+	{ "Nopf",                              8469 },  /* double-struck capital n */
+	{ "Not",                              10988 },  /* double stroke not sign */
+	{ "NotCongruent",                      8802 },  /* not identical to */
+	{ "NotCupCap",                         8813 },  /* not equivalent to */
+	{ "NotDoubleVerticalBar",              8742 },  /* not parallel to */
+	{ "NotElement",                        8713 },  /* not an element of */
+	{ "NotEqual",                          8800 },  /* not equal to */
+	{ "NotExists",                         8708 },  /* there does not exist */
+	{ "NotGreater",                        8815 },  /* not greater-than */
+	{ "NotGreaterEqual",                   8817 },  /* neither greater-than nor equal to */
+	{ "NotGreaterLess",                    8825 },  /* neither greater-than nor less-than */
+	{ "NotGreaterTilde",                   8821 },  /* neither greater-than nor equivalent to */
+	{ "NotLeftTriangle",                   8938 },  /* not normal subgroup of */
+	{ "NotLeftTriangleEqual",              8940 },  /* not normal subgroup of or equal to */
+	{ "NotLess",                           8814 },  /* not less-than */
+	{ "NotLessEqual",                      8816 },  /* neither less-than nor equal to */
+	{ "NotLessGreater",                    8824 },  /* neither less-than nor greater-than */
+	{ "NotLessTilde",                      8820 },  /* neither less-than nor equivalent to */
+	{ "NotPrecedes",                       8832 },  /* does not precede */
+	{ "NotPrecedesSlantEqual",             8928 },  /* does not precede or equal */
+	{ "NotReverseElement",                 8716 },  /* does not contain as member */
+	{ "NotRightTriangle",                  8939 },  /* does not contain as normal subgroup */
+	{ "NotRightTriangleEqual",             8941 },  /* does not contain as normal subgroup or equal */
+	{ "NotSquareSubsetEqual",              8930 },  /* not square image of or equal to */
+	{ "NotSquareSupersetEqual",            8931 },  /* not square original of or equal to */
+	{ "NotSubsetEqual",                    8840 },  /* neither a subset of nor equal to */
+	{ "NotSucceeds",                       8833 },  /* does not succeed */
+	{ "NotSucceedsSlantEqual",             8929 },  /* does not succeed or equal */
+	{ "NotSupersetEqual",                  8841 },  /* neither a superset of nor equal to */
+	{ "NotTilde",                          8769 },  /* not tilde */
+	{ "NotTildeEqual",                     8772 },  /* not asymptotically equal to */
+	{ "NotTildeFullEqual",                 8775 },  /* neither approximately nor actually equal to */
+	{ "NotTildeTilde",                     8777 },  /* not almost equal to */
+	{ "NotVerticalBar",                    8740 },  /* does not divide */
+	{ "Nscr",                            119977 },  /* mathematical script capital n */
+	{ "Ntilde",                             209 },  /* cap N with tilde */
+	{ "Nu",                                 925 },  /* capital nu */
+	{ "OElig",                              338 },  /* Latin cap ligature OE */
+	{ "Oacute",                             211 },  /* cap O with acute */
+	{ "Ocirc",                              212 },  /* cap O with circumflex */
+	{ "Ocy",                               1054 },  /* cyrillic capital letter o */
+	{ "Odblac",                             336 },  /* latin capital letter o with double acute */
+	{ "Ofr",                             120082 },  /* mathematical fraktur capital o */
+	{ "Ograve",                             210 },  /* cap O with grave */
+	{ "Omacr",                              332 },  /* latin capital letter o with macron */
+	{ "Omega",                              937 },  /* capital omega */
+	{ "Omicron",                            927 },  /* capital omicron */
+	{ "Oopf",                            120134 },  /* mathematical double-struck capital o */
+	{ "OpenCurlyDoubleQuote",              8220 },  /* left double quotation mark */
+	{ "OpenCurlyQuote",                    8216 },  /* left single quotation mark */
+	{ "Or",                               10836 },  /* double logical or */
+	{ "Oscr",                            119978 },  /* mathematical script capital o */
+	{ "Oslash",                             216 },  /* cap O with stroke */
+	{ "Otilde",                             213 },  /* cap O with tilde */
+	{ "Otimes",                           10807 },  /* multiplication sign in double circle */
+	{ "Ouml",                               214 },  /* cap O with diaeresis */
+	{ "OverBar",                           8254 },  /* overline */
+	{ "OverBrace",                         9182 },  /* top curly bracket */
+	{ "OverBracket",                       9140 },  /* top square bracket */
+	{ "OverParenthesis",                   9180 },  /* top parenthesis */
+	{ "PartialD",                          8706 },  /* partial differential */
+	{ "Pcy",                               1055 },  /* cyrillic capital letter pe */
+	{ "Pfr",                             120083 },  /* mathematical fraktur capital p */
+	{ "Phi",                                934 },  /* capital phi */
+	{ "Pi",                                 928 },  /* capital pi */
+	{ "PlusMinus",                          177 },  /* plus-minus sign */
+	{ "Poincareplane",                     8460 },  /* black-letter capital h */
+	{ "Popf",                              8473 },  /* double-struck capital p */
+	{ "Pr",                               10939 },  /* double precedes */
+	{ "Precedes",                          8826 },  /* precedes */
+	{ "PrecedesEqual",                    10927 },  /* precedes above single-line equals sign */
+	{ "PrecedesSlantEqual",                8828 },  /* precedes or equal to */
+	{ "PrecedesTilde",                     8830 },  /* precedes or equivalent to */
+	{ "Prime",                             8243 },  /* double prime */
+	{ "Product",                           8719 },  /* n-ary product */
+	{ "Proportion",                        8759 },  /* proportion */
+	{ "Proportional",                      8733 },  /* proportional to */
+	{ "Pscr",                            119979 },  /* mathematical script capital p */
+	{ "Psi",                                936 },  /* capital psi */
+	{ "QUOT",                                34 },  /* quotation mark */
+	{ "Qfr",                             120084 },  /* mathematical fraktur capital q */
+	{ "Qopf",                              8474 },  /* double-struck capital q */
+	{ "Qscr",                            119980 },  /* mathematical script capital q */
+	{ "RBarr",                            10512 },  /* rightwards two-headed triple dash arrow */
+	{ "REG",                                174 },  /* registered sign */
+	{ "Racute",                             340 },  /* latin capital letter r with acute */
+	{ "Rang",                             10219 },  /* mathematical right double angle bracket */
+	{ "Rarr",                              8608 },  /* rightwards two headed arrow */
+	{ "Rarrtl",                           10518 },  /* rightwards two-headed arrow with tail */
+	{ "Rcaron",                             344 },  /* latin capital letter r with caron */
+	{ "Rcedil",                             342 },  /* latin capital letter r with cedilla */
+	{ "Rcy",                               1056 },  /* cyrillic capital letter er */
+	{ "Re",                                8476 },  /* black-letter capital r */
+	{ "ReverseElement",                    8715 },  /* contains as member */
+	{ "ReverseEquilibrium",                8651 },  /* leftwards harpoon over rightwards harpoon */
+	{ "ReverseUpEquilibrium",             10607 },  /* downwards harpoon with barb left beside upwards harpoon with barb right */
+	{ "Rfr",                               8476 },  /* black-letter capital r */
+	{ "Rho",                                929 },  /* capital rho */
+	{ "RightAngleBracket",                10217 },  /* mathematical right angle bracket */
+	{ "RightArrow",                        8594 },  /* rightwards arrow */
+	{ "RightArrowBar",                     8677 },  /* rightwards arrow to bar */
+	{ "RightArrowLeftArrow",               8644 },  /* rightwards arrow over leftwards arrow */
+	{ "RightCeiling",                      8969 },  /* right ceiling */
+	{ "RightDoubleBracket",               10215 },  /* mathematical right white square bracket */
+	{ "RightDownTeeVector",               10589 },  /* downwards harpoon with barb right from bar */
+	{ "RightDownVector",                   8642 },  /* downwards harpoon with barb rightwards */
+	{ "RightDownVectorBar",               10581 },  /* downwards harpoon with barb right to bar */
+	{ "RightFloor",                        8971 },  /* right floor */
+	{ "RightTee",                          8866 },  /* right tack */
+	{ "RightTeeArrow",                     8614 },  /* rightwards arrow from bar */
+	{ "RightTeeVector",                   10587 },  /* rightwards harpoon with barb up from bar */
+	{ "RightTriangle",                     8883 },  /* contains as normal subgroup */
+	{ "RightTriangleBar",                 10704 },  /* vertical bar beside right triangle */
+	{ "RightTriangleEqual",                8885 },  /* contains as normal subgroup or equal to */
+	{ "RightUpDownVector",                10575 },  /* up barb right down barb right harpoon */
+	{ "RightUpTeeVector",                 10588 },  /* upwards harpoon with barb right from bar */
+	{ "RightUpVector",                     8638 },  /* upwards harpoon with barb rightwards */
+	{ "RightUpVectorBar",                 10580 },  /* upwards harpoon with barb right to bar */
+	{ "RightVector",                       8640 },  /* rightwards harpoon with barb upwards */
+	{ "RightVectorBar",                   10579 },  /* rightwards harpoon with barb up to bar */
+	{ "Rightarrow",                        8658 },  /* rightwards double arrow */
+	{ "Ropf",                              8477 },  /* double-struck capital r */
+	{ "RoundImplies",                     10608 },  /* right double arrow with rounded head */
+	{ "Rrightarrow",                       8667 },  /* rightwards triple arrow */
+	{ "Rscr",                              8475 },  /* script capital r */
+	{ "Rsh",                               8625 },  /* upwards arrow with tip rightwards */
+	{ "RuleDelayed",                      10740 },  /* rule-delayed */
+	{ "SHCHcy",                            1065 },  /* cyrillic capital letter shcha */
+	{ "SHcy",                              1064 },  /* cyrillic capital letter sha */
+	{ "SOFTcy",                            1068 },  /* cyrillic capital letter soft sign */
+	{ "Sacute",                             346 },  /* latin capital letter s with acute */
+	{ "Sc",                               10940 },  /* double succeeds */
+	{ "Scaron",                             352 },  /* Latin cap S with caron */
+	{ "Scedil",                             350 },  /* latin capital letter s with cedilla */
+	{ "Scirc",                              348 },  /* latin capital letter s with circumflex */
+	{ "Scy",                               1057 },  /* cyrillic capital letter es */
+	{ "Sfr",                             120086 },  /* mathematical fraktur capital s */
+	{ "ShortDownArrow",                    8595 },  /* downwards arrow */
+	{ "ShortLeftArrow",                    8592 },  /* leftwards arrow */
+	{ "ShortRightArrow",                   8594 },  /* rightwards arrow */
+	{ "ShortUpArrow",                      8593 },  /* upwards arrow */
+	{ "Sigma",                              931 },  /* capital sigma */
+	{ "SmallCircle",                       8728 },  /* ring operator */
+	{ "Sopf",                            120138 },  /* mathematical double-struck capital s */
+	{ "Sqrt",                              8730 },  /* square root */
+	{ "Square",                            9633 },  /* white square */
+	{ "SquareIntersection",                8851 },  /* square cap */
+	{ "SquareSubset",                      8847 },  /* square image of */
+	{ "SquareSubsetEqual",                 8849 },  /* square image of or equal to */
+	{ "SquareSuperset",                    8848 },  /* square original of */
+	{ "SquareSupersetEqual",               8850 },  /* square original of or equal to */
+	{ "SquareUnion",                       8852 },  /* square cup */
+	{ "Sscr",                            119982 },  /* mathematical script capital s */
+	{ "Star",                              8902 },  /* star operator */
+	{ "Sub",                               8912 },  /* double subset */
+	{ "Subset",                            8912 },  /* double subset */
+	{ "SubsetEqual",                       8838 },  /* subset of or equal to */
+	{ "Succeeds",                          8827 },  /* succeeds */
+	{ "SucceedsEqual",                    10928 },  /* succeeds above single-line equals sign */
+	{ "SucceedsSlantEqual",                8829 },  /* succeeds or equal to */
+	{ "SucceedsTilde",                     8831 },  /* succeeds or equivalent to */
+	{ "SuchThat",                          8715 },  /* contains as member */
+	{ "Sum",                               8721 },  /* n-ary summation */
+	{ "Sup",                               8913 },  /* double superset */
+	{ "Superset",                          8835 },  /* superset of */
+	{ "SupersetEqual",                     8839 },  /* superset of or equal to */
+	{ "Supset",                            8913 },  /* double superset */
+	{ "THORN",                              222 },  /* cap letter THORN */
+	{ "TRADE",                             8482 },  /* trade mark sign */
+	{ "TSHcy",                             1035 },  /* cyrillic capital letter tshe */
+	{ "TScy",                              1062 },  /* cyrillic capital letter tse */
+	{ "Tab",                                  9 },  /* character tabulation */
+	{ "Tau",                                932 },  /* capital tau */
+	{ "Tcaron",                             356 },  /* latin capital letter t with caron */
+	{ "Tcedil",                             354 },  /* latin capital letter t with cedilla */
+	{ "Tcy",                               1058 },  /* cyrillic capital letter te */
+	{ "Tfr",                             120087 },  /* mathematical fraktur capital t */
+	{ "Therefore",                         8756 },  /* therefore */
+	{ "Theta",                              920 },  /* capital theta */
+	{ "ThinSpace",                         8201 },  /* thin space */
+	{ "Tilde",                             8764 },  /* tilde operator */
+	{ "TildeEqual",                        8771 },  /* asymptotically equal to */
+	{ "TildeFullEqual",                    8773 },  /* approximately equal to */
+	{ "TildeTilde",                        8776 },  /* almost equal to */
+	{ "Topf",                            120139 },  /* mathematical double-struck capital t */
+	{ "TripleDot",                         8411 },  /* combining three dots above */
+	{ "Tscr",                            119983 },  /* mathematical script capital t */
+	{ "Tstrok",                             358 },  /* latin capital letter t with stroke */
+	{ "Uacute",                             218 },  /* cap U with acute */
+	{ "Uarr",                              8607 },  /* upwards two headed arrow */
+	{ "Uarrocir",                         10569 },  /* upwards two-headed arrow from small circle */
+	{ "Ubrcy",                             1038 },  /* cyrillic capital letter short u */
+	{ "Ubreve",                             364 },  /* latin capital letter u with breve */
+	{ "Ucirc",                              219 },  /* cap U with circumflex */
+	{ "Ucy",                               1059 },  /* cyrillic capital letter u */
+	{ "Udblac",                             368 },  /* latin capital letter u with double acute */
+	{ "Ufr",                             120088 },  /* mathematical fraktur capital u */
+	{ "Ugrave",                             217 },  /* cap U with grave */
+	{ "Umacr",                              362 },  /* latin capital letter u with macron */
+	{ "UnderBar",                            95 },  /* low line */
+	{ "UnderBrace",                        9183 },  /* bottom curly bracket */
+	{ "UnderBracket",                      9141 },  /* bottom square bracket */
+	{ "UnderParenthesis",                  9181 },  /* bottom parenthesis */
+	{ "Union",                             8899 },  /* n-ary union */
+	{ "UnionPlus",                         8846 },  /* multiset union */
+	{ "Uogon",                              370 },  /* latin capital letter u with ogonek */
+	{ "Uopf",                            120140 },  /* mathematical double-struck capital u */
+	{ "UpArrow",                           8593 },  /* upwards arrow */
+	{ "UpArrowBar",                       10514 },  /* upwards arrow to bar */
+	{ "UpArrowDownArrow",                  8645 },  /* upwards arrow leftwards of downwards arrow */
+	{ "UpDownArrow",                       8597 },  /* up down arrow */
+	{ "UpEquilibrium",                    10606 },  /* upwards harpoon with barb left beside downwards harpoon with barb right */
+	{ "UpTee",                             8869 },  /* up tack */
+	{ "UpTeeArrow",                        8613 },  /* upwards arrow from bar */
+	{ "Uparrow",                           8657 },  /* upwards double arrow */
+	{ "Updownarrow",                       8661 },  /* up down double arrow */
+	{ "UpperLeftArrow",                    8598 },  /* north west arrow */
+	{ "UpperRightArrow",                   8599 },  /* north east arrow */
+	{ "Upsi",                               978 },  /* greek upsilon with hook symbol */
+	{ "Upsilon",                            933 },  /* capital upsilon */
+	{ "Uring",                              366 },  /* latin capital letter u with ring above */
+	{ "Uscr",                            119984 },  /* mathematical script capital u */
+	{ "Utilde",                             360 },  /* latin capital letter u with tilde */
+	{ "Uuml",                               220 },  /* cap U with diaeresis */
+	{ "VDash",                             8875 },  /* double vertical bar double right turnstile */
+	{ "Vbar",                             10987 },  /* double up tack */
+	{ "Vcy",                               1042 },  /* cyrillic capital letter ve */
+	{ "Vdash",                             8873 },  /* forces */
+	{ "Vdashl",                           10982 },  /* long dash from left member of double vertical */
+	{ "Vee",                               8897 },  /* n-ary logical or */
+	{ "Verbar",                            8214 },  /* double vertical line */
+	{ "Vert",                              8214 },  /* double vertical line */
+	{ "VerticalBar",                       8739 },  /* divides */
+	{ "VerticalLine",                       124 },  /* vertical line */
+	{ "VerticalSeparator",                10072 },  /* light vertical bar */
+	{ "VerticalTilde",                     8768 },  /* wreath product */
+	{ "VeryThinSpace",                     8202 },  /* hair space */
+	{ "Vfr",                             120089 },  /* mathematical fraktur capital v */
+	{ "Vopf",                            120141 },  /* mathematical double-struck capital v */
+	{ "Vscr",                            119985 },  /* mathematical script capital v */
+	{ "Vvdash",                            8874 },  /* triple vertical bar right turnstile */
+	{ "Wcirc",                              372 },  /* latin capital letter w with circumflex */
+	{ "Wedge",                             8896 },  /* n-ary logical and */
+	{ "Wfr",                             120090 },  /* mathematical fraktur capital w */
+	{ "Wopf",                            120142 },  /* mathematical double-struck capital w */
+	{ "Wscr",                            119986 },  /* mathematical script capital w */
+	{ "Xfr",                             120091 },  /* mathematical fraktur capital x */
+	{ "Xi",                                 926 },  /* capital xi */
+	{ "Xopf",                            120143 },  /* mathematical double-struck capital x */
+	{ "Xscr",                            119987 },  /* mathematical script capital x */
+	{ "YAcy",                              1071 },  /* cyrillic capital letter ya */
+	{ "YIcy",                              1031 },  /* cyrillic capital letter yi */
+	{ "YUcy",                              1070 },  /* cyrillic capital letter yu */
+	{ "Yacute",                             221 },  /* cap Y with acute */
+	{ "Ycirc",                              374 },  /* latin capital letter y with circumflex */
+	{ "Ycy",                               1067 },  /* cyrillic capital letter yeru */
+	{ "Yfr",                             120092 },  /* mathematical fraktur capital y */
+	{ "Yopf",                            120144 },  /* mathematical double-struck capital y */
+	{ "Yscr",                            119988 },  /* mathematical script capital y */
+	{ "Yuml",                               376 },  /* Latin cap y with diaeresis */
+	{ "ZHcy",                              1046 },  /* cyrillic capital letter zhe */
+	{ "Zacute",                             377 },  /* latin capital letter z with acute */
+	{ "Zcaron",                             381 },  /* latin capital letter z with caron */
+	{ "Zcy",                               1047 },  /* cyrillic capital letter ze */
+	{ "Zdot",                               379 },  /* latin capital letter z with dot above */
+	{ "ZeroWidthSpace",                    8203 },  /* zero width space */
+	{ "Zeta",                               918 },  /* capital zeta */
+	{ "Zfr",                               8488 },  /* black-letter capital z */
+	{ "Zopf",                              8484 },  /* double-struck capital z */
+	{ "Zscr",                            119989 },  /* mathematical script capital z */
+	{ "aacute",                             225 },  /* small a with acute */
+	{ "abreve",                             259 },  /* latin small letter a with breve */
+	{ "ac",                                8766 },  /* inverted lazy s */
+	{ "acd",                               8767 },  /* sine wave */
+	{ "acirc",                              226 },  /* small a with cirucmflex */
+	{ "acute",                              180 },  /* acute accent = spacing acute */
+	{ "acy",                               1072 },  /* cyrillic small letter a */
+	{ "aelig",                              230 },  /* small ligature ae */
+	{ "af",                                8289 },  /* function application */
+	{ "afr",                             120094 },  /* mathematical fraktur small a */
+	{ "agrave",                             224 },  /* small a with grave */
+	{ "alefsym",                           8501 },  /* alef symbol */
+	{ "aleph",                             8501 },  /* alef symbol */
+	{ "alpha",                              945 },  /* small alpha */
+	{ "amacr",                              257 },  /* latin small letter a with macron */
+	{ "amalg",                            10815 },  /* amalgamation or coproduct */
+	{ "amp",                                 38 },  /* ampersand */
+	{ "amul",                               228 },  /* small a with diaeresis */
+	{ "and",                               8743 },  /* logical and */
+	{ "andand",                           10837 },  /* two intersecting logical and */
+	{ "andd",                             10844 },  /* logical and with horizontal dash */
+	{ "andslope",                         10840 },  /* sloping large and */
+	{ "andv",                             10842 },  /* logical and with middle stem */
+	{ "ang",                               8736 },  /* angle */
+	{ "ange",                             10660 },  /* angle with underbar */
+	{ "angle",                             8736 },  /* angle */
+	{ "angmsd",                            8737 },  /* measured angle */
+	{ "angmsdaa",                         10664 },  /* measured angle with open arm ending in arrow pointing up and right */
+	{ "angmsdab",                         10665 },  /* measured angle with open arm ending in arrow pointing up and left */
+	{ "angmsdac",                         10666 },  /* measured angle with open arm ending in arrow pointing down and right */
+	{ "angmsdad",                         10667 },  /* measured angle with open arm ending in arrow pointing down and left */
+	{ "angmsdae",                         10668 },  /* measured angle with open arm ending in arrow pointing right and up */
+	{ "angmsdaf",                         10669 },  /* measured angle with open arm ending in arrow pointing left and up */
+	{ "angmsdag",                         10670 },  /* measured angle with open arm ending in arrow pointing right and down */
+	{ "angmsdah",                         10671 },  /* measured angle with open arm ending in arrow pointing left and down */
+	{ "angrt",                             8735 },  /* right angle */
+	{ "angrtvb",                           8894 },  /* right angle with arc */
+	{ "angrtvbd",                         10653 },  /* measured right angle with dot */
+	{ "angsph",                            8738 },  /* spherical angle */
+	{ "angst",                              197 },  /* latin capital letter a with ring above */
+	{ "angzarr",                           9084 },  /* right angle with downwards zigzag arrow */
+	{ "aogon",                              261 },  /* latin small letter a with ogonek */
+	{ "aopf",                            120146 },  /* mathematical double-struck small a */
+	{ "ap",                                8776 },  /* almost equal to */
+	{ "apE",                              10864 },  /* approximately equal or equal to */
+	{ "apacir",                           10863 },  /* almost equal to with circumflex accent */
+	{ "ape",                               8778 },  /* almost equal or equal to */
+	{ "apid",                              8779 },  /* triple tilde */
+	{ "apos",                                39 },  /* apostrophe (note not defined in HTML) */
+	{ "approx",                            8776 },  /* almost equal to */
+	{ "approxeq",                          8778 },  /* almost equal or equal to */
+	{ "aring",                              229 },  /* small a with ring */
+	{ "ascr",                            119990 },  /* mathematical script small a */
+	{ "ast",                                 42 },  /* asterisk */
+	{ "asymp",                             8776 },  /* asymptotic to */
+	{ "asympeq",                           8781 },  /* equivalent to */
+	{ "atilde",                             227 },  /* small a with tilde */
+	{ "auml",                               228 },  /* latin small letter a with diaeresis */
+	{ "awconint",                          8755 },  /* anticlockwise contour integral */
+	{ "awint",                            10769 },  /* anticlockwise integration */
+	{ "bNot",                             10989 },  /* reversed double stroke not sign */
+	{ "backcong",                          8780 },  /* all equal to */
+	{ "backepsilon",                       1014 },  /* greek reversed lunate epsilon symbol */
+	{ "backprime",                         8245 },  /* reversed prime */
+	{ "backsim",                           8765 },  /* reversed tilde */
+	{ "backsimeq",                         8909 },  /* reversed tilde equals */
+	{ "barvee",                            8893 },  /* nor */
+	{ "barwed",                            8965 },  /* projective */
+	{ "barwedge",                          8965 },  /* projective */
+	{ "bbrk",                              9141 },  /* bottom square bracket */
+	{ "bbrktbrk",                          9142 },  /* bottom square bracket over top square bracket */
+	{ "bcong",                             8780 },  /* all equal to */
+	{ "bcy",                               1073 },  /* cyrillic small letter be */
+	{ "bdquo",                             8222 },  /* double low-9 quot. mark */
+	{ "becaus",                            8757 },  /* because */
+	{ "because",                           8757 },  /* because */
+	{ "bemptyv",                          10672 },  /* reversed empty set */
+	{ "bepsi",                             1014 },  /* greek reversed lunate epsilon symbol */
+	{ "bernou",                            8492 },  /* script capital b */
+	{ "beta",                               946 },  /* small beta */
+	{ "beth",                              8502 },  /* bet symbol */
+	{ "between",                           8812 },  /* between */
+	{ "bfr",                             120095 },  /* mathematical fraktur small b */
+	{ "bigcap",                            8898 },  /* n-ary intersection */
+	{ "bigcirc",                           9711 },  /* large circle */
+	{ "bigcup",                            8899 },  /* n-ary union */
+	{ "bigodot",                          10752 },  /* n-ary circled dot operator */
+	{ "bigoplus",                         10753 },  /* n-ary circled plus operator */
+	{ "bigotimes",                        10754 },  /* n-ary circled times operator */
+	{ "bigsqcup",                         10758 },  /* n-ary square union operator */
+	{ "bigstar",                           9733 },  /* black star */
+	{ "bigtriangledown",                   9661 },  /* white down-pointing triangle */
+	{ "bigtriangleup",                     9651 },  /* white up-pointing triangle */
+	{ "biguplus",                         10756 },  /* n-ary union operator with plus */
+	{ "bigvee",                            8897 },  /* n-ary logical or */
+	{ "bigwedge",                          8896 },  /* n-ary logical and */
+	{ "bkarow",                           10509 },  /* rightwards double dash arrow */
+	{ "blacklozenge",                     10731 },  /* black lozenge */
+	{ "blacksquare",                       9642 },  /* black small square */
+	{ "blacktriangle",                     9652 },  /* black up-pointing small triangle */
+	{ "blacktriangledown",                 9662 },  /* black down-pointing small triangle */
+	{ "blacktriangleleft",                 9666 },  /* black left-pointing small triangle */
+	{ "blacktriangleright",                9656 },  /* black right-pointing small triangle */
+	{ "blank",                             9251 },  /* open box */
+	{ "blk12",                             9618 },  /* medium shade */
+	{ "blk14",                             9617 },  /* light shade */
+	{ "blk34",                             9619 },  /* dark shade */
+	{ "block",                             9608 },  /* full block */
+	{ "bnot",                              8976 },  /* reversed not sign */
+	{ "bopf",                            120147 },  /* mathematical double-struck small b */
+	{ "bot",                               8869 },  /* up tack */
+	{ "bottom",                            8869 },  /* up tack */
+	{ "bowtie",                            8904 },  /* bowtie */
+	{ "boxDL",                             9559 },  /* box drawings double down and left */
+	{ "boxDR",                             9556 },  /* box drawings double down and right */
+	{ "boxDl",                             9558 },  /* box drawings down double and left single */
+	{ "boxDr",                             9555 },  /* box drawings down double and right single */
+	{ "boxH",                              9552 },  /* box drawings double horizontal */
+	{ "boxHD",                             9574 },  /* box drawings double down and horizontal */
+	{ "boxHU",                             9577 },  /* box drawings double up and horizontal */
+	{ "boxHd",                             9572 },  /* box drawings down single and horizontal double */
+	{ "boxHu",                             9575 },  /* box drawings up single and horizontal double */
+	{ "boxUL",                             9565 },  /* box drawings double up and left */
+	{ "boxUR",                             9562 },  /* box drawings double up and right */
+	{ "boxUl",                             9564 },  /* box drawings up double and left single */
+	{ "boxUr",                             9561 },  /* box drawings up double and right single */
+	{ "boxV",                              9553 },  /* box drawings double vertical */
+	{ "boxVH",                             9580 },  /* box drawings double vertical and horizontal */
+	{ "boxVL",                             9571 },  /* box drawings double vertical and left */
+	{ "boxVR",                             9568 },  /* box drawings double vertical and right */
+	{ "boxVh",                             9579 },  /* box drawings vertical double and horizontal single */
+	{ "boxVl",                             9570 },  /* box drawings vertical double and left single */
+	{ "boxVr",                             9567 },  /* box drawings vertical double and right single */
+	{ "boxbox",                           10697 },  /* two joined squares */
+	{ "boxdL",                             9557 },  /* box drawings down single and left double */
+	{ "boxdR",                             9554 },  /* box drawings down single and right double */
+	{ "boxdl",                             9488 },  /* box drawings light down and left */
+	{ "boxdr",                             9484 },  /* box drawings light down and right */
+	{ "boxh",                              9472 },  /* box drawings light horizontal */
+	{ "boxhD",                             9573 },  /* box drawings down double and horizontal single */
+	{ "boxhU",                             9576 },  /* box drawings up double and horizontal single */
+	{ "boxhd",                             9516 },  /* box drawings light down and horizontal */
+	{ "boxhu",                             9524 },  /* box drawings light up and horizontal */
+	{ "boxminus",                          8863 },  /* squared minus */
+	{ "boxplus",                           8862 },  /* squared plus */
+	{ "boxtimes",                          8864 },  /* squared times */
+	{ "boxuL",                             9563 },  /* box drawings up single and left double */
+	{ "boxuR",                             9560 },  /* box drawings up single and right double */
+	{ "boxul",                             9496 },  /* box drawings light up and left */
+	{ "boxur",                             9492 },  /* box drawings light up and right */
+	{ "boxv",                              9474 },  /* box drawings light vertical */
+	{ "boxvH",                             9578 },  /* box drawings vertical single and horizontal double */
+	{ "boxvL",                             9569 },  /* box drawings vertical single and left double */
+	{ "boxvR",                             9566 },  /* box drawings vertical single and right double */
+	{ "boxvh",                             9532 },  /* box drawings light vertical and horizontal */
+	{ "boxvl",                             9508 },  /* box drawings light vertical and left */
+	{ "boxvr",                             9500 },  /* box drawings light vertical and right */
+	{ "bprime",                            8245 },  /* reversed prime */
+	{ "breve",                              728 },  /* breve */
+	{ "brvbar",                             166 },  /* broken vertical bar */
+	{ "bscr",                            119991 },  /* mathematical script small b */
+	{ "bsemi",                             8271 },  /* reversed semicolon */
+	{ "bsim",                              8765 },  /* reversed tilde */
+	{ "bsime",                             8909 },  /* reversed tilde equals */
+	{ "bsol",                                92 },  /* reverse solidus */
+	{ "bsolb",                            10693 },  /* squared falling diagonal slash */
+	{ "bsolhsub",                         10184 },  /* reverse solidus preceding subset */
+	{ "bull",                              8226 },  /* bullet = small blk circle */
+	{ "bullet",                            8226 },  /* bullet */
+	{ "bump",                              8782 },  /* geometrically equivalent to */
+	{ "bumpE",                            10926 },  /* equals sign with bumpy above */
+	{ "bumpe",                             8783 },  /* difference between */
+	{ "bumpeq",                            8783 },  /* difference between */
+	{ "cacute",                             263 },  /* latin small letter c with acute */
+	{ "cap",                               8745 },  /* intersection */
+	{ "capand",                           10820 },  /* intersection with logical and */
+	{ "capbrcup",                         10825 },  /* intersection above bar above union */
+	{ "capcap",                           10827 },  /* intersection beside and joined with intersection */
+	{ "capcup",                           10823 },  /* intersection above union */
+	{ "capdot",                           10816 },  /* intersection with dot */
+	{ "caret",                             8257 },  /* caret insertion point */
+	{ "caron",                              711 },  /* caron */
+	{ "ccaps",                            10829 },  /* closed intersection with serifs */
+	{ "ccaron",                             269 },  /* latin small letter c with caron */
+	{ "ccedil",                             231 },  /* small c with cedilla */
+	{ "ccirc",                              265 },  /* latin small letter c with circumflex */
+	{ "ccups",                            10828 },  /* closed union with serifs */
+	{ "ccupssm",                          10832 },  /* closed union with serifs and smash product */
+	{ "cdot",                               267 },  /* latin small letter c with dot above */
+	{ "cedil",                              184 },  /* cedilla = spacing cedilla */
+	{ "cemptyv",                          10674 },  /* empty set with small circle above */
+	{ "cent",                               162 },  /* cent sign */
+	{ "centerdot",                          183 },  /* middle dot */
+	{ "cfr",                             120096 },  /* mathematical fraktur small c */
+	{ "chcy",                              1095 },  /* cyrillic small letter che */
+	{ "check",                            10003 },  /* check mark */
+	{ "checkmark",                        10003 },  /* check mark */
+	{ "chi",                                967 },  /* small chi */
+	{ "cir",                               9675 },  /* white circle */
+	{ "cirE",                             10691 },  /* circle with two horizontal strokes to the right */
+	{ "circ",                               710 },  /* modifier letter circumflex */
+	{ "circeq",                            8791 },  /* ring equal to */
+	{ "circlearrowleft",                   8634 },  /* anticlockwise open circle arrow */
+	{ "circlearrowright",                  8635 },  /* clockwise open circle arrow */
+	{ "circledR",                           174 },  /* registered sign */
+	{ "circledS",                          9416 },  /* circled latin capital letter s */
+	{ "circledast",                        8859 },  /* circled asterisk operator */
+	{ "circledcirc",                       8858 },  /* circled ring operator */
+	{ "circleddash",                       8861 },  /* circled dash */
+	{ "cire",                              8791 },  /* ring equal to */
+	{ "cirfnint",                         10768 },  /* circulation function */
+	{ "cirmid",                           10991 },  /* vertical line with circle above */
+	{ "cirscir",                          10690 },  /* circle with small circle to the right */
+	{ "clubs",                             9827 },  /* clubs */
+	{ "clubsuit",                          9827 },  /* black club suit */
+	{ "colon",                               58 },  /* colon */
+	{ "colone",                            8788 },  /* colon equals */
+	{ "coloneq",                           8788 },  /* colon equals */
+	{ "comma",                               44 },  /* comma */
+	{ "commat",                              64 },  /* commercial at */
+	{ "comp",                              8705 },  /* complement */
+	{ "compfn",                            8728 },  /* ring operator */
+	{ "complement",                        8705 },  /* complement */
+	{ "complexes",                         8450 },  /* double-struck capital c */
+	{ "cong",                              8773 },  /* approximately equal to */
+	{ "congdot",                          10861 },  /* congruent with dot above */
+	{ "conint",                            8750 },  /* contour integral */
+	{ "copf",                            120148 },  /* mathematical double-struck small c */
+	{ "coprod",                            8720 },  /* n-ary coproduct */
+	{ "copy",                               169 },  /* copyright sign */
+	{ "copysr",                            8471 },  /* sound recording copyright */
+	{ "crarr",                             8629 },  /* down arrow with corner left */
+	{ "cross",                            10007 },  /* ballot x */
+	{ "cscr",                            119992 },  /* mathematical script small c */
+	{ "csub",                             10959 },  /* closed subset */
+	{ "csube",                            10961 },  /* closed subset or equal to */
+	{ "csup",                             10960 },  /* closed superset */
+	{ "csupe",                            10962 },  /* closed superset or equal to */
+	{ "ctdot",                             8943 },  /* midline horizontal ellipsis */
+	{ "cudarrl",                          10552 },  /* right-side arc clockwise arrow */
+	{ "cudarrr",                          10549 },  /* arrow pointing rightwards then curving downwards */
+	{ "cuepr",                             8926 },  /* equal to or precedes */
+	{ "cuesc",                             8927 },  /* equal to or succeeds */
+	{ "cularr",                            8630 },  /* anticlockwise top semicircle arrow */
+	{ "cularrp",                          10557 },  /* top arc anticlockwise arrow with plus */
+	{ "cup",                               8746 },  /* union */
+	{ "cupbrcap",                         10824 },  /* union above bar above intersection */
+	{ "cupcap",                           10822 },  /* union above intersection */
+	{ "cupcup",                           10826 },  /* union beside and joined with union */
+	{ "cupdot",                            8845 },  /* multiset multiplication */
+	{ "cupor",                            10821 },  /* union with logical or */
+	{ "curarr",                            8631 },  /* clockwise top semicircle arrow */
+	{ "curarrm",                          10556 },  /* top arc clockwise arrow with minus */
+	{ "curlyeqprec",                       8926 },  /* equal to or precedes */
+	{ "curlyeqsucc",                       8927 },  /* equal to or succeeds */
+	{ "curlyvee",                          8910 },  /* curly logical or */
+	{ "curlywedge",                        8911 },  /* curly logical and */
+	{ "curren",                             164 },  /* currency sign */
+	{ "curvearrowleft",                    8630 },  /* anticlockwise top semicircle arrow */
+	{ "curvearrowright",                   8631 },  /* clockwise top semicircle arrow */
+	{ "cuvee",                             8910 },  /* curly logical or */
+	{ "cuwed",                             8911 },  /* curly logical and */
+	{ "cwconint",                          8754 },  /* clockwise contour integral */
+	{ "cwint",                             8753 },  /* clockwise integral */
+	{ "cylcty",                            9005 },  /* cylindricity */
+	{ "dArr",                              8659 },  /* up double arrow */
+	{ "dHar",                             10597 },  /* downwards harpoon with barb left beside downwards harpoon with barb right */
+	{ "dagger",                            8224 },  /* dagger */
+	{ "daleth",                            8504 },  /* dalet symbol */
+	{ "darr",                              8595 },  /* down arrow */
+	{ "dash",                              8208 },  /* hyphen */
+	{ "dashv",                             8867 },  /* left tack */
+	{ "dbkarow",                          10511 },  /* rightwards triple dash arrow */
+	{ "dblac",                              733 },  /* double acute accent */
+	{ "dcaron",                             271 },  /* latin small letter d with caron */
+	{ "dcy",                               1076 },  /* cyrillic small letter de */
+	{ "dd",                                8518 },  /* double-struck italic small d */
+	{ "ddagger",                           8225 },  /* double dagger */
+	{ "ddarr",                             8650 },  /* downwards paired arrows */
+	{ "ddotseq",                          10871 },  /* equals sign with two dots above and two dots below */
+	{ "deg",                                176 },  /* degree sign */
+	{ "delta",                              948 },  /* small delta */
+	{ "demptyv",                          10673 },  /* empty set with overbar */
+	{ "dfisht",                           10623 },  /* down fish tail */
+	{ "dfr",                             120097 },  /* mathematical fraktur small d */
+	{ "dharl",                             8643 },  /* downwards harpoon with barb leftwards */
+	{ "dharr",                             8642 },  /* downwards harpoon with barb rightwards */
+	{ "diam",                              8900 },  /* diamond operator */
+	{ "diamond",                           8900 },  /* diamond operator */
+	{ "diamondsuit",                       9830 },  /* black diamond suit */
+	{ "diams",                             9830 },  /* diamonds */
+	{ "die",                                168 },  /* diaeresis */
+	{ "digamma",                            989 },  /* greek small letter digamma */
+	{ "disin",                             8946 },  /* element of with long horizontal stroke */
+	{ "div",                                247 },  /* division sign */
+	{ "divide",                             247 },  /* division sign */
+	{ "divideontimes",                     8903 },  /* division times */
+	{ "divonx",                            8903 },  /* division times */
+	{ "djcy",                              1106 },  /* cyrillic small letter dje */
+	{ "dlcorn",                            8990 },  /* bottom left corner */
+	{ "dlcrop",                            8973 },  /* bottom left crop */
+	{ "dollar",                              36 },  /* dollar sign */
+	{ "dopf",                            120149 },  /* mathematical double-struck small d */
+	{ "dot",                                729 },  /* dot above */
+	{ "doteq",                             8784 },  /* approaches the limit */
+	{ "doteqdot",                          8785 },  /* geometrically equal to */
+	{ "dotminus",                          8760 },  /* dot minus */
+	{ "dotplus",                           8724 },  /* dot plus */
+	{ "dotsquare",                         8865 },  /* squared dot operator */
+	{ "doublebarwedge",                    8966 },  /* perspective */
+	{ "downarrow",                         8595 },  /* downwards arrow */
+	{ "downdownarrows",                    8650 },  /* downwards paired arrows */
+	{ "downharpoonleft",                   8643 },  /* downwards harpoon with barb leftwards */
+	{ "downharpoonright",                  8642 },  /* downwards harpoon with barb rightwards */
+	{ "drbkarow",                         10512 },  /* rightwards two-headed triple dash arrow */
+	{ "drcorn",                            8991 },  /* bottom right corner */
+	{ "drcrop",                            8972 },  /* bottom right crop */
+	{ "dscr",                            119993 },  /* mathematical script small d */
+	{ "dscy",                              1109 },  /* cyrillic small letter dze */
+	{ "dsol",                             10742 },  /* solidus with overbar */
+	{ "dstrok",                             273 },  /* latin small letter d with stroke */
+	{ "dtdot",                             8945 },  /* down right diagonal ellipsis */
+	{ "dtri",                              9663 },  /* white down-pointing small triangle */
+	{ "dtrif",                             9662 },  /* black down-pointing small triangle */
+	{ "duarr",                             8693 },  /* downwards arrow leftwards of upwards arrow */
+	{ "duhar",                            10607 },  /* downwards harpoon with barb left beside upwards harpoon with barb right */
+	{ "dwangle",                          10662 },  /* oblique angle opening up */
+	{ "dzcy",                              1119 },  /* cyrillic small letter dzhe */
+	{ "dzigrarr",                         10239 },  /* long rightwards squiggle arrow */
+	{ "eDDot",                            10871 },  /* equals sign with two dots above and two dots below */
+	{ "eDot",                              8785 },  /* geometrically equal to */
+	{ "eacute",                             233 },  /* small e with acute */
+	{ "easter",                           10862 },  /* equals with asterisk */
+	{ "ecaron",                             283 },  /* latin small letter e with caron */
+	{ "ecir",                              8790 },  /* ring in equal to */
+	{ "ecirc",                              234 },  /* small e with circumflex */
+	{ "ecolon",                            8789 },  /* equals colon */
+	{ "ecy",                               1101 },  /* cyrillic small letter e */
+	{ "edot",                               279 },  /* latin small letter e with dot above */
+	{ "ee",                                8519 },  /* double-struck italic small e */
+	{ "efDot",                             8786 },  /* approximately equal to or the image of */
+	{ "efr",                             120098 },  /* mathematical fraktur small e */
+	{ "eg",                               10906 },  /* double-line equal to or greater-than */
+	{ "egrave",                             232 },  /* small e with grave */
+	{ "egs",                              10902 },  /* slanted equal to or greater-than */
+	{ "egsdot",                           10904 },  /* slanted equal to or greater-than with dot inside */
+	{ "el",                               10905 },  /* double-line equal to or less-than */
+	{ "elinters",                          9191 },  /* electrical intersection */
+	{ "ell",                               8467 },  /* script small l */
+	{ "els",                              10901 },  /* slanted equal to or less-than */
+	{ "elsdot",                           10903 },  /* slanted equal to or less-than with dot inside */
+	{ "emacr",                              275 },  /* latin small letter e with macron */
+	{ "empty",                             8709 },  /* empty set */
+	{ "emptyset",                          8709 },  /* empty set */
+	{ "emptyv",                            8709 },  /* empty set */
+	{ "emsp",                              8195 },  /* em space */
+	{ "emsp13",                            8196 },  /* three-per-em space */
+	{ "emsp14",                            8197 },  /* four-per-em space */
+	{ "emul",                               235 },  /* small e with diaeresis */
+	{ "eng",                                331 },  /* latin small letter eng */
+	{ "ensp",                              8194 },  /* en space */
+	{ "eogon",                              281 },  /* latin small letter e with ogonek */
+	{ "eopf",                            120150 },  /* mathematical double-struck small e */
+	{ "epar",                              8917 },  /* equal and parallel to */
+	{ "eparsl",                           10723 },  /* equals sign and slanted parallel */
+	{ "eplus",                            10865 },  /* equals sign above plus sign */
+	{ "epsi",                               949 },  /* greek small letter epsilon */
+	{ "epsilon",                            949 },  /* small epsilon */
+	{ "epsiv",                             1013 },  /* greek lunate epsilon symbol */
+	{ "eqcirc",                            8790 },  /* ring in equal to */
+	{ "eqcolon",                           8789 },  /* equals colon */
+	{ "eqsim",                             8770 },  /* minus tilde */
+	{ "eqslantgtr",                       10902 },  /* slanted equal to or greater-than */
+	{ "eqslantless",                      10901 },  /* slanted equal to or less-than */
+	{ "equals",                              61 },  /* equals sign */
+	{ "equest",                            8799 },  /* questioned equal to */
+	{ "equiv",                             8801 },  /* identical to */
+	{ "equivDD",                          10872 },  /* equivalent with four dots above */
+	{ "eqvparsl",                         10725 },  /* identical to and slanted parallel */
+	{ "erDot",                             8787 },  /* image of or approximately equal to */
+	{ "erarr",                            10609 },  /* equals sign above rightwards arrow */
+	{ "escr",                              8495 },  /* script small e */
+	{ "esdot",                             8784 },  /* approaches the limit */
+	{ "esim",                              8770 },  /* minus tilde */
+	{ "eta",                                951 },  /* small eta */
+	{ "eth",                                240 },  /* latin small letter eth */
+	{ "euml",                               235 },  /* latin small letter e with diaeresis */
+	{ "euro",                              8364 },  /* euro sign */
+	{ "excl",                                33 },  /* exclamation mark */
+	{ "exist",                             8707 },  /* there exists */
+	{ "expectation",                       8496 },  /* script capital e */
+	{ "exponentiale",                      8519 },  /* double-struck italic small e */
+	{ "fallingdotseq",                     8786 },  /* approximately equal to or the image of */
+	{ "fcy",                               1092 },  /* cyrillic small letter ef */
+	{ "female",                            9792 },  /* female sign */
+	{ "ffilig",                           64259 },  /* latin small ligature ffi */
+	{ "fflig",                            64256 },  /* latin small ligature ff */
+	{ "ffllig",                           64260 },  /* latin small ligature ffl */
+	{ "ffr",                             120099 },  /* mathematical fraktur small f */
+	{ "filig",                            64257 },  /* latin small ligature fi */
+	{ "flat",                              9837 },  /* music flat sign */
+	{ "fllig",                            64258 },  /* latin small ligature fl */
+	{ "fltns",                             9649 },  /* white parallelogram */
+	{ "fnof",                               402 },  /* small f with hook = function */
+	{ "fopf",                            120151 },  /* mathematical double-struck small f */
+	{ "forall",                            8704 },  /* for all */
+	{ "fork",                              8916 },  /* pitchfork */
+	{ "forkv",                            10969 },  /* element of opening downwards */
+	{ "fpartint",                         10765 },  /* finite part integral */
+	{ "frac12",                             189 },  /* 1/2 */
+	{ "frac13",                            8531 },  /* vulgar fraction one third */
+	{ "frac14",                             188 },  /* 1/4 */
+	{ "frac15",                            8533 },  /* vulgar fraction one fifth */
+	{ "frac16",                            8537 },  /* vulgar fraction one sixth */
+	{ "frac18",                            8539 },  /* vulgar fraction one eighth */
+	{ "frac23",                            8532 },  /* vulgar fraction two thirds */
+	{ "frac25",                            8534 },  /* vulgar fraction two fifths */
+	{ "frac34",                             190 },  /* 3/4 */
+	{ "frac35",                            8535 },  /* vulgar fraction three fifths */
+	{ "frac38",                            8540 },  /* vulgar fraction three eighths */
+	{ "frac45",                            8536 },  /* vulgar fraction four fifths */
+	{ "frac56",                            8538 },  /* vulgar fraction five sixths */
+	{ "frac58",                            8541 },  /* vulgar fraction five eighths */
+	{ "frac78",                            8542 },  /* vulgar fraction seven eighths */
+	{ "frasl",                             8260 },  /* fraction slash */
+	{ "frown",                             8994 },  /* frown */
+	{ "fscr",                            119995 },  /* mathematical script small f */
+	{ "gE",                                8807 },  /* greater-than over equal to */
+	{ "gEl",                              10892 },  /* greater-than above double-line equal above less-than */
+	{ "gacute",                             501 },  /* latin small letter g with acute */
+	{ "gamma",                              947 },  /* small gamma */
+	{ "gammad",                             989 },  /* greek small letter digamma */
+	{ "gap",                              10886 },  /* greater-than or approximate */
+	{ "gbreve",                             287 },  /* latin small letter g with breve */
+	{ "gcirc",                              285 },  /* latin small letter g with circumflex */
+	{ "gcy",                               1075 },  /* cyrillic small letter ghe */
+	{ "gdot",                               289 },  /* latin small letter g with dot above */
+	{ "ge",                                8805 },  /* greater-than or equal to */
+	{ "gel",                               8923 },  /* greater-than equal to or less-than */
+	{ "geq",                               8805 },  /* greater-than or equal to */
+	{ "geqq",                              8807 },  /* greater-than over equal to */
+	{ "geqslant",                         10878 },  /* greater-than or slanted equal to */
+	{ "ges",                              10878 },  /* greater-than or slanted equal to */
+	{ "gescc",                            10921 },  /* greater-than closed by curve above slanted equal */
+	{ "gesdot",                           10880 },  /* greater-than or slanted equal to with dot inside */
+	{ "gesdoto",                          10882 },  /* greater-than or slanted equal to with dot above */
+	{ "gesdotol",                         10884 },  /* greater-than or slanted equal to with dot above left */
+	{ "gesles",                           10900 },  /* greater-than above slanted equal above less-than above slanted equal */
+	{ "gfr",                             120100 },  /* mathematical fraktur small g */
+	{ "gg",                                8811 },  /* much greater-than */
+	{ "ggg",                               8921 },  /* very much greater-than */
+	{ "gimel",                             8503 },  /* gimel symbol */
+	{ "gjcy",                              1107 },  /* cyrillic small letter gje */
+	{ "gl",                                8823 },  /* greater-than or less-than */
+	{ "glE",                              10898 },  /* greater-than above less-than above double-line equal */
+	{ "gla",                              10917 },  /* greater-than beside less-than */
+	{ "glj",                              10916 },  /* greater-than overlapping less-than */
+	{ "gnE",                               8809 },  /* greater-than but not equal to */
+	{ "gnap",                             10890 },  /* greater-than and not approximate */
+	{ "gnapprox",                         10890 },  /* greater-than and not approximate */
+	{ "gne",                              10888 },  /* greater-than and single-line not equal to */
+	{ "gneq",                             10888 },  /* greater-than and single-line not equal to */
+	{ "gneqq",                             8809 },  /* greater-than but not equal to */
+	{ "gnsim",                             8935 },  /* greater-than but not equivalent to */
+	{ "gopf",                            120152 },  /* mathematical double-struck small g */
+	{ "grave",                               96 },  /* grave accent */
+	{ "gscr",                              8458 },  /* script small g */
+	{ "gsim",                              8819 },  /* greater-than or equivalent to */
+	{ "gsime",                            10894 },  /* greater-than above similar or equal */
+	{ "gsiml",                            10896 },  /* greater-than above similar above less-than */
+	{ "gt",                                  62 },  /* greater-than sign */
+	{ "gtcc",                             10919 },  /* greater-than closed by curve */
+	{ "gtcir",                            10874 },  /* greater-than with circle inside */
+	{ "gtdot",                             8919 },  /* greater-than with dot */
+	{ "gtlPar",                           10645 },  /* double left arc greater-than bracket */
+	{ "gtquest",                          10876 },  /* greater-than with question mark above */
+	{ "gtrapprox",                        10886 },  /* greater-than or approximate */
+	{ "gtrarr",                           10616 },  /* greater-than above rightwards arrow */
+	{ "gtrdot",                            8919 },  /* greater-than with dot */
+	{ "gtreqless",                         8923 },  /* greater-than equal to or less-than */
+	{ "gtreqqless",                       10892 },  /* greater-than above double-line equal above less-than */
+	{ "gtrless",                           8823 },  /* greater-than or less-than */
+	{ "gtrsim",                            8819 },  /* greater-than or equivalent to */
+	{ "hArr",                              8660 },  /* up double arrow */
+	{ "hairsp",                            8202 },  /* hair space */
+	{ "half",                               189 },  /* vulgar fraction one half */
+	{ "hamilt",                            8459 },  /* script capital h */
+	{ "hardcy",                            1098 },  /* cyrillic small letter hard sign */
+	{ "harr",                              8596 },  /* left/right arrow */
+	{ "harrcir",                          10568 },  /* left right arrow through small circle */
+	{ "harrw",                             8621 },  /* left right wave arrow */
+	{ "hbar",                              8463 },  /* planck constant over two pi */
+	{ "hcirc",                              293 },  /* latin small letter h with circumflex */
+	{ "hearts",                            9829 },  /* hearts */
+	{ "heartsuit",                         9829 },  /* black heart suit */
+	{ "hellip",                            8230 },  /* horizontal ellipsis */
+	{ "hercon",                            8889 },  /* hermitian conjugate matrix */
+	{ "hfr",                             120101 },  /* mathematical fraktur small h */
+	{ "hksearow",                         10533 },  /* south east arrow with hook */
+	{ "hkswarow",                         10534 },  /* south west arrow with hook */
+	{ "hoarr",                             8703 },  /* left right open-headed arrow */
+	{ "homtht",                            8763 },  /* homothetic */
+	{ "hookleftarrow",                     8617 },  /* leftwards arrow with hook */
+	{ "hookrightarrow",                    8618 },  /* rightwards arrow with hook */
+	{ "hopf",                            120153 },  /* mathematical double-struck small h */
+	{ "horbar",                            8213 },  /* horizontal bar */
+	{ "hscr",                            119997 },  /* mathematical script small h */
+	{ "hslash",                            8463 },  /* planck constant over two pi */
+	{ "hstrok",                             295 },  /* latin small letter h with stroke */
+	{ "hybull",                            8259 },  /* hyphen bullet */
+	{ "hyphen",                              45 },  /* hyphen */
+	{ "iacute",                             237 },  /* small i with acute */
+	{ "ic",                                8291 },  /* invisible separator */
+	{ "icirc",                              238 },  /* small i with circumflex */
+	{ "icy",                               1080 },  /* cyrillic small letter i */
+	{ "iecy",                              1077 },  /* cyrillic small letter ie */
+	{ "iexcl",                              161 },  /* inverted exclamation mark */
+	{ "iff",                               8660 },  /* left right double arrow */
+	{ "ifr",                             120102 },  /* mathematical fraktur small i */
+	{ "igrave",                             236 },  /* small i with grave */
+	{ "ii",                                8520 },  /* double-struck italic small i */
+	{ "iiiint",                           10764 },  /* quadruple integral operator */
+	{ "iiint",                             8749 },  /* triple integral */
+	{ "iinfin",                           10716 },  /* incomplete infinity */
+	{ "iiota",                             8489 },  /* turned greek small letter iota */
+	{ "ijlig",                              307 },  /* latin small ligature ij */
+	{ "imacr",                              299 },  /* latin small letter i with macron */
+	{ "image",                             8465 },  /* imaginary part-black cap I */
+	{ "imagline",                          8464 },  /* script capital i */
+	{ "imagpart",                          8465 },  /* black-letter capital i */
+	{ "imath",                              305 },  /* latin small letter dotless i */
+	{ "imof",                              8887 },  /* image of */
+	{ "imped",                              437 },  /* latin capital letter z with stroke */
+	{ "in",                                8712 },  /* element of */
+	{ "incare",                            8453 },  /* care of */
+	{ "infin",                             8734 },  /* infinity */
+	{ "infintie",                         10717 },  /* tie over infinity */
+	{ "inodot",                             305 },  /* latin small letter dotless i */
+	{ "int",                               8747 },  /* integral */
+	{ "intcal",                            8890 },  /* intercalate */
+	{ "integers",                          8484 },  /* double-struck capital z */
+	{ "intercal",                          8890 },  /* intercalate */
+	{ "intlarhk",                         10775 },  /* integral with leftwards arrow with hook */
+	{ "intprod",                          10812 },  /* interior product */
+	{ "iocy",                              1105 },  /* cyrillic small letter io */
+	{ "iogon",                              303 },  /* latin small letter i with ogonek */
+	{ "iopf",                            120154 },  /* mathematical double-struck small i */
+	{ "iota",                               953 },  /* small iota */
+	{ "iprod",                            10812 },  /* interior product */
+	{ "iquest",                             191 },  /* inverted question mark */
+	{ "iscr",                            119998 },  /* mathematical script small i */
+	{ "isin",                              8712 },  /* element of */
+	{ "isinE",                             8953 },  /* element of with two horizontal strokes */
+	{ "isindot",                           8949 },  /* element of with dot above */
+	{ "isins",                             8948 },  /* small element of with vertical bar at end of horizontal stroke */
+	{ "isinsv",                            8947 },  /* element of with vertical bar at end of horizontal stroke */
+	{ "isinv",                             8712 },  /* element of */
+	{ "it",                                8290 },  /* invisible times */
+	{ "itilde",                             297 },  /* latin small letter i with tilde */
+	{ "iukcy",                             1110 },  /* cyrillic small letter byelorussian-ukrainian i */
+	{ "iuml",                               239 },  /* small i with diaeresis */
+	{ "jcirc",                              309 },  /* latin small letter j with circumflex */
+	{ "jcy",                               1081 },  /* cyrillic small letter short i */
+	{ "jfr",                             120103 },  /* mathematical fraktur small j */
+	{ "jmath",                              567 },  /* latin small letter dotless j */
+	{ "jopf",                            120155 },  /* mathematical double-struck small j */
+	{ "jscr",                            119999 },  /* mathematical script small j */
+	{ "jsercy",                            1112 },  /* cyrillic small letter je */
+	{ "jukcy",                             1108 },  /* cyrillic small letter ukrainian ie */
+	{ "kappa",                              954 },  /* small kappa */
+	{ "kappav",                            1008 },  /* greek kappa symbol */
+	{ "kcedil",                             311 },  /* latin small letter k with cedilla */
+	{ "kcy",                               1082 },  /* cyrillic small letter ka */
+	{ "kfr",                             120104 },  /* mathematical fraktur small k */
+	{ "kgreen",                             312 },  /* latin small letter kra */
+	{ "khcy",                              1093 },  /* cyrillic small letter ha */
+	{ "kjcy",                              1116 },  /* cyrillic small letter kje */
+	{ "kopf",                            120156 },  /* mathematical double-struck small k */
+	{ "kscr",                            120000 },  /* mathematical script small k */
+	{ "lAarr",                             8666 },  /* leftwards triple arrow */
+	{ "lArr",                              8656 },  /* left double arrow */
+	{ "lAtail",                           10523 },  /* leftwards double arrow-tail */
+	{ "lBarr",                            10510 },  /* leftwards triple dash arrow */
+	{ "lE",                                8806 },  /* less-than over equal to */
+	{ "lEg",                              10891 },  /* less-than above double-line equal above greater-than */
+	{ "lHar",                             10594 },  /* leftwards harpoon with barb up above leftwards harpoon with barb down */
+	{ "lacute",                             314 },  /* latin small letter l with acute */
+	{ "laemptyv",                         10676 },  /* empty set with left arrow above */
+	{ "lagran",                            8466 },  /* script capital l */
+	{ "lambda",                             955 },  /* small lambda */
+	{ "lang",                              9001 },  /* left angle bracket */
+	{ "langd",                            10641 },  /* left angle bracket with dot */
+	{ "langle",                           10216 },  /* mathematical left angle bracket */
+	{ "lap",                              10885 },  /* less-than or approximate */
+	{ "laquo",                              171 },  /* left-pointing guillemet */
+	{ "larr",                              8592 },  /* left arrow */
+	{ "larrb",                             8676 },  /* leftwards arrow to bar */
+	{ "larrbfs",                          10527 },  /* leftwards arrow from bar to black diamond */
+	{ "larrfs",                           10525 },  /* leftwards arrow to black diamond */
+	{ "larrhk",                            8617 },  /* leftwards arrow with hook */
+	{ "larrlp",                            8619 },  /* leftwards arrow with loop */
+	{ "larrpl",                           10553 },  /* left-side arc anticlockwise arrow */
+	{ "larrsim",                          10611 },  /* leftwards arrow above tilde operator */
+	{ "larrtl",                            8610 },  /* leftwards arrow with tail */
+	{ "lat",                              10923 },  /* larger than */
+	{ "latail",                           10521 },  /* leftwards arrow-tail */
+	{ "late",                             10925 },  /* larger than or equal to */
+	{ "lbarr",                            10508 },  /* leftwards double dash arrow */
+	{ "lbbrk",                            10098 },  /* light left tortoise shell bracket ornament */
+	{ "lbrace",                             123 },  /* left curly bracket */
+	{ "lbrack",                              91 },  /* left square bracket */
+	{ "lbrke",                            10635 },  /* left square bracket with underbar */
+	{ "lbrksld",                          10639 },  /* left square bracket with tick in bottom corner */
+	{ "lbrkslu",                          10637 },  /* left square bracket with tick in top corner */
+	{ "lcaron",                             318 },  /* latin small letter l with caron */
+	{ "lcedil",                             316 },  /* latin small letter l with cedilla */
+	{ "lceil",                             8968 },  /* left ceiling */
+	{ "lcub",                               123 },  /* left curly bracket */
+	{ "lcy",                               1083 },  /* cyrillic small letter el */
+	{ "ldca",                             10550 },  /* arrow pointing downwards then curving leftwards */
+	{ "ldquo",                             8220 },  /* left double quot. mark */
+	{ "ldquor",                            8222 },  /* double low-9 quotation mark */
+	{ "ldrdhar",                          10599 },  /* leftwards harpoon with barb down above rightwards harpoon with barb down */
+	{ "ldrushar",                         10571 },  /* left barb down right barb up harpoon */
+	{ "ldsh",                              8626 },  /* downwards arrow with tip leftwards */
+	{ "le",                                8804 },  /* less-than or equal to */
+	{ "leftarrow",                         8592 },  /* leftwards arrow */
+	{ "leftarrowtail",                     8610 },  /* leftwards arrow with tail */
+	{ "leftharpoondown",                   8637 },  /* leftwards harpoon with barb downwards */
+	{ "leftharpoonup",                     8636 },  /* leftwards harpoon with barb upwards */
+	{ "leftleftarrows",                    8647 },  /* leftwards paired arrows */
+	{ "leftrightarrow",                    8596 },  /* left right arrow */
+	{ "leftrightarrows",                   8646 },  /* leftwards arrow over rightwards arrow */
+	{ "leftrightharpoons",                 8651 },  /* leftwards harpoon over rightwards harpoon */
+	{ "leftrightsquigarrow",               8621 },  /* left right wave arrow */
+	{ "leftthreetimes",                    8907 },  /* left semidirect product */
+	{ "leg",                               8922 },  /* less-than equal to or greater-than */
+	{ "leq",                               8804 },  /* less-than or equal to */
+	{ "leqq",                              8806 },  /* less-than over equal to */
+	{ "leqslant",                         10877 },  /* less-than or slanted equal to */
+	{ "les",                              10877 },  /* less-than or slanted equal to */
+	{ "lescc",                            10920 },  /* less-than closed by curve above slanted equal */
+	{ "lesdot",                           10879 },  /* less-than or slanted equal to with dot inside */
+	{ "lesdoto",                          10881 },  /* less-than or slanted equal to with dot above */
+	{ "lesdotor",                         10883 },  /* less-than or slanted equal to with dot above right */
+	{ "lesges",                           10899 },  /* less-than above slanted equal above greater-than above slanted equal */
+	{ "lessapprox",                       10885 },  /* less-than or approximate */
+	{ "lessdot",                           8918 },  /* less-than with dot */
+	{ "lesseqgtr",                         8922 },  /* less-than equal to or greater-than */
+	{ "lesseqqgtr",                       10891 },  /* less-than above double-line equal above greater-than */
+	{ "lessgtr",                           8822 },  /* less-than or greater-than */
+	{ "lesssim",                           8818 },  /* less-than or equivalent to */
+	{ "lfisht",                           10620 },  /* left fish tail */
+	{ "lfloor",                            8970 },  /* left floor */
+	{ "lfr",                             120105 },  /* mathematical fraktur small l */
+	{ "lg",                                8822 },  /* less-than or greater-than */
+	{ "lgE",                              10897 },  /* less-than above greater-than above double-line equal */
+	{ "lhard",                             8637 },  /* leftwards harpoon with barb downwards */
+	{ "lharu",                             8636 },  /* leftwards harpoon with barb upwards */
+	{ "lharul",                           10602 },  /* leftwards harpoon with barb up above long dash */
+	{ "lhblk",                             9604 },  /* lower half block */
+	{ "ljcy",                              1113 },  /* cyrillic small letter lje */
+	{ "ll",                                8810 },  /* much less-than */
+	{ "llarr",                             8647 },  /* leftwards paired arrows */
+	{ "llcorner",                          8990 },  /* bottom left corner */
+	{ "llhard",                           10603 },  /* leftwards harpoon with barb down below long dash */
+	{ "lltri",                             9722 },  /* lower left triangle */
+	{ "lmidot",                             320 },  /* latin small letter l with middle dot */
+	{ "lmoust",                            9136 },  /* upper left or lower right curly bracket section */
+	{ "lmoustache",                        9136 },  /* upper left or lower right curly bracket section */
+	{ "lnE",                               8808 },  /* less-than but not equal to */
+	{ "lnap",                             10889 },  /* less-than and not approximate */
+	{ "lnapprox",                         10889 },  /* less-than and not approximate */
+	{ "lne",                              10887 },  /* less-than and single-line not equal to */
+	{ "lneq",                             10887 },  /* less-than and single-line not equal to */
+	{ "lneqq",                             8808 },  /* less-than but not equal to */
+	{ "lnsim",                             8934 },  /* less-than but not equivalent to */
+	{ "loang",                            10220 },  /* mathematical left white tortoise shell bracket */
+	{ "loarr",                             8701 },  /* leftwards open-headed arrow */
+	{ "lobrk",                            10214 },  /* mathematical left white square bracket */
+	{ "longleftarrow",                    10229 },  /* long leftwards arrow */
+	{ "longleftrightarrow",               10231 },  /* long left right arrow */
+	{ "longmapsto",                       10236 },  /* long rightwards arrow from bar */
+	{ "longrightarrow",                   10230 },  /* long rightwards arrow */
+	{ "looparrowleft",                     8619 },  /* leftwards arrow with loop */
+	{ "looparrowright",                    8620 },  /* rightwards arrow with loop */
+	{ "lopar",                            10629 },  /* left white parenthesis */
+	{ "lopf",                            120157 },  /* mathematical double-struck small l */
+	{ "loplus",                           10797 },  /* plus sign in left half circle */
+	{ "lotimes",                          10804 },  /* multiplication sign in left half circle */
+	{ "lowast",                            8727 },  /* asterisk operator */
+	{ "lowbar",                              95 },  /* low line */
+	{ "loz",                               9674 },  /* lozenge */
+	{ "lozenge",                           9674 },  /* lozenge */
+	{ "lozf",                             10731 },  /* black lozenge */
+	{ "lpar",                                40 },  /* left parenthesis */
+	{ "lparlt",                           10643 },  /* left arc less-than bracket */
+	{ "lrarr",                             8646 },  /* leftwards arrow over rightwards arrow */
+	{ "lrcorner",                          8991 },  /* bottom right corner */
+	{ "lrhar",                             8651 },  /* leftwards harpoon over rightwards harpoon */
+	{ "lrhard",                           10605 },  /* rightwards harpoon with barb down below long dash */
+	{ "lrm",                               8206 },  /* left-to-right mark */
+	{ "lrtri",                             8895 },  /* right triangle */
+	{ "lsaquo",                            8249 },  /* sin. left angle quot mark */
+	{ "lscr",                            120001 },  /* mathematical script small l */
+	{ "lsh",                               8624 },  /* upwards arrow with tip leftwards */
+	{ "lsim",                              8818 },  /* less-than or equivalent to */
+	{ "lsime",                            10893 },  /* less-than above similar or equal */
+	{ "lsimg",                            10895 },  /* less-than above similar above greater-than */
+	{ "lsqb",                                91 },  /* left square bracket */
+	{ "lsquo",                             8216 },  /* left single quotation mark */
+	{ "lsquor",                            8218 },  /* single low-9 quotation mark */
+	{ "lstrok",                             322 },  /* latin small letter l with stroke */
+	{ "lt",                                  60 },  /* less-than sign */
+	{ "ltcc",                             10918 },  /* less-than closed by curve */
+	{ "ltcir",                            10873 },  /* less-than with circle inside */
+	{ "ltdot",                             8918 },  /* less-than with dot */
+	{ "lthree",                            8907 },  /* left semidirect product */
+	{ "ltimes",                            8905 },  /* left normal factor semidirect product */
+	{ "ltlarr",                           10614 },  /* less-than above leftwards arrow */
+	{ "ltquest",                          10875 },  /* less-than with question mark above */
+	{ "ltrPar",                           10646 },  /* double right arc less-than bracket */
+	{ "ltri",                              9667 },  /* white left-pointing small triangle */
+	{ "ltrie",                             8884 },  /* normal subgroup of or equal to */
+	{ "ltrif",                             9666 },  /* black left-pointing small triangle */
+	{ "lurdshar",                         10570 },  /* left barb up right barb down harpoon */
+	{ "luruhar",                          10598 },  /* leftwards harpoon with barb up above rightwards harpoon with barb up */
+	{ "mDDot",                             8762 },  /* geometric proportion */
+	{ "macr",                               175 },  /* macron = overline */
+	{ "male",                              9794 },  /* male sign */
+	{ "malt",                             10016 },  /* maltese cross */
+	{ "maltese",                          10016 },  /* maltese cross */
+	{ "map",                               8614 },  /* rightwards arrow from bar */
+	{ "mapsto",                            8614 },  /* rightwards arrow from bar */
+	{ "mapstodown",                        8615 },  /* downwards arrow from bar */
+	{ "mapstoleft",                        8612 },  /* leftwards arrow from bar */
+	{ "mapstoup",                          8613 },  /* upwards arrow from bar */
+	{ "marker",                            9646 },  /* black vertical rectangle */
+	{ "mcomma",                           10793 },  /* minus sign with comma above */
+	{ "mcy",                               1084 },  /* cyrillic small letter em */
+	{ "mdash",                             8212 },  /* em dash */
+	{ "measuredangle",                     8737 },  /* measured angle */
+	{ "mfr",                             120106 },  /* mathematical fraktur small m */
+	{ "mho",                               8487 },  /* inverted ohm sign */
+	{ "micro",                              181 },  /* micro sign */
+	{ "mid",                               8739 },  /* divides */
+	{ "midast",                              42 },  /* asterisk */
+	{ "midcir",                           10992 },  /* vertical line with circle below */
+	{ "middot",                             183 },  /* middle dot (georgian comma) */
+	{ "minus",                             8722 },  /* minuss sign */
+	{ "minusb",                            8863 },  /* squared minus */
+	{ "minusd",                            8760 },  /* dot minus */
+	{ "minusdu",                          10794 },  /* minus sign with dot below */
+	{ "mlcp",                             10971 },  /* transversal intersection */
+	{ "mldr",                              8230 },  /* horizontal ellipsis */
+	{ "mnplus",                            8723 },  /* minus-or-plus sign */
+	{ "models",                            8871 },  /* models */
+	{ "mopf",                            120158 },  /* mathematical double-struck small m */
+	{ "mp",                                8723 },  /* minus-or-plus sign */
+	{ "mscr",                            120002 },  /* mathematical script small m */
+	{ "mstpos",                            8766 },  /* inverted lazy s */
+	{ "mu",                                 956 },  /* small mu */
+	{ "multimap",                          8888 },  /* multimap */
+	{ "mumap",                             8888 },  /* multimap */
+	{ "nLeftarrow",                        8653 },  /* leftwards double arrow with stroke */
+	{ "nLeftrightarrow",                   8654 },  /* left right double arrow with stroke */
+	{ "nRightarrow",                       8655 },  /* rightwards double arrow with stroke */
+	{ "nVDash",                            8879 },  /* negated double vertical bar double right turnstile */
+	{ "nVdash",                            8878 },  /* does not force */
+	{ "nabla",                             8711 },  /* nabla=backwards difference */
+	{ "nacute",                             324 },  /* latin small letter n with acute */
+	{ "nap",                               8777 },  /* not almost equal to */
+	{ "napos",                              329 },  /* latin small letter n preceded by apostrophe */
+	{ "napprox",                           8777 },  /* not almost equal to */
+	{ "natur",                             9838 },  /* music natural sign */
+	{ "natural",                           9838 },  /* music natural sign */
+	{ "naturals",                          8469 },  /* double-struck capital n */
+	{ "nbsp",                                32 },  /* non-breaking space */
+	{ "ncap",                             10819 },  /* intersection with overbar */
+	{ "ncaron",                             328 },  /* latin small letter n with caron */
+	{ "ncedil",                             326 },  /* latin small letter n with cedilla */
+	{ "ncong",                             8775 },  /* neither approximately nor actually equal to */
+	{ "ncup",                             10818 },  /* union with overbar */
+	{ "ncy",                               1085 },  /* cyrillic small letter en */
+	{ "ndash",                             8211 },  /* en dash */
+	{ "ne",                                8800 },  /* not equal to */
+	{ "neArr",                             8663 },  /* north east double arrow */
+	{ "nearhk",                           10532 },  /* north east arrow with hook */
+	{ "nearr",                             8599 },  /* north east arrow */
+	{ "nearrow",                           8599 },  /* north east arrow */
+	{ "nequiv",                            8802 },  /* not identical to */
+	{ "nesear",                           10536 },  /* north east arrow and south east arrow */
+	{ "nexist",                            8708 },  /* there does not exist */
+	{ "nexists",                           8708 },  /* there does not exist */
+	{ "nfr",                             120107 },  /* mathematical fraktur small n */
+	{ "nge",                               8817 },  /* neither greater-than nor equal to */
+	{ "ngeq",                              8817 },  /* neither greater-than nor equal to */
+	{ "ngsim",                             8821 },  /* neither greater-than nor equivalent to */
+	{ "ngt",                               8815 },  /* not greater-than */
+	{ "ngtr",                              8815 },  /* not greater-than */
+	{ "nhArr",                             8654 },  /* left right double arrow with stroke */
+	{ "nharr",                             8622 },  /* left right arrow with stroke */
+	{ "nhpar",                            10994 },  /* parallel with horizontal stroke */
+	{ "ni",                                8715 },  /* contains as member */
+	{ "nis",                               8956 },  /* small contains with vertical bar at end of horizontal stroke */
+	{ "nisd",                              8954 },  /* contains with long horizontal stroke */
+	{ "niv",                               8715 },  /* contains as member */
+	{ "njcy",                              1114 },  /* cyrillic small letter nje */
+	{ "nlArr",                             8653 },  /* leftwards double arrow with stroke */
+	{ "nlarr",                             8602 },  /* leftwards arrow with stroke */
+	{ "nldr",                              8229 },  /* two dot leader */
+	{ "nle",                               8816 },  /* neither less-than nor equal to */
+	{ "nleftarrow",                        8602 },  /* leftwards arrow with stroke */
+	{ "nleftrightarrow",                   8622 },  /* left right arrow with stroke */
+	{ "nleq",                              8816 },  /* neither less-than nor equal to */
+	{ "nless",                             8814 },  /* not less-than */
+	{ "nlsim",                             8820 },  /* neither less-than nor equivalent to */
+	{ "nlt",                               8814 },  /* not less-than */
+	{ "nltri",                             8938 },  /* not normal subgroup of */
+	{ "nltrie",                            8940 },  /* not normal subgroup of or equal to */
+	{ "nmid",                              8740 },  /* does not divide */
+	{ "nopf",                            120159 },  /* mathematical double-struck small n */
+	{ "not",                                172 },  /* not sign */
+	{ "notin",                             8713 },  /* not an element of */
+	{ "notinva",                           8713 },  /* not an element of */
+	{ "notinvb",                           8951 },  /* small element of with overbar */
+	{ "notinvc",                           8950 },  /* element of with overbar */
+	{ "notni",                             8716 },  /* does not contain as member */
+	{ "notniva",                           8716 },  /* does not contain as member */
+	{ "notnivb",                           8958 },  /* small contains with overbar */
+	{ "notnivc",                           8957 },  /* contains with overbar */
+	{ "npar",                              8742 },  /* not parallel to */
+	{ "nparallel",                         8742 },  /* not parallel to */
+	{ "npolint",                          10772 },  /* line integration not including the pole */
+	{ "npr",                               8832 },  /* does not precede */
+	{ "nprcue",                            8928 },  /* does not precede or equal */
+	{ "nprec",                             8832 },  /* does not precede */
+	{ "nrArr",                             8655 },  /* rightwards double arrow with stroke */
+	{ "nrarr",                             8603 },  /* rightwards arrow with stroke */
+	{ "nrightarrow",                       8603 },  /* rightwards arrow with stroke */
+	{ "nrtri",                             8939 },  /* does not contain as normal subgroup */
+	{ "nrtrie",                            8941 },  /* does not contain as normal subgroup or equal */
+	{ "nsc",                               8833 },  /* does not succeed */
+	{ "nsccue",                            8929 },  /* does not succeed or equal */
+	{ "nscr",                            120003 },  /* mathematical script small n */
+	{ "nshortmid",                         8740 },  /* does not divide */
+	{ "nshortparallel",                    8742 },  /* not parallel to */
+	{ "nsim",                              8769 },  /* not tilde */
+	{ "nsime",                             8772 },  /* not asymptotically equal to */
+	{ "nsimeq",                            8772 },  /* not asymptotically equal to */
+	{ "nsmid",                             8740 },  /* does not divide */
+	{ "nspar",                             8742 },  /* not parallel to */
+	{ "nsqsube",                           8930 },  /* not square image of or equal to */
+	{ "nsqsupe",                           8931 },  /* not square original of or equal to */
+	{ "nsub",                              8836 },  /* not a subset of */
+	{ "nsube",                             8840 },  /* neither a subset of nor equal to */
+	{ "nsubseteq",                         8840 },  /* neither a subset of nor equal to */
+	{ "nsucc",                             8833 },  /* does not succeed */
+	{ "nsup",                              8837 },  /* not a superset of */
+	{ "nsupe",                             8841 },  /* neither a superset of nor equal to */
+	{ "nsupseteq",                         8841 },  /* neither a superset of nor equal to */
+	{ "ntgl",                              8825 },  /* neither greater-than nor less-than */
+	{ "ntilde",                             241 },  /* small n with tilde */
+	{ "ntlg",                              8824 },  /* neither less-than nor greater-than */
+	{ "ntriangleleft",                     8938 },  /* not normal subgroup of */
+	{ "ntrianglelefteq",                   8940 },  /* not normal subgroup of or equal to */
+	{ "ntriangleright",                    8939 },  /* does not contain as normal subgroup */
+	{ "ntrianglerighteq",                  8941 },  /* does not contain as normal subgroup or equal */
+	{ "nu",                                 957 },  /* small nu */
+	{ "num",                                 35 },  /* number sign */
+	{ "numero",                            8470 },  /* numero sign */
+	{ "numsp",                             8199 },  /* figure space */
+	{ "nvDash",                            8877 },  /* not true */
+	{ "nvHarr",                           10500 },  /* left right double arrow with vertical stroke */
+	{ "nvdash",                            8876 },  /* does not prove */
+	{ "nvinfin",                          10718 },  /* infinity negated with vertical bar */
+	{ "nvlArr",                           10498 },  /* leftwards double arrow with vertical stroke */
+	{ "nvrArr",                           10499 },  /* rightwards double arrow with vertical stroke */
+	{ "nwArr",                             8662 },  /* north west double arrow */
+	{ "nwarhk",                           10531 },  /* north west arrow with hook */
+	{ "nwarr",                             8598 },  /* north west arrow */
+	{ "nwarrow",                           8598 },  /* north west arrow */
+	{ "nwnear",                           10535 },  /* north west arrow and north east arrow */
+	{ "oS",                                9416 },  /* circled latin capital letter s */
+	{ "oacute",                             243 },  /* small o with acute */
+	{ "oast",                              8859 },  /* circled asterisk operator */
+	{ "ocir",                              8858 },  /* circled ring operator */
+	{ "ocirc",                              244 },  /* small o with circumflex */
+	{ "ocy",                               1086 },  /* cyrillic small letter o */
+	{ "odash",                             8861 },  /* circled dash */
+	{ "odblac",                             337 },  /* latin small letter o with double acute */
+	{ "odiv",                             10808 },  /* circled division sign */
+	{ "odot",                              8857 },  /* circled dot operator */
+	{ "odsold",                           10684 },  /* circled anticlockwise-rotated division sign */
+	{ "oelig",                              339 },  /* Latin small ligature OE */
+	{ "ofcir",                            10687 },  /* circled bullet */
+	{ "ofr",                             120108 },  /* mathematical fraktur small o */
+	{ "ogon",                               731 },  /* ogonek */
+	{ "ograve",                             242 },  /* small o with grave */
+	{ "ogt",                              10689 },  /* circled greater-than */
+	{ "ohbar",                            10677 },  /* circle with horizontal bar */
+	{ "ohm",                                937 },  /* greek capital letter omega */
+	{ "oint",                              8750 },  /* contour integral */
+	{ "olarr",                             8634 },  /* anticlockwise open circle arrow */
+	{ "olcir",                            10686 },  /* circled white bullet */
+	{ "olcross",                          10683 },  /* circle with superimposed x */
+	{ "oline",                             8254 },  /* overline */
+	{ "olt",                              10688 },  /* circled less-than */
+	{ "omacr",                              333 },  /* latin small letter o with macron */
+	{ "omega",                              969 },  /* small omega */
+	{ "omicron",                            959 },  /* small omicron */
+	{ "omid",                             10678 },  /* circled vertical bar */
+	{ "ominus",                            8854 },  /* circled minus */
+	{ "oopf",                            120160 },  /* mathematical double-struck small o */
+	{ "opar",                             10679 },  /* circled parallel */
+	{ "operp",                            10681 },  /* circled perpendicular */
+	{ "oplus",                             8853 },  /* circled plus = direct sum */
+	{ "or",                                8744 },  /* logical or */
+	{ "orarr",                             8635 },  /* clockwise open circle arrow */
+	{ "ord",                              10845 },  /* logical or with horizontal dash */
+	{ "order",                             8500 },  /* script small o */
+	{ "orderof",                           8500 },  /* script small o */
+	{ "ordf",                               170 },  /* feminine ordinal indicator */
+	{ "ordm",                               186 },  /* masculine ordinal indicator */
+	{ "origof",                            8886 },  /* original of */
+	{ "oror",                             10838 },  /* two intersecting logical or */
+	{ "orslope",                          10839 },  /* sloping large or */
+	{ "orv",                              10843 },  /* logical or with middle stem */
+	{ "oscr",                              8500 },  /* script small o */
+	{ "oslash",                             248 },  /* small o with slash */
+	{ "osol",                              8856 },  /* circled division slash */
+	{ "otilde",                             245 },  /* small o with tilde */
+	{ "otimes",                            8855 },  /* circled times = vec prod */
+	{ "otimesas",                         10806 },  /* circled multiplication sign with circumflex accent */
+	{ "ouml",                               246 },  /* small o with diaeresis */
+	{ "ovbar",                             9021 },  /* apl functional symbol circle stile */
+	{ "par",                               8741 },  /* parallel to */
+	{ "para",                               182 },  /* pilcrow (paragraph) sign */
+	{ "parallel",                          8741 },  /* parallel to */
+	{ "parsim",                           10995 },  /* parallel with tilde operator */
+	{ "parsl",                            11005 },  /* double solidus operator */
+	{ "part",                              8706 },  /* partial differential */
+	{ "pcy",                               1087 },  /* cyrillic small letter pe */
+	{ "percnt",                              37 },  /* percent sign */
+	{ "period",                              46 },  /* full stop */
+	{ "permil",                            8240 },  /* per mille sign */
+	{ "perp",                              8869 },  /* perpendicular */
+	{ "pertenk",                           8241 },  /* per ten thousand sign */
+	{ "pfr",                             120109 },  /* mathematical fraktur small p */
+	{ "phi",                                966 },  /* small phi */
+	{ "phiv",                               981 },  /* greek phi symbol */
+	{ "phmmat",                            8499 },  /* script capital m */
+	{ "phone",                             9742 },  /* black telephone */
+	{ "pi",                                 960 },  /* small pi */
+	{ "pitchfork",                         8916 },  /* pitchfork */
+	{ "piv",                                982 },  /* pi symbol */
+	{ "planck",                            8463 },  /* planck constant over two pi */
+	{ "planckh",                           8462 },  /* planck constant */
+	{ "plankv",                            8463 },  /* planck constant over two pi */
+	{ "plus",                                43 },  /* plus sign */
+	{ "plusacir",                         10787 },  /* plus sign with circumflex accent above */
+	{ "plusb",                             8862 },  /* squared plus */
+	{ "pluscir",                          10786 },  /* plus sign with small circle above */
+	{ "plusdo",                            8724 },  /* dot plus */
+	{ "plusdu",                           10789 },  /* plus sign with dot below */
+	{ "pluse",                            10866 },  /* plus sign above equals sign */
+	{ "plusmn",                             177 },  /* plus-minus sign */
+	{ "plussim",                          10790 },  /* plus sign with tilde below */
+	{ "plustwo",                          10791 },  /* plus sign with subscript two */
+	{ "pm",                                 177 },  /* plus-minus sign */
+	{ "pointint",                         10773 },  /* integral around a point operator */
+	{ "popf",                            120161 },  /* mathematical double-struck small p */
+	{ "pound",                              163 },  /* pound sign */
+	{ "pr",                                8826 },  /* precedes */
+	{ "prE",                              10931 },  /* precedes above equals sign */
+	{ "prap",                             10935 },  /* precedes above almost equal to */
+	{ "prcue",                             8828 },  /* precedes or equal to */
+	{ "pre",                              10927 },  /* precedes above single-line equals sign */
+	{ "prec",                              8826 },  /* precedes */
+	{ "precapprox",                       10935 },  /* precedes above almost equal to */
+	{ "preccurlyeq",                       8828 },  /* precedes or equal to */
+	{ "preceq",                           10927 },  /* precedes above single-line equals sign */
+	{ "precnapprox",                      10937 },  /* precedes above not almost equal to */
+	{ "precneqq",                         10933 },  /* precedes above not equal to */
+	{ "precnsim",                          8936 },  /* precedes but not equivalent to */
+	{ "precsim",                           8830 },  /* precedes or equivalent to */
+	{ "prime",                             8242 },  /* prime = minutes = feet */
+	{ "primes",                            8473 },  /* double-struck capital p */
+	{ "prnE",                             10933 },  /* precedes above not equal to */
+	{ "prnap",                            10937 },  /* precedes above not almost equal to */
+	{ "prnsim",                            8936 },  /* precedes but not equivalent to */
+	{ "prod",                              8719 },  /* n-ary product */
+	{ "profalar",                          9006 },  /* all around-profile */
+	{ "profline",                          8978 },  /* arc */
+	{ "profsurf",                          8979 },  /* segment */
+	{ "prop",                              8733 },  /* proportional to */
+	{ "propto",                            8733 },  /* proportional to */
+	{ "prsim",                             8830 },  /* precedes or equivalent to */
+	{ "prurel",                            8880 },  /* precedes under relation */
+	{ "pscr",                            120005 },  /* mathematical script small p */
+	{ "psi",                                968 },  /* small psi */
+	{ "puncsp",                            8200 },  /* punctuation space */
+	{ "qfr",                             120110 },  /* mathematical fraktur small q */
+	{ "qint",                             10764 },  /* quadruple integral operator */
+	{ "qopf",                            120162 },  /* mathematical double-struck small q */
+	{ "qprime",                            8279 },  /* quadruple prime */
+	{ "qscr",                            120006 },  /* mathematical script small q */
+	{ "quaternions",                       8461 },  /* double-struck capital h */
+	{ "quatint",                          10774 },  /* quaternion integral operator */
+	{ "quest",                               63 },  /* question mark */
+	{ "questeq",                           8799 },  /* questioned equal to */
+	{ "quot",                                34 },  /* quotation mark */
+	{ "rAarr",                             8667 },  /* rightwards triple arrow */
+	{ "rArr",                              8658 },  /* up double arrow */
+	{ "rAtail",                           10524 },  /* rightwards double arrow-tail */
+	{ "rBarr",                            10511 },  /* rightwards triple dash arrow */
+	{ "rHar",                             10596 },  /* rightwards harpoon with barb up above rightwards harpoon with barb down */
+	{ "racute",                             341 },  /* latin small letter r with acute */
+	{ "radic",                             8730 },  /* square root */
+	{ "raemptyv",                         10675 },  /* empty set with right arrow above */
+	{ "rang",                              9002 },  /* right angle bracket */
+	{ "rangd",                            10642 },  /* right angle bracket with dot */
+	{ "range",                            10661 },  /* reversed angle with underbar */
+	{ "rangle",                           10217 },  /* mathematical right angle bracket */
+	{ "raquo",                              187 },  /* right pointing guillemet */
+	{ "rarr",                              8594 },  /* right arrow */
+	{ "rarrap",                           10613 },  /* rightwards arrow above almost equal to */
+	{ "rarrb",                             8677 },  /* rightwards arrow to bar */
+	{ "rarrbfs",                          10528 },  /* rightwards arrow from bar to black diamond */
+	{ "rarrc",                            10547 },  /* wave arrow pointing directly right */
+	{ "rarrfs",                           10526 },  /* rightwards arrow to black diamond */
+	{ "rarrhk",                            8618 },  /* rightwards arrow with hook */
+	{ "rarrlp",                            8620 },  /* rightwards arrow with loop */
+	{ "rarrpl",                           10565 },  /* rightwards arrow with plus below */
+	{ "rarrsim",                          10612 },  /* rightwards arrow above tilde operator */
+	{ "rarrtl",                            8611 },  /* rightwards arrow with tail */
+	{ "rarrw",                             8605 },  /* rightwards wave arrow */
+	{ "ratail",                           10522 },  /* rightwards arrow-tail */
+	{ "ratio",                             8758 },  /* ratio */
+	{ "rationals",                         8474 },  /* double-struck capital q */
+	{ "rbarr",                            10509 },  /* rightwards double dash arrow */
+	{ "rbbrk",                            10099 },  /* light right tortoise shell bracket ornament */
+	{ "rbrace",                             125 },  /* right curly bracket */
+	{ "rbrack",                              93 },  /* right square bracket */
+	{ "rbrke",                            10636 },  /* right square bracket with underbar */
+	{ "rbrksld",                          10638 },  /* right square bracket with tick in bottom corner */
+	{ "rbrkslu",                          10640 },  /* right square bracket with tick in top corner */
+	{ "rcaron",                             345 },  /* latin small letter r with caron */
+	{ "rcedil",                             343 },  /* latin small letter r with cedilla */
+	{ "rceil",                             8969 },  /* right ceiling */
+	{ "rcub",                               125 },  /* right curly bracket */
+	{ "rcy",                               1088 },  /* cyrillic small letter er */
+	{ "rdca",                             10551 },  /* arrow pointing downwards then curving rightwards */
+	{ "rdldhar",                          10601 },  /* rightwards harpoon with barb down above leftwards harpoon with barb down */
+	{ "rdquo",                             8221 },  /* right double quot. mark */
+	{ "rdquor",                            8221 },  /* right double quotation mark */
+	{ "rdsh",                              8627 },  /* downwards arrow with tip rightwards */
+	{ "real",                              8476 },  /* real part-black cap R */
+	{ "realine",                           8475 },  /* script capital r */
+	{ "realpart",                          8476 },  /* black-letter capital r */
+	{ "reals",                             8477 },  /* double-struck capital r */
+	{ "rect",                              9645 },  /* white rectangle */
+	{ "reg",                                174 },  /* registered sign */
+	{ "rfisht",                           10621 },  /* right fish tail */
+	{ "rfloor",                            8971 },  /* right floor */
+	{ "rfr",                             120111 },  /* mathematical fraktur small r */
+	{ "rhard",                             8641 },  /* rightwards harpoon with barb downwards */
+	{ "rharu",                             8640 },  /* rightwards harpoon with barb upwards */
+	{ "rharul",                           10604 },  /* rightwards harpoon with barb up above long dash */
+	{ "rho",                                961 },  /* small rho */
+	{ "rhov",                              1009 },  /* greek rho symbol */
+	{ "rightarrow",                        8594 },  /* rightwards arrow */
+	{ "rightarrowtail",                    8611 },  /* rightwards arrow with tail */
+	{ "rightharpoondown",                  8641 },  /* rightwards harpoon with barb downwards */
+	{ "rightharpoonup",                    8640 },  /* rightwards harpoon with barb upwards */
+	{ "rightleftarrows",                   8644 },  /* rightwards arrow over leftwards arrow */
+	{ "rightleftharpoons",                 8652 },  /* rightwards harpoon over leftwards harpoon */
+	{ "rightrightarrows",                  8649 },  /* rightwards paired arrows */
+	{ "rightsquigarrow",                   8605 },  /* rightwards wave arrow */
+	{ "rightthreetimes",                   8908 },  /* right semidirect product */
+	{ "ring",                               730 },  /* ring above */
+	{ "risingdotseq",                      8787 },  /* image of or approximately equal to */
+	{ "rlarr",                             8644 },  /* rightwards arrow over leftwards arrow */
+	{ "rlhar",                             8652 },  /* rightwards harpoon over leftwards harpoon */
+	{ "rlm",                               8207 },  /* right-to-left mark */
+	{ "rmoust",                            9137 },  /* upper right or lower left curly bracket section */
+	{ "rmoustache",                        9137 },  /* upper right or lower left curly bracket section */
+	{ "rnmid",                            10990 },  /* does not divide with reversed negation slash */
+	{ "roang",                            10221 },  /* mathematical right white tortoise shell bracket */
+	{ "roarr",                             8702 },  /* rightwards open-headed arrow */
+	{ "robrk",                            10215 },  /* mathematical right white square bracket */
+	{ "ropar",                            10630 },  /* right white parenthesis */
+	{ "ropf",                            120163 },  /* mathematical double-struck small r */
+	{ "roplus",                           10798 },  /* plus sign in right half circle */
+	{ "rotimes",                          10805 },  /* multiplication sign in right half circle */
+	{ "rpar",                                41 },  /* right parenthesis */
+	{ "rpargt",                           10644 },  /* right arc greater-than bracket */
+	{ "rppolint",                         10770 },  /* line integration with rectangular path around pole */
+	{ "rrarr",                             8649 },  /* rightwards paired arrows */
+	{ "rsaquo",                            8250 },  /* sin. right angle quot mark */
+	{ "rscr",                            120007 },  /* mathematical script small r */
+	{ "rsh",                               8625 },  /* upwards arrow with tip rightwards */
+	{ "rsqb",                                93 },  /* right square bracket */
+	{ "rsquo",                             8217 },  /* right single quot. mark */
+	{ "rsquor",                            8217 },  /* right single quotation mark */
+	{ "rthree",                            8908 },  /* right semidirect product */
+	{ "rtimes",                            8906 },  /* right normal factor semidirect product */
+	{ "rtri",                              9657 },  /* white right-pointing small triangle */
+	{ "rtrie",                             8885 },  /* contains as normal subgroup or equal to */
+	{ "rtrif",                             9656 },  /* black right-pointing small triangle */
+	{ "rtriltri",                         10702 },  /* right triangle above left triangle */
+	{ "ruluhar",                          10600 },  /* rightwards harpoon with barb up above leftwards harpoon with barb up */
+	{ "rx",                                8478 },  /* prescription take */
+	{ "sacute",                             347 },  /* latin small letter s with acute */
+	{ "sbquo",                             8218 },  /* single low-9 quot. mark */
+	{ "sc",                                8827 },  /* succeeds */
+	{ "scE",                              10932 },  /* succeeds above equals sign */
+	{ "scap",                             10936 },  /* succeeds above almost equal to */
+	{ "scaron",                             353 },  /* Latin cap S with caron */
+	{ "sccue",                             8829 },  /* succeeds or equal to */
+	{ "sce",                              10928 },  /* succeeds above single-line equals sign */
+	{ "scedil",                             351 },  /* latin small letter s with cedilla */
+	{ "scirc",                              349 },  /* latin small letter s with circumflex */
+	{ "scnE",                             10934 },  /* succeeds above not equal to */
+	{ "scnap",                            10938 },  /* succeeds above not almost equal to */
+	{ "scnsim",                            8937 },  /* succeeds but not equivalent to */
+	{ "scpolint",                         10771 },  /* line integration with semicircular path around pole */
+	{ "scsim",                             8831 },  /* succeeds or equivalent to */
+	{ "scy",                               1089 },  /* cyrillic small letter es */
+	{ "sdot",                              8901 },  /* dot operator */
+	{ "sdotb",                             8865 },  /* squared dot operator */
+	{ "sdote",                            10854 },  /* equals sign with dot below */
+	{ "seArr",                             8664 },  /* south east double arrow */
+	{ "searhk",                           10533 },  /* south east arrow with hook */
+	{ "searr",                             8600 },  /* south east arrow */
+	{ "searrow",                           8600 },  /* south east arrow */
+	{ "sect",                               167 },  /* section sign */
+	{ "semi",                                59 },  /* semicolon */
+	{ "seswar",                           10537 },  /* south east arrow and south west arrow */
+	{ "setminus",                          8726 },  /* set minus */
+	{ "setmn",                             8726 },  /* set minus */
+	{ "sext",                             10038 },  /* six pointed black star */
+	{ "sfr",                             120112 },  /* mathematical fraktur small s */
+	{ "sfrown",                            8994 },  /* frown */
+	{ "sharp",                             9839 },  /* music sharp sign */
+	{ "shchcy",                            1097 },  /* cyrillic small letter shcha */
+	{ "shcy",                              1096 },  /* cyrillic small letter sha */
+	{ "shortmid",                          8739 },  /* divides */
+	{ "shortparallel",                     8741 },  /* parallel to */
+	{ "shy",                                173 },  /* soft (discretionary) hyphen */
+	{ "sigma",                              963 },  /* small simga */
+	{ "sigmaf",                             962 },  /* small final sigma */
+	{ "sigmav",                             962 },  /* greek small letter final sigma */
+	{ "sim",                               8764 },  /* tilde operator */
+	{ "simdot",                           10858 },  /* tilde operator with dot above */
+	{ "sime",                              8771 },  /* asymptotically equal to */
+	{ "simeq",                             8771 },  /* asymptotically equal to */
+	{ "simg",                             10910 },  /* similar or greater-than */
+	{ "simgE",                            10912 },  /* similar above greater-than above equals sign */
+	{ "siml",                             10909 },  /* similar or less-than */
+	{ "simlE",                            10911 },  /* similar above less-than above equals sign */
+	{ "simne",                             8774 },  /* approximately but not actually equal to */
+	{ "simplus",                          10788 },  /* plus sign with tilde above */
+	{ "simrarr",                          10610 },  /* tilde operator above rightwards arrow */
+	{ "slarr",                             8592 },  /* leftwards arrow */
+	{ "smallsetminus",                     8726 },  /* set minus */
+	{ "smashp",                           10803 },  /* smash product */
+	{ "smeparsl",                         10724 },  /* equals sign and slanted parallel with tilde above */
+	{ "smid",                              8739 },  /* divides */
+	{ "smile",                             8995 },  /* smile */
+	{ "smt",                              10922 },  /* smaller than */
+	{ "smte",                             10924 },  /* smaller than or equal to */
+	{ "softcy",                            1100 },  /* cyrillic small letter soft sign */
+	{ "sol",                                 47 },  /* solidus */
+	{ "solb",                             10692 },  /* squared rising diagonal slash */
+	{ "solbar",                            9023 },  /* apl functional symbol slash bar */
+	{ "sopf",                            120164 },  /* mathematical double-struck small s */
+	{ "spades",                            9824 },  /* spades */
+	{ "spadesuit",                         9824 },  /* black spade suit */
+	{ "spar",                              8741 },  /* parallel to */
+	{ "sqcap",                             8851 },  /* square cap */
+	{ "sqcup",                             8852 },  /* square cup */
+	{ "sqsub",                             8847 },  /* square image of */
+	{ "sqsube",                            8849 },  /* square image of or equal to */
+	{ "sqsubset",                          8847 },  /* square image of */
+	{ "sqsubseteq",                        8849 },  /* square image of or equal to */
+	{ "sqsup",                             8848 },  /* square original of */
+	{ "sqsupe",                            8850 },  /* square original of or equal to */
+	{ "sqsupset",                          8848 },  /* square original of */
+	{ "sqsupseteq",                        8850 },  /* square original of or equal to */
+	{ "squ",                               9633 },  /* white square */
+	{ "square",                            9633 },  /* white square */
+	{ "squarf",                            9642 },  /* black small square */
+	{ "squf",                              9642 },  /* black small square */
+	{ "srarr",                             8594 },  /* rightwards arrow */
+	{ "sscr",                            120008 },  /* mathematical script small s */
+	{ "ssetmn",                            8726 },  /* set minus */
+	{ "ssmile",                            8995 },  /* smile */
+	{ "sstarf",                            8902 },  /* star operator */
+	{ "star",                              9734 },  /* white star */
+	{ "starf",                             9733 },  /* black star */
+	{ "straightepsilon",                   1013 },  /* greek lunate epsilon symbol */
+	{ "straightphi",                        981 },  /* greek phi symbol */
+	{ "strns",                              175 },  /* macron */
+	{ "sub",                               8834 },  /* subset of */
+	{ "subE",                             10949 },  /* subset of above equals sign */
+	{ "subdot",                           10941 },  /* subset with dot */
+	{ "sube",                              8838 },  /* subset of or equal to */
+	{ "subedot",                          10947 },  /* subset of or equal to with dot above */
+	{ "submult",                          10945 },  /* subset with multiplication sign below */
+	{ "subnE",                            10955 },  /* subset of above not equal to */
+	{ "subne",                             8842 },  /* subset of with not equal to */
+	{ "subplus",                          10943 },  /* subset with plus sign below */
+	{ "subrarr",                          10617 },  /* subset above rightwards arrow */
+	{ "subset",                            8834 },  /* subset of */
+	{ "subseteq",                          8838 },  /* subset of or equal to */
+	{ "subseteqq",                        10949 },  /* subset of above equals sign */
+	{ "subsetneq",                         8842 },  /* subset of with not equal to */
+	{ "subsetneqq",                       10955 },  /* subset of above not equal to */
+	{ "subsim",                           10951 },  /* subset of above tilde operator */
+	{ "subsub",                           10965 },  /* subset above subset */
+	{ "subsup",                           10963 },  /* subset above superset */
+	{ "succ",                              8827 },  /* succeeds */
+	{ "succapprox",                       10936 },  /* succeeds above almost equal to */
+	{ "succcurlyeq",                       8829 },  /* succeeds or equal to */
+	{ "succeq",                           10928 },  /* succeeds above single-line equals sign */
+	{ "succnapprox",                      10938 },  /* succeeds above not almost equal to */
+	{ "succneqq",                         10934 },  /* succeeds above not equal to */
+	{ "succnsim",                          8937 },  /* succeeds but not equivalent to */
+	{ "succsim",                           8831 },  /* succeeds or equivalent to */
+	{ "sum",                               8721 },  /* n-ary summation */
+	{ "sung",                              9834 },  /* eighth note */
+	{ "sup",                               8835 },  /* superset of */
+	{ "sup1",                               185 },  /* superscript one */
+	{ "sup2",                               178 },  /* superscript two */
+	{ "sup3",                               179 },  /* superscript three */
+	{ "supE",                             10950 },  /* superset of above equals sign */
+	{ "supdot",                           10942 },  /* superset with dot */
+	{ "supdsub",                          10968 },  /* superset beside and joined by dash with subset */
+	{ "supe",                              8839 },  /* superset of or equal to */
+	{ "supedot",                          10948 },  /* superset of or equal to with dot above */
+	{ "suphsol",                          10185 },  /* superset preceding solidus */
+	{ "suphsub",                          10967 },  /* superset beside subset */
+	{ "suplarr",                          10619 },  /* superset above leftwards arrow */
+	{ "supmult",                          10946 },  /* superset with multiplication sign below */
+	{ "supnE",                            10956 },  /* superset of above not equal to */
+	{ "supne",                             8843 },  /* superset of with not equal to */
+	{ "supplus",                          10944 },  /* superset with plus sign below */
+	{ "supset",                            8835 },  /* superset of */
+	{ "supseteq",                          8839 },  /* superset of or equal to */
+	{ "supseteqq",                        10950 },  /* superset of above equals sign */
+	{ "supsetneq",                         8843 },  /* superset of with not equal to */
+	{ "supsetneqq",                       10956 },  /* superset of above not equal to */
+	{ "supsim",                           10952 },  /* superset of above tilde operator */
+	{ "supsub",                           10964 },  /* superset above subset */
+	{ "supsup",                           10966 },  /* superset above superset */
+	{ "swArr",                             8665 },  /* south west double arrow */
+	{ "swarhk",                           10534 },  /* south west arrow with hook */
+	{ "swarr",                             8601 },  /* south west arrow */
+	{ "swarrow",                           8601 },  /* south west arrow */
+	{ "swnwar",                           10538 },  /* south west arrow and north west arrow */
+	{ "szlig",                              223 },  /* small sharp s = ess-zed */
+	{ "target",                            8982 },  /* position indicator */
+	{ "tau",                                964 },  /* small tau */
+	{ "tbrk",                              9140 },  /* top square bracket */
+	{ "tcaron",                             357 },  /* latin small letter t with caron */
+	{ "tcedil",                             355 },  /* latin small letter t with cedilla */
+	{ "tcy",                               1090 },  /* cyrillic small letter te */
+	{ "tdot",                              8411 },  /* combining three dots above */
+	{ "telrec",                            8981 },  /* telephone recorder */
+	{ "tfr",                             120113 },  /* mathematical fraktur small t */
+	{ "there4",                            8756 },  /* therefore */
+	{ "therefore",                         8756 },  /* therefore */
+	{ "theta",                              952 },  /* small theta */
+	{ "thetasym",                           977 },  /* small theta symbol */
+	{ "thetav",                             977 },  /* greek theta symbol */
+	{ "thickapprox",                       8776 },  /* almost equal to */
+	{ "thicksim",                          8764 },  /* tilde operator */
+	{ "thinsp",                            8201 },  /* thin space */
+	{ "thkap",                             8776 },  /* almost equal to */
+	{ "thksim",                            8764 },  /* tilde operator */
+	{ "thorn",                              254 },  /* latin small letter thorn */
+	{ "tilde",                              732 },  /* small tilde */
+	{ "times",                              215 },  /* multiplication sign */
+	{ "timesb",                            8864 },  /* squared times */
+	{ "timesbar",                         10801 },  /* multiplication sign with underbar */
+	{ "timesd",                           10800 },  /* multiplication sign with dot above */
+	{ "tint",                              8749 },  /* triple integral */
+	{ "toea",                             10536 },  /* north east arrow and south east arrow */
+	{ "top",                               8868 },  /* down tack */
+	{ "topbot",                            9014 },  /* apl functional symbol i-beam */
+	{ "topcir",                           10993 },  /* down tack with circle below */
+	{ "topf",                            120165 },  /* mathematical double-struck small t */
+	{ "topfork",                          10970 },  /* pitchfork with tee top */
+	{ "tosa",                             10537 },  /* south east arrow and south west arrow */
+	{ "tprime",                            8244 },  /* triple prime */
+	{ "trade",                             8482 },  /* trademark sign */
+	{ "triangle",                          9653 },  /* white up-pointing small triangle */
+	{ "triangledown",                      9663 },  /* white down-pointing small triangle */
+	{ "triangleleft",                      9667 },  /* white left-pointing small triangle */
+	{ "trianglelefteq",                    8884 },  /* normal subgroup of or equal to */
+	{ "triangleq",                         8796 },  /* delta equal to */
+	{ "triangleright",                     9657 },  /* white right-pointing small triangle */
+	{ "trianglerighteq",                   8885 },  /* contains as normal subgroup or equal to */
+	{ "tridot",                            9708 },  /* white up-pointing triangle with dot */
+	{ "trie",                              8796 },  /* delta equal to */
+	{ "triminus",                         10810 },  /* minus sign in triangle */
+	{ "triplus",                          10809 },  /* plus sign in triangle */
+	{ "trisb",                            10701 },  /* triangle with serifs at bottom */
+	{ "tritime",                          10811 },  /* multiplication sign in triangle */
+	{ "trpezium",                          9186 },  /* white trapezium */
+	{ "tscr",                            120009 },  /* mathematical script small t */
+	{ "tscy",                              1094 },  /* cyrillic small letter tse */
+	{ "tshcy",                             1115 },  /* cyrillic small letter tshe */
+	{ "tstrok",                             359 },  /* latin small letter t with stroke */
+	{ "twixt",                             8812 },  /* between */
+	{ "twoheadleftarrow",                  8606 },  /* leftwards two headed arrow */
+	{ "twoheadrightarrow",                 8608 },  /* rightwards two headed arrow */
+	{ "uArr",                              8657 },  /* up double arrow */
+	{ "uHar",                             10595 },  /* upwards harpoon with barb left beside upwards harpoon with barb right */
+	{ "uacute",                             250 },  /* small u with acute */
+	{ "uarr",                              8593 },  /* up arrow */
+	{ "ubrcy",                             1118 },  /* cyrillic small letter short u */
+	{ "ubreve",                             365 },  /* latin small letter u with breve */
+	{ "ucirc",                              251 },  /* small u with circumflex */
+	{ "ucy",                               1091 },  /* cyrillic small letter u */
+	{ "udarr",                             8645 },  /* upwards arrow leftwards of downwards arrow */
+	{ "udblac",                             369 },  /* latin small letter u with double acute */
+	{ "udhar",                            10606 },  /* upwards harpoon with barb left beside downwards harpoon with barb right */
+	{ "ufisht",                           10622 },  /* up fish tail */
+	{ "ufr",                             120114 },  /* mathematical fraktur small u */
+	{ "ugrave",                             249 },  /* small u with grave */
+	{ "uharl",                             8639 },  /* upwards harpoon with barb leftwards */
+	{ "uharr",                             8638 },  /* upwards harpoon with barb rightwards */
+	{ "uhblk",                             9600 },  /* upper half block */
+	{ "ulcorn",                            8988 },  /* top left corner */
+	{ "ulcorner",                          8988 },  /* top left corner */
+	{ "ulcrop",                            8975 },  /* top left crop */
+	{ "ultri",                             9720 },  /* upper left triangle */
+	{ "umacr",                              363 },  /* latin small letter u with macron */
+	{ "uml",                                168 },  /* diaeresis - spacing diaeresis */
+	{ "uogon",                              371 },  /* latin small letter u with ogonek */
+	{ "uopf",                            120166 },  /* mathematical double-struck small u */
+	{ "uparrow",                           8593 },  /* upwards arrow */
+	{ "updownarrow",                       8597 },  /* up down arrow */
+	{ "upharpoonleft",                     8639 },  /* upwards harpoon with barb leftwards */
+	{ "upharpoonright",                    8638 },  /* upwards harpoon with barb rightwards */
+	{ "uplus",                             8846 },  /* multiset union */
+	{ "upsi",                               965 },  /* greek small letter upsilon */
+	{ "upsih",                              978 },  /* small upsilon with hook */
+	{ "upsilon",                            965 },  /* small upsilon */
+	{ "upuparrows",                        8648 },  /* upwards paired arrows */
+	{ "urcorn",                            8989 },  /* top right corner */
+	{ "urcorner",                          8989 },  /* top right corner */
+	{ "urcrop",                            8974 },  /* top right crop */
+	{ "uring",                              367 },  /* latin small letter u with ring above */
+	{ "urtri",                             9721 },  /* upper right triangle */
+	{ "uscr",                            120010 },  /* mathematical script small u */
+	{ "utdot",                             8944 },  /* up right diagonal ellipsis */
+	{ "utilde",                             361 },  /* latin small letter u with tilde */
+	{ "utri",                              9653 },  /* white up-pointing small triangle */
+	{ "utrif",                             9652 },  /* black up-pointing small triangle */
+	{ "uuarr",                             8648 },  /* upwards paired arrows */
+	{ "uuml",                               252 },  /* small u with diaeresis */
+	{ "uwangle",                          10663 },  /* oblique angle opening down */
+	{ "vArr",                              8661 },  /* up down double arrow */
+	{ "vBar",                             10984 },  /* short up tack with underbar */
+	{ "vBarv",                            10985 },  /* short up tack above short down tack */
+	{ "vDash",                             8872 },  /* true */
+	{ "vangrt",                           10652 },  /* right angle variant with square */
+	{ "varepsilon",                        1013 },  /* greek lunate epsilon symbol */
+	{ "varkappa",                          1008 },  /* greek kappa symbol */
+	{ "varnothing",                        8709 },  /* empty set */
+	{ "varphi",                             981 },  /* greek phi symbol */
+	{ "varpi",                              982 },  /* greek pi symbol */
+	{ "varpropto",                         8733 },  /* proportional to */
+	{ "varr",                              8597 },  /* up down arrow */
+	{ "varrho",                            1009 },  /* greek rho symbol */
+	{ "varsigma",                           962 },  /* greek small letter final sigma */
+	{ "vartheta",                           977 },  /* greek theta symbol */
+	{ "vartriangleleft",                   8882 },  /* normal subgroup of */
+	{ "vartriangleright",                  8883 },  /* contains as normal subgroup */
+	{ "vcy",                               1074 },  /* cyrillic small letter ve */
+	{ "vdash",                             8866 },  /* right tack */
+	{ "vee",                               8744 },  /* logical or */
+	{ "veebar",                            8891 },  /* xor */
+	{ "veeeq",                             8794 },  /* equiangular to */
+	{ "vellip",                            8942 },  /* vertical ellipsis */
+	{ "verbar",                             124 },  /* vertical line */
+	{ "vert",                               124 },  /* vertical line */
+	{ "vfr",                             120115 },  /* mathematical fraktur small v */
+	{ "vltri",                             8882 },  /* normal subgroup of */
+	{ "vopf",                            120167 },  /* mathematical double-struck small v */
+	{ "vprop",                             8733 },  /* proportional to */
+	{ "vrtri",                             8883 },  /* contains as normal subgroup */
+	{ "vscr",                            120011 },  /* mathematical script small v */
+	{ "vzigzag",                          10650 },  /* vertical zigzag line */
+	{ "wcirc",                              373 },  /* latin small letter w with circumflex */
+	{ "wedbar",                           10847 },  /* logical and with underbar */
+	{ "wedge",                             8743 },  /* logical and */
+	{ "wedgeq",                            8793 },  /* estimates */
+	{ "weierp",                            8472 },  /* Weierstrass p = power set */
+	{ "wfr",                             120116 },  /* mathematical fraktur small w */
+	{ "wopf",                            120168 },  /* mathematical double-struck small w */
+	{ "wp",                                8472 },  /* script capital p */
+	{ "wr",                                8768 },  /* wreath product */
+	{ "wreath",                            8768 },  /* wreath product */
+	{ "wscr",                            120012 },  /* mathematical script small w */
+	{ "xcap",                              8898 },  /* n-ary intersection */
+	{ "xcirc",                             9711 },  /* large circle */
+	{ "xcup",                              8899 },  /* n-ary union */
+	{ "xdtri",                             9661 },  /* white down-pointing triangle */
+	{ "xfr",                             120117 },  /* mathematical fraktur small x */
+	{ "xhArr",                            10234 },  /* long left right double arrow */
+	{ "xharr",                            10231 },  /* long left right arrow */
+	{ "xi",                                 958 },  /* small xi */
+	{ "xlArr",                            10232 },  /* long leftwards double arrow */
+	{ "xlarr",                            10229 },  /* long leftwards arrow */
+	{ "xmap",                             10236 },  /* long rightwards arrow from bar */
+	{ "xnis",                              8955 },  /* contains with vertical bar at end of horizontal stroke */
+	{ "xodot",                            10752 },  /* n-ary circled dot operator */
+	{ "xopf",                            120169 },  /* mathematical double-struck small x */
+	{ "xoplus",                           10753 },  /* n-ary circled plus operator */
+	{ "xotime",                           10754 },  /* n-ary circled times operator */
+	{ "xrArr",                            10233 },  /* long rightwards double arrow */
+	{ "xrarr",                            10230 },  /* long rightwards arrow */
+	{ "xscr",                            120013 },  /* mathematical script small x */
+	{ "xsqcup",                           10758 },  /* n-ary square union operator */
+	{ "xuplus",                           10756 },  /* n-ary union operator with plus */
+	{ "xutri",                             9651 },  /* white up-pointing triangle */
+	{ "xvee",                              8897 },  /* n-ary logical or */
+	{ "xwedge",                            8896 },  /* n-ary logical and */
+	{ "yacute",                             253 },  /* small y with acute */
+	{ "yacy",                              1103 },  /* cyrillic small letter ya */
+	{ "ycirc",                              375 },  /* latin small letter y with circumflex */
+	{ "ycy",                               1099 },  /* cyrillic small letter yeru */
+	{ "yen",                                165 },  /* yen sign */
+	{ "yfr",                             120118 },  /* mathematical fraktur small y */
+	{ "yicy",                              1111 },  /* cyrillic small letter yi */
+	{ "yopf",                            120170 },  /* mathematical double-struck small y */
+	{ "yscr",                            120014 },  /* mathematical script small y */
+	{ "yucy",                              1102 },  /* cyrillic small letter yu */
+	{ "yuml",                               255 },  /* small y with diaeresis */
+	{ "zacute",                             378 },  /* latin small letter z with acute */
+	{ "zcaron",                             382 },  /* latin small letter z with caron */
+	{ "zcy",                               1079 },  /* cyrillic small letter ze */
+	{ "zdot",                               380 },  /* latin small letter z with dot above */
+	{ "zeetrf",                            8488 },  /* black-letter capital z */
+	{ "zeta",                               950 },  /* small zeta */
+	{ "zfr",                             120119 },  /* mathematical fraktur small z */
+	{ "zhcy",                              1078 },  /* cyrillic small letter zhe */
+	{ "zigrarr",                           8669 },  /* rightwards squiggle arrow */
+	{ "zopf",                            120171 },  /* mathematical double-struck small z */
+	{ "zscr",                            120015 },  /* mathematical script small z */
+	{ "zwj",                               8205 },  /* zero width joiner */
+	{ "zwnj",                              8204 },  /* zero width non-joiner */
 };
 
 
+/* html_entity_find()
+ *
+ * Returns the index of name in html_entities[], -1 if it's not there.
+ */
+static int
+html_entity_find( const char *name )
+{
+	int lo = 0, hi = sizeof( html_entities ) / sizeof( entities ) - 1;
+	int mid, cmp;
+	while ( lo <= hi ) {
+		mid = ( lo + hi ) / 2;
+		cmp = strcmp( name, html_entities[mid].name );
+		if ( cmp==0 ) return mid;
+		else if ( cmp < 0 ) hi = mid - 1;
+		else lo = mid + 1;
+	}
+	return -1;
+}
+
+/*
+ * decode html entity
+ *
+ *    extract a named entity from &name;
+ *    s[*pi] points to the '&' character
+ *
+ *    Names are case sensitive (&eacute; and &Eacute; differ), but
+ *    failing an exact match the name is tried in lower case, so that
+ *    the likes of &AMP; still work.
+ */
 static unsigned int
 decode_html_entity( char *s, unsigned int *pi, int *err )
 {
-	int nhtml_entities = sizeof( html_entities ) / sizeof( entities );
-	char *e;
-	int i, n=-1, len;
-	for ( i=0; i<nhtml_entities && n==-1; ++i ) {
-		e = &(html_entities[i].html[0]);
-		len = strlen( e );
-		if ( !strncasecmp( &(s[*pi]), e, len ) ) {
-			n = i;
-			*pi += len;
+	char name[ sizeof( html_entities[0].name ) ];
+	char *p = &(s[*pi+1]);
+	int i, n, len = 0;
+
+	while ( len < (int) sizeof( name ) - 1 && isalnum( (unsigned char) p[len] ) ) {
+		name[len] = p[len];
+		len++;
+	}
+	name[len] = '\0';
+
+	n = -1;
+	if ( len > 0 && p[len]==';' ) {
+		n = html_entity_find( name );
+		if ( n==-1 ) {
+			for ( i=0; i<len; ++i )
+				name[i] = tolower( (unsigned char) name[i] );
+			n = html_entity_find( name );
 		}
 	}
+
 	if ( n==-1 ) {
 		*err = 1;
 		return '&';
 	} else {
+		*pi += len + 2;
 		*err = 0;
 		return html_entities[n].unicode;
 	}
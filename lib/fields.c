@@ -9,8 +9,292 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdint.h>
+#include <limits.h>
 #include <string.h>
+#include <ctype.h>
 #include "fields.h"
+#include "intlist.h"
+#include "memstats.h"
+
+/*
+ * Tag atoms
+ *
+ * Tags come from a small vocabulary ("AUTHOR", "DATE:YEAR", ...) that
+ * repeats in every reference, so each distinct spelling is stored once
+ * in a process-wide table and fields keep only its index.  Spellings
+ * that differ only in case share a fold atom, so both the case-sensitive
+ * and the case-insensitive tag matches reduce to integer comparisons.
+ *
+ * Atoms are allocated individually and never freed, so the str returned
+ * by fields_tag() stays valid for the life of the program.
+ */
+typedef struct fields_atom {
+	str name;
+	int fold;   /* index of first atom matching name case-insensitively */
+} fields_atom;
+
+static fields_atom **atoms = NULL;
+static int natoms = 0, maxatoms = 0;
+
+/* open-addressed hash tables holding atom index + 1, 0 is empty */
+static int *atoms_exact  = NULL;
+static int *atoms_folded = NULL;
+static unsigned int atoms_nslots = 0;
+
+static unsigned int
+fields_atom_hash( const char *p, int fold )
+{
+	unsigned int h = 2166136261U;
+	unsigned char ch;
+	while ( *p ) {
+		ch = (unsigned char) *p++;
+		if ( fold ) ch = tolower( ch );
+		h ^= ch;
+		h *= 16777619U;
+	}
+	return h;
+}
+
+static void
+fields_atom_slot( int *table, int n, int fold )
+{
+	unsigned int h = fields_atom_hash( atoms[n]->name.data, fold ) & ( atoms_nslots - 1 );
+	while ( table[h] ) h = ( h + 1 ) & ( atoms_nslots - 1 );
+	table[h] = n + 1;
+}
+
+static int
+fields_atom_rehash( void )
+{
+	unsigned int nslots = ( atoms_nslots ) ? atoms_nslots * 2 : 256;
+	int i, *exact, *folded;
+
+	exact  = ( int * ) calloc( nslots, sizeof( int ) );
+	folded = ( int * ) calloc( nslots, sizeof( int ) );
+	if ( !exact || !folded ) {
+		if ( exact )  free( exact );
+		if ( folded ) free( folded );
+		return FIELDS_ERR;
+	}
+
+	if ( atoms_exact )  free( atoms_exact );
+	if ( atoms_folded ) free( atoms_folded );
+	atoms_exact  = exact;
+	atoms_folded = folded;
+	atoms_nslots = nslots;
+
+	for ( i=0; i<natoms; ++i ) {
+		fields_atom_slot( atoms_exact, i, 0 );
+		if ( atoms[i]->fold==i ) fields_atom_slot( atoms_folded, i, 1 );
+	}
+
+	return FIELDS_OK;
+}
+
+/* fields_atom_find()
+ *
+ * Return atom index for tag (case-insensitive match if fold is set,
+ * in which case the fold atom is returned), -1 if there isn't one.
+ */
+static int
+fields_atom_find( const char *tag, int fold )
+{
+	int *table = ( fold ) ? atoms_folded : atoms_exact;
+	unsigned int h;
+	int n;
+
+	if ( !atoms_nslots ) return -1;
+
+	h = fields_atom_hash( tag, fold ) & ( atoms_nslots - 1 );
+	while ( ( n = table[h] ) ) {
+		n--;
+		if ( fold ) {
+			if ( !strcasecmp( atoms[n]->name.data, tag ) ) return n;
+		} else {
+			if ( !strcmp( atoms[n]->name.data, tag ) ) return n;
+		}
+		h = ( h + 1 ) & ( atoms_nslots - 1 );
+	}
+	return -1;
+}
+
+/* fields_atom_add()
+ *
+ * Return atom index for tag, adding it if necessary, -1 on memory error.
+ */
+static int
+fields_atom_add( const char *tag )
+{
+	fields_atom **more, *a;
+	int n, alloc;
+
+	n = fields_atom_find( tag, 0 );
+	if ( n!=-1 ) return n;
+
+	if ( natoms >= maxatoms ) {
+		alloc = ( maxatoms ) ? maxatoms * 2 : 128;
+		more = ( fields_atom ** ) realloc( atoms, sizeof( fields_atom * ) * alloc );
+		if ( !more ) return -1;
+		atoms = more;
+		maxatoms = alloc;
+	}
+	if ( (unsigned int) ( 2 * ( natoms + 1 ) ) > atoms_nslots ) {
+		if ( fields_atom_rehash()!=FIELDS_OK ) return -1;
+	}
+
+	a = ( fields_atom * ) malloc( sizeof( fields_atom ) );
+	if ( !a ) return -1;
+	str_initstrc( &(a->name), tag );
+	if ( str_memerr( &(a->name) ) ) {
+		free( a );
+		return -1;
+	}
+	/* make sure an empty tag still has a C string */
+	if ( !a->name.data ) str_strcpyc( &(a->name), "" );
+
+	n = natoms;
+	a->fold = fields_atom_find( tag, 1 );
+	if ( a->fold==-1 ) a->fold = n;
+	atoms[ natoms++ ] = a;
+
+	fields_atom_slot( atoms_exact, n, 0 );
+	if ( a->fold==n ) fields_atom_slot( atoms_folded, n, 1 );
+
+	return n;
+}
+
+#define fields_fold( f, n ) ( atoms[ (f)->entry[n].tag ]->fold )
+
+/*
+ * Value pool
+ *
+ * Long-lived collections repeat the same values (journal titles,
+ * publishers, genres, languages...) in thousands of references.  After
+ * fields_intern(), an entry points at a reference-counted copy of its
+ * value shared through a process-wide pool instead of holding its own
+ * str.  The value is copied back into the entry the first time a str
+ * that may be changed is handed out for it.
+ */
+typedef struct fields_pooled {
+	unsigned int hash;
+	int refs;
+	int len;
+	char data[1];       /* allocated for len+1 */
+} fields_pooled;
+
+/* open-addressed hash table, deleted slots hold &pool_deleted */
+static fields_pooled **pool = NULL;
+static fields_pooled pool_deleted;
+static unsigned int pool_nslots = 0, pool_nused = 0, pool_nlive = 0;
+
+/* values not held in the entry's str, pooled or borrowed */
+#define fields_entry_len( e )  ( (e)->value ? (e)->len   : (e)->data.len )
+#define fields_entry_cstr( e ) ( (e)->value ? (e)->value : (e)->data.data )
+
+static unsigned int
+fields_pool_hash( const char *p, int len )
+{
+	unsigned int h = 2166136261U;
+	int i;
+	for ( i=0; i<len; ++i ) {
+		h ^= (unsigned char) p[i];
+		h *= 16777619U;
+	}
+	return h;
+}
+
+static int
+fields_pool_rehash( void )
+{
+	unsigned int i, h, nslots = 1024, mask;
+	fields_pooled **more;
+
+	while ( nslots < 4 * ( pool_nlive + 1 ) ) nslots *= 2;
+
+	more = ( fields_pooled ** ) calloc( nslots, sizeof( fields_pooled * ) );
+	if ( !more ) return FIELDS_ERR;
+	MEMSTATS_ALLOC( MEMSTATS_FIELDS, sizeof( fields_pooled * ) * nslots );
+
+	mask = nslots - 1;
+	for ( i=0; i<pool_nslots; ++i ) {
+		if ( !pool[i] || pool[i]==&pool_deleted ) continue;
+		h = pool[i]->hash & mask;
+		while ( more[h] ) h = ( h + 1 ) & mask;
+		more[h] = pool[i];
+	}
+
+	if ( pool ) {
+		free( pool );
+		MEMSTATS_FREE( MEMSTATS_FIELDS, sizeof( fields_pooled * ) * pool_nslots );
+	}
+	pool = more;
+	pool_nslots = nslots;
+	pool_nused = pool_nlive;
+
+	return FIELDS_OK;
+}
+
+/* fields_pool_get()
+ *
+ * Return a reference to the pooled copy of s, NULL on memory error.
+ */
+static fields_pooled *
+fields_pool_get( const char *s, int len )
+{
+	unsigned int h, hash, mask;
+	fields_pooled *v;
+	int free_slot = -1;
+
+	if ( 2 * ( pool_nused + 1 ) > pool_nslots ) {
+		if ( fields_pool_rehash()!=FIELDS_OK ) return NULL;
+	}
+
+	hash = fields_pool_hash( s, len );
+	mask = pool_nslots - 1;
+	h = hash & mask;
+	while ( ( v = pool[h] ) ) {
+		if ( v==&pool_deleted ) {
+			if ( free_slot==-1 ) free_slot = h;
+		} else if ( v->hash==hash && v->len==len && !memcmp( v->data, s, len ) ) {
+			v->refs++;
+			return v;
+		}
+		h = ( h + 1 ) & mask;
+	}
+
+	v = ( fields_pooled * ) malloc( sizeof( fields_pooled ) + len );
+	if ( !v ) return NULL;
+	MEMSTATS_ALLOC( MEMSTATS_FIELDS, sizeof( fields_pooled ) + len );
+	v->hash = hash;
+	v->refs = 1;
+	v->len  = len;
+	memcpy( v->data, s, len );
+	v->data[len] = '\0';
+
+	if ( free_slot!=-1 ) h = free_slot;
+	else pool_nused++;
+	pool[h] = v;
+	pool_nlive++;
+
+	return v;
+}
+
+static void
+fields_pool_release( fields_pooled *v )
+{
+	unsigned int h, mask;
+
+	if ( --(v->refs) > 0 ) return;
+
+	mask = pool_nslots - 1;
+	h = v->hash & mask;
+	while ( pool[h]!=v ) h = ( h + 1 ) & mask;
+	pool[h] = &pool_deleted;
+	pool_nlive--;
+
+	MEMSTATS_FREE( MEMSTATS_FIELDS, sizeof( fields_pooled ) + v->len );
+	free( v );
+}
 
 fields*
 fields_new( void )
@@ -23,11 +307,14 @@ fields_new( void )
 void
 fields_init( fields *f )
 {
-	f->used  = NULL;
-	f->level = NULL;
-	f->tag   = NULL;
-	f->data  = NULL;
+	f->entry = NULL;
 	f->max   = f->n = 0;
+	f->index = NULL;
+	f->nindex = f->maxindex = 0;
+	f->dups  = NULL;
+	f->ndups = f->nindups = f->maxdups = 0;
+	intlist_init( &(f->stale) );
+	str_init( &(f->record) );
 }
 
 void
@@ -35,75 +322,341 @@ fields_free( fields *f )
 {
 	int i;
 
-	for ( i=0; i<f->max; ++i ) {
-		str_free( &(f->tag[i]) );
-		str_free( &(f->data[i]) );
-	}
-	if ( f->tag )   free( f->tag );
-	if ( f->data )  free( f->data );
-	if ( f->used )  free( f->used );
-	if ( f->level ) free( f->level );
+	for ( i=0; i<f->n; ++i )
+		if ( f->entry[i].pooled ) fields_pool_release( f->entry[i].pooled );
+	for ( i=0; i<f->max; ++i )
+		str_free( &(f->entry[i].data) );
+	if ( f->entry ) free( f->entry );
+	if ( f->index ) free( f->index );
+	if ( f->dups )  free( f->dups );
+	MEMSTATS_FREE( MEMSTATS_FIELDS, sizeof( fields_entry ) * f->max + sizeof( fields_slot ) * f->maxindex + sizeof( int ) * f->maxdups );
+	intlist_free( &(f->stale) );
+	str_free( &(f->record) );
 
 	fields_init( f );
 }
 
+/* fields_reset()
+ *
+ * Empty the fields, but keep the memory of the entries, their strings
+ * and the record buffer for the next record. A zero-initialized (e.g.
+ * static) fields is the same as one after fields_init(), so it can be
+ * reset directly.
+ */
+void
+fields_reset( fields *f )
+{
+	int i;
+
+	for ( i=0; i<f->n; ++i ) {
+		if ( f->entry[i].pooled ) fields_pool_release( f->entry[i].pooled );
+		f->entry[i].pooled = NULL;
+	}
+
+	f->n = 0;
+	f->nindex = 0;
+	f->ndups = f->nindups = 0;
+	intlist_empty( &(f->stale) );
+}
+
 static int
 fields_alloc( fields *f )
 {
 	int i, alloc = 20;
 
-	f->tag   = (str *) malloc( sizeof(str) * alloc );
-	f->data  = (str *) malloc( sizeof(str) * alloc );
-	f->used  = (int *)    calloc( alloc, sizeof(int) );
-	f->level = (int *)    calloc( alloc, sizeof(int) );
-	if ( !f->tag || !f->data || !f->used || !f->level ){
-		if ( f->tag )   free( f->tag );
-		if ( f->data )  free( f->data );
-		if ( f->used )  free( f->used );
-		if ( f->level ) free( f->level );
-		fields_init( f );
-		return FIELDS_ERR;
-	}
+	f->entry = ( fields_entry * ) malloc( sizeof( fields_entry ) * alloc );
+	if ( !f->entry ) return FIELDS_ERR;
+	MEMSTATS_ALLOC( MEMSTATS_FIELDS, sizeof( fields_entry ) * alloc );
 
 	f->max = alloc;
 	f->n = 0;
-	for ( i=0; i<alloc; ++i ) {
-		str_init( &(f->tag[i]) );
-		str_init( &(f->data[i]) );
-	}
+	for ( i=0; i<alloc; ++i )
+		str_init( &(f->entry[i].data) );
 	return FIELDS_OK;
 }
 
 static int
 fields_realloc( fields *f )
 {
-	str *newtags, *newdata;
-	int *newused, *newlevel;
+	fields_entry *newentry;
 	int i, alloc = f->max * 2;
 
-	newtags = (str*) realloc( f->tag, sizeof(str) * alloc );
-	newdata = (str*) realloc( f->data, sizeof(str) * alloc );
-	newused = (int*)    realloc( f->used, sizeof(int) * alloc );
-	newlevel= (int*)    realloc( f->level, sizeof(int) * alloc );
-
-	if ( newtags )  f->tag   = newtags;
-	if ( newdata )  f->data  = newdata;
-	if ( newused )  f->used  = newused;
-	if ( newlevel ) f->level = newlevel;
-	
-	if ( !newtags || !newdata || !newused || !newlevel )
-		return FIELDS_ERR;
+	newentry = ( fields_entry * ) realloc( f->entry, sizeof( fields_entry ) * alloc );
+	if ( !newentry ) return FIELDS_ERR;
+	MEMSTATS_REALLOC( MEMSTATS_FIELDS, sizeof( fields_entry ) * f->max, sizeof( fields_entry ) * alloc );
+
+	f->entry = newentry;
+
+	for ( i=0; i<f->max; ++i )
+		str_relocate( &(f->entry[i].data) );
 
 	f->max = alloc;
 
-	for ( i=f->n; i<alloc; ++i ) {
-		str_init( &(f->tag[i]) );
-		str_init( &(f->data[i]) );
-	}
+	for ( i=f->n; i<alloc; ++i )
+		str_init( &(f->entry[i].data) );
 
 	return FIELDS_OK;
 }
 
+/*
+ * Tag lookup index
+ *
+ * Writers look up dozens of tags per reference, so once a reference
+ * has more than FIELDS_INDEX_MIN entries, the first lookup hashes every
+ * position by its fold atom.  Each slot records the first and last
+ * position of a fold atom and each entry links to the next one in between
+ * in order, so lookups visit exactly the entries that could match and
+ * still find them in the same order as a linear scan.  Levels are
+ * checked while walking the chain.
+ *
+ * Adding a field appends it to its chain; when the index runs out of
+ * room, it is dropped and rebuilt at the next lookup.
+ */
+#define FIELDS_INDEX_MIN (16)
+
+static fields_slot *
+fields_index_slot( fields *f, int fold )
+{
+	unsigned int mask = f->nindex - 1;
+	unsigned int h = ( (unsigned int) fold * 2654435761U ) & mask;
+
+	while ( f->index[h].head!=-1 && f->index[h].fold!=fold )
+		h = ( h + 1 ) & mask;
+	return &( f->index[h] );
+}
+
+static void
+fields_index_add( fields *f, int n )
+{
+	int fold = fields_fold( f, n );
+	fields_slot *s = fields_index_slot( f, fold );
+
+	if ( s->head==-1 ) {
+		s->fold = fold;
+		s->head = n;
+	} else {
+		f->entry[ s->tail ].chain = n;
+	}
+	s->tail = n;
+	f->entry[n].chain = -1;
+}
+
+/* fields_index()
+ *
+ * Build the index if f is big enough to make it worthwhile. On memory
+ * errors the index is simply not built, and lookups scan linearly.
+ */
+static void
+fields_index( fields *f )
+{
+	fields_slot *newindex;
+	int i, nslots = 32;
+
+	if ( f->nindex || f->n < FIELDS_INDEX_MIN ) return;
+
+	while ( nslots < 2 * f->n ) nslots *= 2;
+
+	if ( nslots > f->maxindex ) {
+		newindex = ( fields_slot * ) realloc( f->index, sizeof( fields_slot ) * nslots );
+		if ( !newindex ) return;
+		if ( f->index ) MEMSTATS_REALLOC( MEMSTATS_FIELDS, sizeof( fields_slot ) * f->maxindex, sizeof( fields_slot ) * nslots );
+		else MEMSTATS_ALLOC( MEMSTATS_FIELDS, sizeof( fields_slot ) * nslots );
+		f->index = newindex;
+		f->maxindex = nslots;
+	}
+
+	for ( i=0; i<nslots; ++i )
+		f->index[i].head = -1;
+	f->nindex = nslots;
+
+	for ( i=0; i<f->n; ++i )
+		fields_index_add( f, i );
+}
+
+/* fields_first()
+ *
+ * Return the first position with fold atom fold, -1 if there isn't one.
+ */
+static int
+fields_first( fields *f, int fold )
+{
+	int i;
+
+	fields_index( f );
+	if ( f->nindex ) return fields_index_slot( f, fold )->head;
+
+	for ( i=0; i<f->n; ++i )
+		if ( fields_fold( f, i )==fold ) return i;
+	return -1;
+}
+
+/* fields_next()
+ *
+ * Return the next position after n with the same fold atom, -1 if none.
+ */
+static int
+fields_next( fields *f, int n )
+{
+	int i, fold;
+
+	if ( f->nindex ) return f->entry[n].chain;
+
+	fold = fields_fold( f, n );
+	for ( i=n+1; i<f->n; ++i )
+		if ( fields_fold( f, i )==fold ) return i;
+	return -1;
+}
+
+/*
+ * Duplicate check set
+ *
+ * With FIELDS_NO_DUPS, _fields_add() must reject an entry whose level,
+ * tag and data all match an existing one, ignoring case.  Past
+ * FIELDS_INDEX_MIN entries a linear check makes building a record with
+ * thousands of keywords or authors quadratic, so each entry gets a
+ * case-folded hash and positions are kept in an open-addressed set.
+ *
+ * Data can be changed in place through str pointers handed out by
+ * fields_value() and friends, so handing one out marks the entry stale
+ * and it is rehashed and reinserted before the next check.  Slots left
+ * behind by a rehash are harmless as a match always compares the data.
+ */
+static unsigned int
+fields_dups_hash( int level, int fold, const char *data )
+{
+	unsigned int h = 2166136261U;
+
+	h = ( h ^ (unsigned int) level ) * 16777619U;
+	h = ( h ^ (unsigned int) fold ) * 16777619U;
+	if ( data ) {
+		while ( *data ) {
+			h ^= tolower( (unsigned char) *data++ );
+			h *= 16777619U;
+		}
+	}
+	/* 0 marks a stale entry */
+	return ( h ) ? h : 1;
+}
+
+static void
+fields_dups_insert( fields *f, int n )
+{
+	unsigned int mask = f->ndups - 1;
+	unsigned int h = f->entry[n].hash & mask;
+
+	while ( f->dups[h] ) h = ( h + 1 ) & mask;
+	f->dups[h] = n + 1;
+	f->nindups++;
+}
+
+/* fields_dups_build()
+ *
+ * (Re)build the set sized for f->n entries. On memory errors the set
+ * is simply not built, and duplicates are checked linearly.
+ */
+static void
+fields_dups_build( fields *f )
+{
+	int i, nslots = 64;
+
+	while ( nslots < 4 * f->n ) nslots *= 2;
+
+	f->ndups = f->nindups = 0;
+	if ( nslots > f->maxdups ) {
+		if ( f->dups ) {
+			free( f->dups );
+			MEMSTATS_FREE( MEMSTATS_FIELDS, sizeof( int ) * f->maxdups );
+		}
+		f->maxdups = 0;
+		f->dups = ( int * ) calloc( nslots, sizeof( int ) );
+		if ( !f->dups ) return;
+		MEMSTATS_ALLOC( MEMSTATS_FIELDS, sizeof( int ) * nslots );
+		f->maxdups = nslots;
+	} else memset( f->dups, 0, sizeof( int ) * nslots );
+	f->ndups = nslots;
+
+	for ( i=0; i<f->n; ++i ) {
+		if ( !f->entry[i].hash )
+			f->entry[i].hash = fields_dups_hash( f->entry[i].level, fields_fold( f, i ), fields_entry_cstr( &(f->entry[i]) ) );
+		fields_dups_insert( f, i );
+	}
+	intlist_empty( &(f->stale) );
+}
+
+/* fields_strp()
+ *
+ * Return entry n as a str that the caller may change, copying a pooled
+ * or borrowed value into it if need be and marking it to be rehashed.
+ */
+static str *
+fields_strp( fields *f, int n )
+{
+	fields_entry *e = &(f->entry[n]);
+
+	if ( e->value ) {
+		str_segcpy( &(e->data), e->value, e->value + e->len );
+		if ( e->pooled ) fields_pool_release( e->pooled );
+		e->pooled = NULL;
+		e->value = NULL;
+	}
+
+	if ( f->ndups && e->hash ) {
+		e->hash = 0;
+		if ( intlist_add( &(f->stale), n )!=INTLIST_OK ) f->ndups = 0;
+	}
+
+	return &(e->data);
+}
+
+/* fields_dups_find()
+ *
+ * Return 1 if an entry matching level, fold and data is in f.
+ */
+static int
+fields_dups_find( fields *f, int level, int fold, const char *data )
+{
+	unsigned int h, mask, hash;
+	int i, n;
+
+	if ( !f->ndups ) {
+		if ( f->n >= FIELDS_INDEX_MIN ) fields_dups_build( f );
+		if ( !f->ndups ) {
+			for ( i=0; i<f->n; i++ ) {
+				if ( f->entry[i].level==level &&
+				     fields_fold( f, i )==fold &&
+				     !strcasecmp( fields_entry_cstr( &(f->entry[i]) ), data ) )
+					return 1;
+			}
+			return 0;
+		}
+	}
+
+	for ( i=0; i<f->stale.n; ++i ) {
+		n = intlist_get( &(f->stale), i );
+		if ( f->entry[n].hash ) continue;
+		f->entry[n].hash = fields_dups_hash( f->entry[n].level, fields_fold( f, n ), fields_entry_cstr( &(f->entry[n]) ) );
+		if ( 2 * ( f->nindups + 1 ) > f->ndups ) {
+			fields_dups_build( f );
+			break;
+		}
+		fields_dups_insert( f, n );
+	}
+	intlist_empty( &(f->stale) );
+
+	hash = fields_dups_hash( level, fold, data );
+	mask = f->ndups - 1;
+	h = hash & mask;
+	while ( ( n = f->dups[h] ) ) {
+		n--;
+		if ( f->entry[n].hash==hash &&
+		     f->entry[n].level==level &&
+		     fields_fold( f, n )==fold &&
+		     !strcasecmp( fields_entry_cstr( &(f->entry[n]) ), data ) )
+			return 1;
+		h = ( h + 1 ) & mask;
+	}
+	return 0;
+}
 
 /* 
  * Add a field value into the set of output fields, with the indicated tag.
@@ -111,12 +664,18 @@ fields_realloc( fields *f )
  * Example:
  *      fstatus = fields_add( out, outtag, str_cstr( field_value), LEVEL_MAIN );
  */
-int
-_fields_add( fields *f, char *tag, char *data, int level, int mode )
+static int
+fields_add_entry( fields *f, const char *tag, char *data, int len, int borrowed,
+		int level, int mode )
 {
-	int i, n, status;
+	int n, atom, fold, status;
 
-	if ( !tag || !data ) return FIELDS_OK;
+	/* levels are stored in a byte */
+	if ( level < SCHAR_MIN || level > SCHAR_MAX ) return FIELDS_ERR;
+
+	atom = fields_atom_add( tag );
+	if ( atom==-1 ) return FIELDS_ERR;
+	fold = atoms[atom]->fold;
 
 	if ( f->max==0 ) {
 		status = fields_alloc( f );
@@ -128,28 +687,82 @@ _fields_add( fields *f, char *tag, char *data, int level, int mode )
 
 	/* Don't duplicate identical entries if FIELDS_NO_DUPS */
 	if ( mode == FIELDS_NO_DUPS ) {
-		for ( i=0; i<f->n; i++ ) {
-			if ( f->level[i]==level &&
-			     !strcasecmp( f->tag[i].data, tag ) &&
-			     !strcasecmp( f->data[i].data, data ) )
-				return FIELDS_OK;
-		}
+		if ( fields_dups_find( f, level, fold, data ) )
+			return FIELDS_OK;
 	}
 
 	n = f->n;
-	f->used[ n ]  = 0;
-	f->level[ n ] = level;
-	str_strcpyc( &(f->tag[n]), tag );
-	str_strcpyc( &(f->data[n]), data );
-
-	if ( str_memerr( &(f->tag[n]) ) || str_memerr( &(f->data[n] ) ) )
-		return FIELDS_ERR;
+	f->entry[ n ].used  = 0;
+	f->entry[ n ].level = level;
+	f->entry[ n ].tag   = atom;
+	f->entry[ n ].hash  = 0;
+	f->entry[ n ].pooled = NULL;
+	if ( borrowed ) {
+		f->entry[ n ].value = data;
+		f->entry[ n ].len   = len;
+	} else {
+		f->entry[ n ].value = NULL;
+		str_strcpyc( &(f->entry[n].data), data );
+		if ( str_memerr( &(f->entry[n].data ) ) )
+			return FIELDS_ERR;
+	}
 
 	f->n++;
 
+	if ( f->ndups ) {
+		if ( 2 * ( f->nindups + 1 ) > f->ndups ) fields_dups_build( f );
+		else {
+			f->entry[n].hash = fields_dups_hash( level, fold, data );
+			fields_dups_insert( f, n );
+		}
+	}
+
+	if ( f->nindex ) {
+		if ( 2 * f->n > f->nindex ) f->nindex = 0;
+		else fields_index_add( f, n );
+	}
+
 	return FIELDS_OK;
 }
 
+int
+_fields_add( fields *f, const char *tag, char *data, int level, int mode )
+{
+	if ( !tag || !data ) return FIELDS_OK;
+	return fields_add_entry( f, tag, data, 0, 0, level, mode );
+}
+
+/* _fields_add_borrowed()
+ *
+ * As _fields_add(), but the entry points at data (of length len, and
+ * nul-terminated) instead of copying it. data must stay valid as long
+ * as the entry, usually by being in the record buffer of f, see
+ * fields_record(). It is copied into the entry the first time a str
+ * that may be changed is asked for.
+ */
+int
+_fields_add_borrowed( fields *f, const char *tag, char *data, int len, int level, int mode )
+{
+	if ( !tag || !data ) return FIELDS_OK;
+	return fields_add_entry( f, tag, data, len, 1, level, mode );
+}
+
+/* fields_record()
+ *
+ * Hand the record in s over to f, so that values borrowed from it (see
+ * _fields_add_borrowed()) stay valid for the lifetime of f. s gets the
+ * previous, emptied, record buffer of f to reuse.
+ *
+ * Returns the record data now kept by f.
+ */
+char *
+fields_record( fields *f, str *s )
+{
+	str_swapstrings( &(f->record), s );
+	str_empty( s );
+	return str_cstr( &(f->record) );
+}
+
 int
 _fields_add_tagsuffix( fields *f, char *tag, char *suffix,
 		char *data, int level, int mode )
@@ -188,14 +801,16 @@ fields_match_level( fields *f, int n, int level )
 int
 fields_match_tag( fields *info, int n, char *tag )
 {
-	if ( !strcmp( fields_tag( info, n, FIELDS_CHRP ), tag ) ) return 1;
+	if ( n<0 || n>=info->n ) return 0;
+	if ( info->entry[n].tag==fields_atom_find( tag, 0 ) ) return 1;
 	return 0;
 }
 
 int
 fields_match_casetag( fields *info, int n, char *tag )
 {
-	if ( !strcasecmp( fields_tag( info, n, FIELDS_CHRP ), tag ) ) return 1;
+	if ( n<0 || n>=info->n ) return 0;
+	if ( fields_fold( info, n )==fields_atom_find( tag, 1 ) ) return 1;
 	return 0;
 }
 
@@ -219,18 +834,21 @@ fields_match_casetag_level( fields *info, int n, char *tag, int level )
  * Return -1 if tag isn't found.
  */
 int
-fields_find( fields *f, char *tag, int level )
+fields_find( fields *f, const char *tag, int level )
 {
-	int i;
+	int i, fold;
 
-	for ( i=0; i<f->n; ++i ) {
-		if ( !fields_match_casetag_level( f, i, tag, level ) )
-			continue;
-		if ( f->data[i].len ) return i;
+	/* a tag never added anywhere can't be in these fields */
+	fold = fields_atom_find( tag, 1 );
+	if ( fold==-1 ) return -1;
+
+	for ( i=fields_first( f, fold ); i!=-1; i=fields_next( f, i ) ) {
+		if ( !fields_match_level( f, i, level ) ) continue;
+		if ( fields_entry_len( &(f->entry[i]) ) ) return i;
 		else {
 			/* if there is no data for the tag, don't "find" it */
 			/* and set "used" so noise is suppressed */
-			f->used[i] = 1;
+			f->entry[i].used = 1;
 		}
 	}
 
@@ -243,10 +861,10 @@ fields_maxlevel( fields *f )
 	int i, max = 0;
 
 	if ( f->n ) {
-		max = f->level[0];
+		max = f->entry[0].level;
 		for ( i=1; i<f->n; ++i ) {
-			if ( f->level[i] > max )
-				max = f->level[i];
+			if ( f->entry[i].level > max )
+				max = f->entry[i].level;
 		}
 	}
 
@@ -259,14 +877,14 @@ fields_clearused( fields *f )
 	int i;
 
 	for ( i=0; i<f->n; ++i )
-		f->used[i] = 0;
+		f->entry[i].used = 0;
 }
 
 void
 fields_setused( fields *f, int n )
 {
 	if ( n >= 0 && n < f->n )
-		f->used[n] = 1;
+		f->entry[n].used = 1;
 }
 
 /* fields_replace_or_add()
@@ -277,10 +895,12 @@ int
 fields_replace_or_add( fields *f, char *tag, char *data, int level )
 {
 	int n = fields_find( f, tag, level );
+	str *value;
 	if ( n==-1 ) return fields_add( f, tag, data, level );
 	else {
-		str_strcpyc( &(f->data[n]), data );
-		if ( str_memerr( &(f->data[n]) ) ) return FIELDS_ERR;
+		value = fields_strp( f, n );
+		str_strcpyc( value, data );
+		if ( str_memerr( value ) ) return FIELDS_ERR;
 		return FIELDS_OK;
 	}
 }
@@ -290,17 +910,15 @@ char *fields_null_value = "\0";
 int
 fields_used( fields *f, int n )
 {
-	if ( n >= 0 && n < f->n ) return f->used[n];
+	if ( n >= 0 && n < f->n ) return f->entry[n].used;
 	else return 0;
 }
 
 int
 fields_notag( fields *f, int n )
 {
-	str *t;
 	if ( n >= 0 && n < f->n ) {
-		t = &( f->tag[n] );
-		if ( t->len > 0 ) return 0;
+		if ( atoms[ f->entry[n].tag ]->name.len > 0 ) return 0;
 	}
 	return 1;
 }
@@ -308,10 +926,8 @@ fields_notag( fields *f, int n )
 int
 fields_nodata( fields *f, int n )
 {
-	str *d;
 	if ( n >= 0 && n < f->n ) {
-		d = &( f->data[n] );
-		if ( d->len > 0 ) return 0;
+		if ( fields_entry_len( &(f->entry[n]) ) > 0 ) return 0;
 	}
 	return 1;
 }
@@ -335,6 +951,8 @@ fields_num( fields *f )
  *
  * Note that mode FIELDS_CHRP causes the function to return a pointer to C string,
  * while mode FIELDS_STRP causes the function to return a pointers to a str.
+ * Either points into the tag atom shared by every set of fields, so it
+ * is const; to change a tag, add an entry with the new one instead.
  */
 
 void *
@@ -347,14 +965,14 @@ fields_value( fields *f, int n, int mode )
 	if ( mode & FIELDS_SETUSE_FLAG )
 		fields_setused( f, n );
 
-	if ( mode & FIELDS_STRP_FLAG )
-		return &(f->data[n]);
-	else if ( mode & FIELDS_POSP_FLAG ) {
+	if ( mode & FIELDS_STRP_FLAG ) {
+		return fields_strp( f, n );
+	} else if ( mode & FIELDS_POSP_FLAG ) {
 		retn = n;
 		return ( void * ) retn; /* Rather pointless */
 	} else {
-		if ( f->data[n].len )
-			return f->data[n].data;
+		if ( fields_entry_len( &(f->entry[n]) ) )
+			return fields_entry_cstr( &(f->entry[n]) );
 		else
 			return fields_null_value;
 	}
@@ -367,9 +985,9 @@ fields_value( fields *f, int n, int mode )
  * while mode FIELDS_STRP causes the function to return a pointers to a str.
  *
  * Example:
- *     tag   = ( char * ) fields_tag( out, j, FIELDS_CHRP );
+ *     tag   = fields_tag( out, j, FIELDS_CHRP );
  */
-void *
+const void *
 fields_tag( fields *f, int n, int mode )
 {
 	intptr_t retn;
@@ -377,13 +995,13 @@ fields_tag( fields *f, int n, int mode )
 	if ( n<0 || n>= f->n ) return NULL;
 
 	if ( mode & FIELDS_STRP_FLAG )
-		return &(f->tag[n]);
+		return &( atoms[ f->entry[n].tag ]->name );
 	else if ( mode & FIELDS_POSP_FLAG ) {
 		retn = n;
 		return ( void * ) retn; /* Rather pointless */
 	} else {
-		if ( f->tag[n].len )
-			return f->tag[n].data;
+		if ( atoms[ f->entry[n].tag ]->name.len )
+			return atoms[ f->entry[n].tag ]->name.data;
 		else
 			return fields_null_value;
 	}
@@ -393,26 +1011,28 @@ int
 fields_level( fields *f, int n )
 {
 	if ( n<0 || n>= f->n ) return 0;
-	return f->level[n];
+	return f->entry[n].level;
 }
 
 void *
 fields_findv( fields *f, int level, int mode, char *tag )
 {
-	int i, found = -1;
+	int i, fold, found = -1;
 	intptr_t retn;
 
-	for ( i=0; i<f->n && found==-1; ++i ) {
+	fold = fields_atom_find( tag, 1 );
+	if ( fold==-1 ) return NULL;
+
+	for ( i=fields_first( f, fold ); i!=-1 && found==-1; i=fields_next( f, i ) ) {
 
 		if ( !fields_match_level( f, i, level ) ) continue;
-		if ( !fields_match_casetag( f, i, tag ) ) continue;
 
-		if ( f->data[i].len!=0 ) found = i;
+		if ( fields_entry_len( &(f->entry[i]) )!=0 ) found = i;
 		else {
 			if ( mode & FIELDS_NOLENOK_FLAG ) {
 				return (void *) fields_null_value;
 			} else if ( mode & FIELDS_SETUSE_FLAG ) {
-				f->used[i] = 1; /* Suppress "noise" of unused */
+				f->entry[i].used = 1; /* Suppress "noise" of unused */
 			}
 		}
 	}
@@ -422,13 +1042,13 @@ fields_findv( fields *f, int level, int mode, char *tag )
 	if ( mode & FIELDS_SETUSE_FLAG )
 		fields_setused( f, found );
 
-	if ( mode & FIELDS_STRP_FLAG )
-		return (void *) &(f->data[found]);
-	else if ( mode & FIELDS_POSP_FLAG ) {
+	if ( mode & FIELDS_STRP_FLAG ) {
+		return (void *) fields_strp( f, found );
+	} else if ( mode & FIELDS_POSP_FLAG ) {
 		retn = found;
 		return (void *) retn;
 	} else
-		return (void *) f->data[found].data;
+		return (void *) fields_entry_cstr( &(f->entry[found]) );
 }
 
 void *
@@ -450,23 +1070,138 @@ fields_findv_firstof( fields *f, int level, int mode, ... )
 	return NULL;
 }
 
-static void
-fields_findv_each_add( fields *f, int mode, int n, vplist *a )
+/*
+ * Iterate over the entries with any of a set of tags at a level, in order
+ * of position, without building a list.  Tags are compared ignoring case
+ * and up to FIELDS_ITER_MAXTAGS different tags can be given; with more,
+ * fields_iter_init() returns 0 and there are no matches.
+ *
+ * As with fields_findv_each(), entries without data are skipped and
+ * marked used unless mode has FIELDS_NOLENOK_FLAG.  fields_iter_next()
+ * returns a C string (FIELDS_CHRP...) or a str (FIELDS_STRP...) and NULL
+ * when there are no more matches; fields_iter_pos() gives the position
+ * of the last match.
+ *
+ * Example:
+ *   fields_iter it;
+ *   char *value;
+ *
+ *   fields_iter_init( &it, in, LEVEL_ANY, FIELDS_CHRP, "KEYWORD", NULL );
+ *   while ( ( value = fields_iter_next( &it ) ) ) {
+ *      <<do something with value>>
+ *   }
+ */
+static int
+fields_iter_vinit( fields_iter *it, fields *f, int level, int mode, va_list argp )
 {
-	intptr_t retn;
+	char *tag;
+	int i, fold;
 
-	if ( n<0 || n>= f->n ) return;
+	it->f     = f;
+	it->level = level;
+	it->mode  = mode;
+	it->ntags = 0;
+	it->n     = -1;
 
-	if ( mode & FIELDS_SETUSE_FLAG )
+	while ( ( tag = ( char * ) va_arg( argp, char * ) ) ) {
+		/* unknown tags can't match */
+		fold = fields_atom_find( tag, 1 );
+		if ( fold==-1 ) continue;
+		for ( i=0; i<it->ntags; ++i )
+			if ( it->fold[i]==fold ) break;
+		if ( i<it->ntags ) continue;
+		if ( it->ntags==FIELDS_ITER_MAXTAGS ) {
+			it->ntags = 0;
+			return 0;
+		}
+		it->fold[ it->ntags ] = fold;
+		it->next[ it->ntags ] = fields_first( f, fold );
+		it->ntags++;
+	}
+	return 1;
+}
+
+/* returns 0 if there are more than FIELDS_ITER_MAXTAGS tags */
+int
+fields_iter_init( fields_iter *it, fields *f, int level, int mode, ... )
+{
+	va_list argp;
+	int ok;
+
+	va_start( argp, mode );
+	ok = fields_iter_vinit( it, f, level, mode, argp );
+	va_end( argp );
+
+	return ok;
+}
+
+/* the value of the entry at n if it is a match for it, else NULL */
+static void *
+fields_iter_take( fields_iter *it, int n )
+{
+	fields *f = it->f;
+
+	if ( !fields_match_level( f, n, it->level ) ) return NULL;
+
+	if ( fields_entry_len( &(f->entry[n]) )==0 && !( it->mode & FIELDS_NOLENOK_FLAG ) ) {
+		f->entry[n].used = 1; /* Suppress "noise" of unused */
+		return NULL;
+	}
+
+	it->n = n;
+
+	if ( it->mode & FIELDS_SETUSE_FLAG )
 		fields_setused( f, n );
 
-	if ( mode & FIELDS_STRP_FLAG ) {
-		vplist_add( a, (void *) &(f->data[n]) );
-	} else if ( mode & FIELDS_POSP_FLAG ) {
-		retn = n;
+	if ( it->mode & FIELDS_STRP_FLAG ) {
+		return fields_strp( f, n );
+	} else if ( fields_entry_len( &(f->entry[n]) ) ) {
+		return fields_entry_cstr( &(f->entry[n]) );
+	} else {
+		return fields_null_value;
+	}
+}
+
+void *
+fields_iter_next( fields_iter *it )
+{
+	int i, k, n;
+	void *v;
+
+	while ( 1 ) {
+
+		/* take the earliest candidate of all of the tags */
+		k = -1;
+		for ( i=0; i<it->ntags; ++i ) {
+			if ( it->next[i]==-1 ) continue;
+			if ( k==-1 || it->next[i] < it->next[k] ) k = i;
+		}
+		if ( k==-1 ) return NULL;
+
+		n = it->next[k];
+		it->next[k] = fields_next( it->f, n );
+
+		v = fields_iter_take( it, n );
+		if ( v ) return v;
+	}
+}
+
+int
+fields_iter_pos( fields_iter *it )
+{
+	return it->n;
+}
+
+static void
+fields_findv_each_add( fields_iter *it, void *v, vplist *a )
+{
+	intptr_t retn;
+
+	if ( it->mode & FIELDS_POSP_FLAG ) {
+		retn = fields_iter_pos( it );
 		vplist_add( a, (void *) retn );
 	} else {
-		vplist_add( a, (void *) f->data[n].data );
+		vplist_add( a, v );
 	}
 }
 
@@ -493,71 +1228,102 @@ fields_findv_each_add( fields *f, int mode, int n, vplist *a )
  *
  * Note that mode FIELDS_CHRP causes the function to return a pointer to C string,
  * while mode FIELDS_STRP causes the function to return a pointers to a str.
+ *
+ * Where the list itself isn't needed, fields_iter_init() avoids building it.
  */
 void
 fields_findv_each( fields *f, int level, int mode, vplist *a, char *tag )
 {
-	int i;
-
-	for ( i=0; i<f->n; ++i ) {
-
-		if ( !fields_match_level( f, i, level ) ) continue;
-		if ( !fields_match_casetag( f, i, tag ) ) continue;
-
-		if ( f->data[i].len!=0 ) {
-			fields_findv_each_add( f, mode, i, a );
-		} else {
-			if ( mode & FIELDS_NOLENOK_FLAG ) {
-				fields_findv_each_add( f, mode, i, a );
-			} else {
-				f->used[i] = 1; /* Suppress "noise" of unused */
-			}
-		}
+	fields_iter it;
+	void *v;
 
-	}
+	fields_iter_init( &it, f, level, mode, tag, NULL );
+	while ( ( v = fields_iter_next( &it ) ) )
+		fields_findv_each_add( &it, v, a );
 }
 
 void
 fields_findv_eachof( fields *f, int level, int mode, vplist *a, ... )
 {
+	fields_iter it;
 	va_list argp;
-	vplist tags;
+	int n, ok, found;
 	char *tag;
-	int i, j, found;
-
-	vplist_init( &tags );
+	void *v;
 
-	/* build list of tags to search for */
 	va_start( argp, a );
-	while ( ( tag = ( char * ) va_arg( argp, char * ) ) )
-		vplist_add( &tags, tag );
+	ok = fields_iter_vinit( &it, f, level, mode, argp );
 	va_end( argp );
 
-	/* search list */
-	for ( i=0; i<f->n; ++i ) {
-
-		if ( !fields_match_level( f, i, level ) ) continue;
+	if ( ok ) {
+		while ( ( v = fields_iter_next( &it ) ) )
+			fields_findv_each_add( &it, v, a );
+		return;
+	}
 
+	/* more tags than the iterator holds, check every entry against them */
+	for ( n=0; n<f->n; ++n ) {
 		found = 0;
-		for ( j=0; j<tags.n && !found; ++j ) {
-			if ( fields_match_casetag( f, i, vplist_get( &tags, j ) ) )
-				found = 1;
-		}
+		va_start( argp, a );
+		while ( !found && ( tag = ( char * ) va_arg( argp, char * ) ) )
+			found = fields_match_casetag( f, n, tag );
+		va_end( argp );
 		if ( !found ) continue;
+		v = fields_iter_take( &it, n );
+		if ( v ) fields_findv_each_add( &it, v, a );
+	}
+}
 
-		if ( f->data[i].len!=0 ) {
-			fields_findv_each_add( f, mode, i, a );
-		} else {
-			if ( mode & FIELDS_NOLENOK_FLAG ) {
-				fields_findv_each_add( f, mode, i, a );
-			} else {
-				f->used[i] = 1; /* Suppress "noise" of unused */
-			}
-		}
+/* fields_intern()
+ *
+ * Move the values of f into the value pool, so that identical values
+ * across references share storage. Meant for references that are kept
+ * around, e.g. once they are complete in a bibl.
+ *
+ * Returns FIELDS_OK or FIELDS_ERR on memory error.
+ */
+int
+fields_intern( fields *f )
+{
+	fields_entry *e;
+	int i;
 
+	for ( i=0; i<f->n; ++i ) {
+		e = &(f->entry[i]);
+		if ( e->pooled || fields_entry_len( e )==0 ) continue;
+		e->pooled = fields_pool_get( fields_entry_cstr( e ), fields_entry_len( e ) );
+		if ( !e->pooled ) return FIELDS_ERR;
+		e->value = e->pooled->data;
+		e->len   = e->pooled->len;
+		str_free( &(e->data) );
 	}
 
-	vplist_free( &tags );
+	return FIELDS_OK;
+}
+
+/* fields_interned()
+ *
+ * Returns 1 if the value of entry n is shared through the value pool,
+ * so that asking for a str to change copies it, 0 if not.
+ */
+int
+fields_interned( fields *f, int n )
+{
+	if ( n<0 || n>=f->n ) return 0;
+	return ( f->entry[n].pooled!=NULL );
+}
+
+/* fields_shared()
+ *
+ * Returns 1 if the value of entry n isn't held by the entry itself
+ * (pooled or borrowed), so that asking for a str to change copies it,
+ * 0 if not.
+ */
+int
+fields_shared( fields *f, int n )
+{
+	if ( n<0 || n>=f->n ) return 0;
+	return ( f->entry[n].value!=NULL );
 }
 
 void
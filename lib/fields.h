@@ -21,20 +21,47 @@
 
 #include <stdarg.h>
 #include "str.h"
+#include "intlist.h"
 #include "vplist.h"
 
+typedef struct fields_slot {
+	int fold;           /* fold atom of the tag */
+	int head, tail;     /* first and last position with it, -1 if empty */
+} fields_slot;
+
+struct fields_pooled;
+
+typedef struct fields_entry {
+	str           data;
+	char         *value; /* value if not held in data, else NULL */
+	int           len;   /* length of value */
+	struct fields_pooled *pooled; /* shared value, see fields_intern() */
+	int           tag;   /* tag atom, see fields_tag() for the string */
+	unsigned int  hash;  /* duplicate check hash, 0 if stale */
+	int           chain; /* next position with the same fold atom */
+	signed char   level;
+	unsigned char used;
+} fields_entry;
+
 typedef struct fields {
-	str       *tag;
-	str       *data;
-	int       *used;
-	int       *level;
+	fields_entry *entry;
 	int       n;
 	int       max;
+	fields_slot *index; /* lazy tag lookup index, see fields_index() */
+	int       nindex;   /* slots in use, 0 if the index isn't built */
+	int       maxindex;
+	int       *dups;    /* duplicate check set, see fields_dups_build() */
+	int       ndups;    /* slots in dups, 0 if the set isn't built */
+	int       nindups;  /* occupied slots in dups */
+	int       maxdups;
+	intlist   stale;    /* entries whose data may have changed */
+	str       record;   /* buffer borrowed values point into, see fields_record() */
 } fields;
 
 void    fields_init( fields *f );
 fields *fields_new( void );
 void    fields_free( fields *f );
+void    fields_reset( fields *f );
 
 #define FIELDS_CAN_DUP (0)
 #define FIELDS_NO_DUPS (1)
@@ -44,10 +71,20 @@ void    fields_free( fields *f );
 #define fields_add_tagsuffix( a, b, c, d, e )         _fields_add( a, b, c, d, e, FIELDS_NO_DUPS )
 #define fields_add_tagsuffix_can_dup( a, b, c, d, e ) _fields_add( a, b, c, d, e, FIELDS_CAN_DUP )
 
-int  _fields_add( fields *f, char *tag, char *data, int level, int mode );
+int  _fields_add( fields *f, const char *tag, char *data, int level, int mode );
 int  _fields_add_tagsuffix( fields *f, char *tag, char *suffix,
 		char *data, int level, int mode );
 
+#define fields_add_borrowed( a, b, c, d, e )         _fields_add_borrowed( a, b, c, d, e, FIELDS_NO_DUPS )
+#define fields_add_borrowed_can_dup( a, b, c, d, e ) _fields_add_borrowed( a, b, c, d, e, FIELDS_CAN_DUP )
+
+int  _fields_add_borrowed( fields *f, const char *tag, char *data, int len, int level, int mode );
+char *fields_record( fields *f, str *s );
+
+int  fields_intern( fields *f );
+int  fields_interned( fields *f, int n );
+int  fields_shared( fields *f, int n );
+
 int  fields_maxlevel( fields *f );
 void fields_clearused( fields *f );
 void fields_setused( fields *f, int n );
@@ -80,11 +117,11 @@ void fields_report( fields *f, FILE *fp );
 #define FIELDS_CHRP_NOUSE  (                            0                              )
 #define FIELDS_STRP_NOUSE  (                     FIELDS_STRP_FLAG                      )
 
-void *fields_tag( fields *f, int n, int mode );
+const void *fields_tag( fields *f, int n, int mode );
 void *fields_value( fields *f, int n, int mode );
 int   fields_level( fields *f, int n );
  
-int   fields_find( fields *f, char *searchtag, int level );
+int   fields_find( fields *f, const char *searchtag, int level );
 
 void *fields_findv( fields *f, int level, int mode, char *tag );
 void *fields_findv_firstof( fields *f, int level, int mode, ... );
@@ -92,4 +129,20 @@ void *fields_findv_firstof( fields *f, int level, int mode, ... );
 void  fields_findv_each( fields *f, int level, int mode, vplist *a, char *tag );
 void  fields_findv_eachof( fields *f, int level, int mode, vplist *a, ... );
 
+#define FIELDS_ITER_MAXTAGS (8)
+
+typedef struct fields_iter {
+	fields *f;
+	int    level;
+	int    mode;
+	int    ntags;
+	int    fold[ FIELDS_ITER_MAXTAGS ]; /* fold atoms of the tags */
+	int    next[ FIELDS_ITER_MAXTAGS ]; /* next candidate position, -1 at end */
+	int    n;                           /* position of the last match */
+} fields_iter;
+
+int   fields_iter_init( fields_iter *it, fields *f, int level, int mode, ... );
+void *fields_iter_next( fields_iter *it );
+int   fields_iter_pos( fields_iter *it );
+
 #endif
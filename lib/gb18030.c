@@ -33,77 +33,143 @@ in_range( unsigned char n, unsigned char low, unsigned char high )
 static int
 gb18030_unicode_table_lookup( unsigned int unicode, unsigned char out[4] )
 {
-	int i, j;
+	int lo, hi, mid, j;
 	if ( unicode >= 0x0080 && unicode <= 0xFFE5 ) {
-		/* list is sorted, so should do binary search here */
-		for ( i=0; i<ngb18030_enums; ++i ) {
-			if ( unicode == gb18030_enums[i].unicode ) {
-				for ( j=0; j<gb18030_enums[i].len; ++j )
-					out[j] = gb18030_enums[i].bytes[j];
-				return gb18030_enums[i].len;
+		/* list is sorted by unicode */
+		lo = 0;
+		hi = ngb18030_enums - 1;
+		while ( lo <= hi ) {
+			mid = ( lo + hi ) / 2;
+			if ( unicode < gb18030_enums[mid].unicode ) hi = mid - 1;
+			else if ( unicode > gb18030_enums[mid].unicode ) lo = mid + 1;
+			else {
+				for ( j=0; j<gb18030_enums[mid].len; ++j )
+					out[j] = gb18030_enums[mid].bytes[j];
+				return gb18030_enums[mid].len;
 			}
 		}
 	}
 	return 0;
 }
 
-static int
-gb18030_match( unsigned char *s, const unsigned char *bytes, unsigned char len )
+/*
+ * Unicode values of the two-byte codes and of the four-byte codes below
+ * GB+8431A530 (the end of the BMP) in gb18030_enums[], indexed directly
+ * and filled in on the first lookup. Zero means no entry.
+ */
+#define GB18030_NTWO  ( 126 * 191 )  /* {0x81-0xFE}{0x40-0xFE} */
+#define GB18030_NFOUR ( 39420 )      /* GB+81308130 up to GB+8431A439 */
+
+static unsigned short gb18030_two[ GB18030_NTWO ];
+static unsigned short gb18030_four[ GB18030_NFOUR ];
+static int gb18030_tables_built = 0;
+
+/* position of a four-byte code counting from GB+81308130 */
+static unsigned int
+gb18030_linear( unsigned char *s )
 {
-	int i;
-	for ( i=0; i<len; ++i )
-		if ( ( s[i])!=bytes[i] ) return 0;
-	return 1;
+	return ( ( ( s[0] - 0x81 ) * 10 + ( s[1] - 0x30 ) ) * 126 + ( s[2] - 0x81 ) ) * 10 + ( s[3] - 0x30 );
 }
 
-static unsigned int
-gb18030_table_lookup( unsigned char *uc, unsigned char len, int *found )
+static void
+gb18030_unlinear( unsigned int n, unsigned char out[4] )
 {
-	unsigned int i;
-	*found = 0;
+	out[3] = 0x30 + n % 10;  n /= 10;
+	out[2] = 0x81 + n % 126; n /= 126;
+	out[1] = 0x30 + n % 10;  n /= 10;
+	out[0] = 0x81 + n;
+}
+
+static void
+gb18030_build_tables( void )
+{
+	unsigned int i, n;
 	for ( i=0; i<ngb18030_enums; ++i ) {
-		if ( gb18030_enums[i].len!=len ) continue;
-		if ( gb18030_match( &(uc[0]), gb18030_enums[i].bytes, len ) ) {
-			*found = 1;
-			return gb18030_enums[i].unicode;
+		if ( gb18030_enums[i].len==2 ) {
+			n = ( gb18030_enums[i].bytes[0] - 0x81 ) * 191 + ( gb18030_enums[i].bytes[1] - 0x40 );
+			if ( n < GB18030_NTWO && !gb18030_two[n] ) gb18030_two[n] = gb18030_enums[i].unicode;
+		} else if ( gb18030_enums[i].len==4 ) {
+			n = gb18030_linear( (unsigned char *) gb18030_enums[i].bytes );
+			if ( n < GB18030_NFOUR && !gb18030_four[n] ) gb18030_four[n] = gb18030_enums[i].unicode;
 		}
 	}
-	return '?';
+	gb18030_tables_built = 1;
 }
 
+static unsigned int
+gb18030_table_lookup( unsigned char *uc, unsigned char len, int *found )
+{
+	unsigned int n, c = 0;
+	if ( !gb18030_tables_built ) gb18030_build_tables();
+	if ( len==2 && uc[1]>=0x40 ) {
+		n = ( uc[0] - 0x81 ) * 191 + ( uc[1] - 0x40 );
+		if ( n < GB18030_NTWO ) c = gb18030_two[n];
+	} else if ( len==4 ) {
+		n = gb18030_linear( uc );
+		if ( n < GB18030_NFOUR ) c = gb18030_four[n];
+	}
+	*found = ( c!=0 );
+	return ( c ) ? c : '?';
+}
+
+/*
+ * Roundtrip-mappings that can be enumerated
+ *
+ * GB 18030 defines roundtrip mappings for all Unicode code points
+ * U+0000..U+10ffff, but all but the 31000 or so in gb18030_enums[] fall
+ * in ranges of four-byte codes that map linearly onto ranges of Unicode.
+ * bfirst is gb18030_linear() of the first code of the range.
+ */
+typedef struct granges_t {
+	unsigned int ufirst, ulast, bfirst;
+} granges_t;
+
+static const granges_t gb18030_ranges[] = {
+	{ 0x0452,  0x200F,      820 },  /* GB+8130D330 */
+	{ 0x2643,  0x2E80,     9219 },  /* GB+8137A839 */
+	{ 0x361B,  0x3917,    12973 },  /* GB+8230A633 */
+	{ 0x3CE1,  0x4055,    14698 },  /* GB+8231D438 */
+	{ 0x4160,  0x4336,    15847 },  /* GB+8232C937 */
+	{ 0x44D7,  0x464B,    16729 },  /* GB+8233A339 */
+	{ 0x478E,  0x4946,    17418 },  /* GB+8233E838 */
+	{ 0x49B8,  0x4C76,    17961 },  /* GB+8234A131 */
+	{ 0x9FA6,  0xD7FF,    19043 },  /* GB+82358F33 */
+	{ 0xE865,  0xF92B,    33550 },  /* GB+8336D030 */
+	{ 0xFA2A,  0xFE2F,    38078 },  /* GB+84309C38 */
+	{ 0xFFE6,  0xFFFF,    39394 },  /* GB+8431A234 */
+	{ 0x10000, 0x10FFFF, 189000 },  /* GB+90308130 */
+};
+
+static const int ngb18030_ranges = sizeof( gb18030_ranges ) / sizeof( gb18030_ranges[0] );
 
 static int
 gb18030_unicode_range_lookup( unsigned int unicode, unsigned char out[4] ) 
 {
+	int i;
+	for ( i=0; i<ngb18030_ranges; ++i ) {
+		if ( unicode < gb18030_ranges[i].ufirst ) break;
+		if ( unicode <= gb18030_ranges[i].ulast ) {
+			gb18030_unlinear( gb18030_ranges[i].bfirst + ( unicode - gb18030_ranges[i].ufirst ), out );
+			return 4;
+		}
+	}
 	return 0;
 }
 
 static int
 gb18030_range_lookup( unsigned char *s, /* unsigned char len = 4 only */ int *found )
 {
+	unsigned int n = gb18030_linear( s );
+	int i;
+	for ( i=0; i<ngb18030_ranges; ++i ) {
+		if ( n < gb18030_ranges[i].bfirst ) break;
+		if ( n - gb18030_ranges[i].bfirst <= gb18030_ranges[i].ulast - gb18030_ranges[i].ufirst ) {
+			*found = 1;
+			return gb18030_ranges[i].ufirst + ( n - gb18030_ranges[i].bfirst );
+		}
+	}
 	*found = 0;
 	return 0;
-#if 0
-  <!-- Roundtrip-mappings that can be enumerated
-       Note that GB 18030 defines roundtrip mappings for all Unicode code points U+0000..U+10ffff.
-       This would require 1.1 million <a> elements.
-       However, most four-byte GB 18030 mappings can be enumerated efficiently within distinct ranges.
-       Therefore, we use <range> elements for all but the 31000 or so assignments above.
-    -->
-  <range uFirst="0452" uLast="200F"  bFirst="81 30 D3 30" bLast="81 36 A5 31"  bMin="81 30 81 30" bMax="FE 39 FE 39"/>
-  <range uFirst="2643" uLast="2E80"  bFirst="81 37 A8 39" bLast="81 38 FD 38"  bMin="81 30 81 30" bMax="FE 39 FE 39"/>
-  <range uFirst="361B" uLast="3917"  bFirst="82 30 A6 33" bLast="82 30 F2 37"  bMin="81 30 81 30" bMax="FE 39 FE 39"/>
-  <range uFirst="3CE1" uLast="4055"  bFirst="82 31 D4 38" bLast="82 32 AF 32"  bMin="81 30 81 30" bMax="FE 39 FE 39"/>
-  <range uFirst="4160" uLast="4336"  bFirst="82 32 C9 37" bLast="82 32 F8 37"  bMin="81 30 81 30" bMax="FE 39 FE 39"/>
-  <range uFirst="44D7" uLast="464B"  bFirst="82 33 A3 39" bLast="82 33 C9 31"  bMin="81 30 81 30" bMax="FE 39 FE 39"/>
-  <range uFirst="478E" uLast="4946"  bFirst="82 33 E8 38" bLast="82 34 96 38"  bMin="81 30 81 30" bMax="FE 39 FE 39"/>
-  <range uFirst="49B8" uLast="4C76"  bFirst="82 34 A1 31" bLast="82 34 E7 33"  bMin="81 30 81 30" bMax="FE 39 FE 39"/>
-  <range uFirst="9FA6" uLast="D7FF"  bFirst="82 35 8F 33" bLast="83 36 C7 38"  bMin="81 30 81 30" bMax="FE 39 FE 39"/>
-  <range uFirst="E865" uLast="F92B"  bFirst="83 36 D0 30" bLast="84 30 85 34"  bMin="81 30 81 30" bMax="FE 39 FE 39"/>
-  <range uFirst="FA2A" uLast="FE2F"  bFirst="84 30 9C 38" bLast="84 31 85 37"  bMin="81 30 81 30" bMax="FE 39 FE 39"/>
-  <range uFirst="FFE6" uLast="FFFF"  bFirst="84 31 A2 34" bLast="84 31 A4 39"  bMin="81 30 81 30" bMax="FE 39 FE 39"/>
-  <range uFirst="10000" uLast="10FFFF"  bFirst="90 30 81 30" bLast="E3 32 9A 35"  bMin="81 30 81 30" bMax="FE 39 FE 39"/>
-#endif
 }
 
 unsigned int
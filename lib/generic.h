@@ -10,14 +10,14 @@
 
 #include "bibutils.h"
 
-int generic_null    ( fields *bibin, int n, str *intag, str *invalue, int level, param *pm, char *outtag, fields *bibout );
-int generic_url     ( fields *bibin, int n, str *intag, str *invalue, int level, param *pm, char *outtag, fields *bibout );
-int generic_notes   ( fields *bibin, int n, str *intag, str *invalue, int level, param *pm, char *outtag, fields *bibout );
-int generic_pages   ( fields *bibin, int n, str *intag, str *invalue, int level, param *pm, char *outtag, fields *bibout );
-int generic_person  ( fields *bibin, int n, str *intag, str *invalue, int level, param *pm, char *outtag, fields *bibout );
-int generic_serialno( fields *bibin, int n, str *intag, str *invalue, int level, param *pm, char *outtag, fields *bibout );
-int generic_simple  ( fields *bibin, int n, str *intag, str *invalue, int level, param *pm, char *outtag, fields *bibout );
-int generic_skip    ( fields *bibin, int n, str *intag, str *invalue, int level, param *pm, char *outtag, fields *bibout );
-int generic_title   ( fields *bibin, int n, str *intag, str *invalue, int level, param *pm, char *outtag, fields *bibout );
+int generic_null    ( fields *bibin, int n, const str *intag, str *invalue, int level, param *pm, char *outtag, fields *bibout );
+int generic_url     ( fields *bibin, int n, const str *intag, str *invalue, int level, param *pm, char *outtag, fields *bibout );
+int generic_notes   ( fields *bibin, int n, const str *intag, str *invalue, int level, param *pm, char *outtag, fields *bibout );
+int generic_pages   ( fields *bibin, int n, const str *intag, str *invalue, int level, param *pm, char *outtag, fields *bibout );
+int generic_person  ( fields *bibin, int n, const str *intag, str *invalue, int level, param *pm, char *outtag, fields *bibout );
+int generic_serialno( fields *bibin, int n, const str *intag, str *invalue, int level, param *pm, char *outtag, fields *bibout );
+int generic_simple  ( fields *bibin, int n, const str *intag, str *invalue, int level, param *pm, char *outtag, fields *bibout );
+int generic_skip    ( fields *bibin, int n, const str *intag, str *invalue, int level, param *pm, char *outtag, fields *bibout );
+int generic_title   ( fields *bibin, int n, const str *intag, str *invalue, int level, param *pm, char *outtag, fields *bibout );
 
 #endif
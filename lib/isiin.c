@@ -21,7 +21,7 @@
 extern variants isi_all[];
 extern int isi_nall;
 
-static int isiin_readf( FILE *fp, char *buf, int bufsize, int *bufpos, str *line, str *reference, int *fcharset );
+static int isiin_readf( reader *r, str *line, str *reference, int *fcharset );
 static int isiin_typef( fields *isiin, char *filename, int nref, param *p );
 static int isiin_convertf( fields *isiin, fields *info, int reftype, param *p );
 static int isiin_processf( fields *isiin, char *p, char *filename, long nref, param *pm );
@@ -41,6 +41,9 @@ isiin_initparams( param *p, const char *progname )
 	p->utf8in           = 0;
 	p->nosplittitle     = 0;
 	p->verbose          = 0;
+	p->intern           = 0;
+	p->convcache        = 0;
+	p->borrow           = 1;
 	p->addcount         = 0;
 	p->output_raw       = 0;
 
@@ -77,19 +80,19 @@ is_isi_tag( char *buf )
 }
 
 static int
-readmore( FILE *fp, char *buf, int bufsize, int *bufpos, str *line )
+readmore( reader *r, str *line )
 {
 	if ( line->len ) return 1;
-	else return str_fget( fp, buf, bufsize, bufpos, line );
+	else return reader_getline( r, line );
 }
 
 static int
-isiin_readf( FILE *fp, char *buf, int bufsize, int *bufpos, str *line, str *reference, int *fcharset )
+isiin_readf( reader *r, str *line, str *reference, int *fcharset )
 {
 	int haveref = 0, inref = 0;
 	char *p;
 	*fcharset = CHARSET_UNKNOWN;
-	while ( !haveref && readmore( fp, buf, bufsize, bufpos, line ) ) {
+	while ( !haveref && readmore( r, line ) ) {
 		if ( !line->data ) continue;
 		p = &(line->data[0]);
 		/* Recognize UTF8 BOM */
@@ -135,8 +138,30 @@ isiin_readf( FILE *fp, char *buf, int bufsize, int *bufpos, str *line, str *refe
  PUBLIC: int isiin_processf()
 *****************************************************/
 
+/* process_line()
+ *
+ * Point data at the value of the line, without leading and trailing
+ * whitespace, terminate it in place in the record (the fields borrow it,
+ * see fields_record()) and return the start of the next line.
+ */
+static char *
+process_line( char **data, int *len, char *p )
+{
+	char *end;
+
+	while ( *p==' ' || *p=='\t' ) p++;
+	*data = p;
+	while ( *p && *p!='\r' && *p!='\n' ) p++;
+	end = p;
+	while ( end > *data && is_ws( *(end-1) ) ) end--;
+	*len = end - *data;
+	while ( *p=='\r' || *p=='\n' ) p++;
+	*end = '\0';
+	return p;
+}
+
 static char *
-process_tagged_line( str *tag, str *data, char *p )
+process_tagged_line( str *tag, char **data, int *len, char *p )
 {
 	int i;
 
@@ -146,32 +171,22 @@ process_tagged_line( str *tag, str *data, char *p )
 		str_addchar( tag, *p++ );
 		i++;
 	}
-	while ( *p==' ' || *p=='\t' ) p++;
-	while ( *p && *p!='\r' && *p!='\n' )
-		str_addchar( data, *p++ );
-	str_trimendingws( data );
-	while ( *p=='\r' || *p=='\n' ) p++;
-	return p;
+	return process_line( data, len, p );
 }
 
 static char *
-process_untagged_line( str *data, char *p )
+process_untagged_line( char **data, int *len, char *p )
 {
-	while ( *p==' ' || *p=='\t' ) p++;
-	while ( *p && *p!='\r' && *p!='\n' )
-		str_addchar( data, *p++ );
-	str_trimendingws( data );
-	while ( *p=='\r' || *p=='\n' ) p++;
-	return p;
+	return process_line( data, len, p );
 }
 
 static int
-add_tag_value( fields *isiin, str *tag, str *value, int *tag_added )
+add_tag_value( fields *isiin, str *tag, char *value, int len, int *tag_added )
 {
 	int status;
 
-	if ( str_has_value( value ) ) {
-		status = fields_add( isiin, str_cstr( tag ), str_cstr( value ), 0 );
+	if ( len > 0 ) {
+		status = fields_add_borrowed( isiin, str_cstr( tag ), value, len, 0 );
 		if ( status!=FIELDS_OK ) return BIBL_ERR_MEMERR;
 		*tag_added = 1;
 	}
@@ -184,11 +199,12 @@ add_tag_value( fields *isiin, str *tag, str *value, int *tag_added )
 }
 
 static int
-merge_tag_value( fields *isiin, str *tag, str *value, int *tag_added )
+merge_tag_value( fields *isiin, str *tag, char *value, int len, int *tag_added )
 {
 	int n, status;
+	str *prev;
 
-	if ( str_has_value( value ) ) {
+	if ( len > 0 ) {
 
 		if ( *tag_added==1 ) {
 
@@ -197,22 +213,23 @@ merge_tag_value( fields *isiin, str *tag, str *value, int *tag_added )
 
 			/* only one AU or AF for list of authors */
 			if ( !strcmp( str_cstr( tag ), "AU" ) ) {
-				status = fields_add( isiin, "AU", str_cstr( value ), 0 );
+				status = fields_add_borrowed( isiin, "AU", value, len, 0 );
 				if ( status!=FIELDS_OK ) return BIBL_ERR_MEMERR;
 			} else if ( !strcmp( str_cstr( tag ), "AF" ) ) {
-				status = fields_add( isiin, "AF", str_cstr( value ), 0 );
+				status = fields_add_borrowed( isiin, "AF", value, len, 0 );
 				if ( status!=FIELDS_OK ) return BIBL_ERR_MEMERR;
 			}
 			/* otherwise append multiline data */
 			else {
-				str_addchar( &(isiin->data[n-1]),' ');
-				str_strcat( &(isiin->data[n-1]), value );
-				if ( str_memerr( &(isiin->data[n-1]) ) ) return BIBL_ERR_MEMERR;
+				prev = fields_value( isiin, n-1, FIELDS_STRP_NOUSE );
+				str_addchar( prev, ' ' );
+				str_strcatc( prev, value );
+				if ( str_memerr( prev ) ) return BIBL_ERR_MEMERR;
 			}
 		}
 
 		else {
-                        status = fields_add( isiin, str_cstr( tag ), str_cstr( value ), 0 );
+                        status = fields_add_borrowed( isiin, str_cstr( tag ), value, len, 0 );
                         if ( status!=FIELDS_OK ) return BIBL_ERR_MEMERR;
                         *tag_added = 1;
 		}
@@ -224,19 +241,19 @@ merge_tag_value( fields *isiin, str *tag, str *value, int *tag_added )
 static int
 isiin_processf( fields *isiin, char *p, char *filename, long nref, param *pm )
 {
-	int status, tag_added = 0, ret = 1;
-	str tag, value;
+	int status, tag_added = 0, ret = 1, len;
+	char *value;
+	str tag;
 
-	strs_init( &tag, &value, NULL );
+	str_init( &tag );
 
 	while ( *p ) {
 
 		/* ...with tag, add */
 		if ( is_isi_tag( p ) ) {
 			str_empty( &tag );
-			str_empty( &value );
-			p = process_tagged_line( &tag, &value, p );
-			status = add_tag_value( isiin, &tag, &value, &tag_added );
+			p = process_tagged_line( &tag, &value, &len, p );
+			status = add_tag_value( isiin, &tag, value, len, &tag_added );
 			if ( status!=BIBL_OK ) {
 				ret = 0;
 				goto out;
@@ -245,9 +262,8 @@ isiin_processf( fields *isiin, char *p, char *filename, long nref, param *pm )
 
 		/* ...untagged, merge -- one AU or AF for list of authors */
 		else {
-			str_empty( &value );
-			p = process_untagged_line( &value, p );
-			status = merge_tag_value( isiin, &tag, &value, &tag_added );
+			p = process_untagged_line( &value, &len, p );
+			status = merge_tag_value( isiin, &tag, value, len, &tag_added );
 			if ( status!=BIBL_OK ) {
 				ret = 0;
 				goto out;
@@ -256,7 +272,7 @@ isiin_processf( fields *isiin, char *p, char *filename, long nref, param *pm )
 
 	}
 out:
-	strs_free( &value, &tag, NULL );
+	str_free( &tag );
 	return ret;
 }
 
@@ -288,7 +304,8 @@ isiin_addauthors( fields *isiin, fields *info, int reftype, variants *all, int n
 {
 	char *newtag, *authortype, use_af[]="AF", use_au[]="AU";
 	int level, i, n, has_af=0, has_au=0, nfields, ok;
-	str *t, *d;
+	const str *t;
+	str *d;
 
 	nfields = fields_num( isiin );
 	for ( i=0; i<nfields && has_af==0; ++i ) {
@@ -313,7 +330,7 @@ isiin_addauthors( fields *isiin, fields *info, int reftype, variants *all, int n
 }
 
 static int
-isiin_keyword( fields *bibin, int n, str *intag, str *invalue, int level, param *pm, char *outtag, fields *bibout )
+isiin_keyword( fields *bibin, int n, const str *intag, str *invalue, int level, param *pm, char *outtag, fields *bibout )
 {
 	int fstatus, status = BIBL_OK;
 	char *p = invalue->data;
@@ -345,7 +362,7 @@ isiin_report_notag( param *p, char *tag )
 static int
 isiin_convertf( fields *bibin, fields *bibout, int reftype, param *p )
 {
-	static int (*convertfns[NUM_REFTYPES])(fields *, int, str *, str *, int, param *, char *, fields *) = {
+	static int (*convertfns[NUM_REFTYPES])(fields *, int, const str *, str *, int, param *, char *, fields *) = {
 		[ 0 ... NUM_REFTYPES-1 ] = generic_null,
 		[ SIMPLE       ] = generic_simple,
 		[ TITLE        ] = generic_title,
@@ -357,7 +374,8 @@ isiin_convertf( fields *bibin, fields *bibout, int reftype, param *p )
 	};
 
 	int process, level, i, nfields, status;
-	str *intag, *invalue;
+	const str *intag;
+	str *invalue;
 	char *outtag;
 
 	status = isiin_addauthors( bibin, bibout, reftype, p->all, p->nall, &(p->asis), &(p->corps) );
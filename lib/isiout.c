@@ -36,6 +36,8 @@ isiout_initparams( param *p, const char *progname )
 	p->verbose          = 0;
 	p->addcount         = 0;
 	p->singlerefperfile = 0;
+	p->sortkey          = BIBL_SORT_NONE;
+	p->dedup            = BIBL_DEDUP_NONE;
 
 	if ( p->charsetout == BIBL_CHARSET_UNICODE ) {
 		p->utf8out = p->utf8bom = 1;
@@ -57,7 +59,8 @@ static int
 get_type( fields *in )
 {
         int type = TYPE_UNKNOWN, i, n, level;
-	char *tag, *value;
+	const char *tag;
+	char *value;
 	n = fields_num( in );
         for ( i=0; i<n; ++i ) {
 		tag = fields_tag( in, i, FIELDS_CHRP );
@@ -133,26 +136,24 @@ append_abbrtitle( fields *in, char *isitag, int level, fields *out, int *status
 static void
 append_keywords( fields *in, fields *out, int *status )
 {
-	vplist_index i;
 	str keywords;
-	int fstatus;
-	vplist kw;
+	char *kw;
+	int i, fstatus;
+	fields_iter it;
 
 	str_init( &keywords );
-	vplist_init( &kw );
-
-	fields_findv_each( in, LEVEL_ANY, FIELDS_STRP, &kw, "KEYWORD" );
-	if ( kw.n ) {
-		for ( i=0; i<kw.n; ++i ) {
-			if ( i>0 ) str_strcatc( &keywords, "; " );
-			str_strcat( &keywords, (str *) vplist_get( &kw, i ) );
-		}
+
+	fields_iter_init( &it, in, LEVEL_ANY, FIELDS_CHRP, "KEYWORD", NULL );
+	for ( i=0; ( kw = fields_iter_next( &it ) ); ++i ) {
+		if ( i>0 ) str_strcatc( &keywords, "; " );
+		str_strcatc( &keywords, kw );
+	}
+	if ( i ) {
 		if ( str_memerr( &keywords ) ) { *status = BIBL_ERR_MEMERR; goto out; }
 		fstatus = fields_add( out, "DE", str_cstr( &keywords ), LEVEL_MAIN );
 		if ( fstatus!=FIELDS_OK ) { *status = BIBL_ERR_MEMERR; goto out; }
 	}
 out:
-	vplist_free( &kw );
 	str_free( &keywords );
 }
 
@@ -196,17 +197,16 @@ process_person( str *person, char *name )
 static void
 append_people( fields *f, char *tag, char *isitag, int level, fields *out, int *status )
 {
-	vplist_index i;
-	vplist people;
+	int i, fstatus;
+	fields_iter it;
 	str person;
-	int fstatus;
+	char *name;
 
 	str_init( &person );
-	vplist_init( &people );
 
-	fields_findv_each( f, level, FIELDS_CHRP, &people, tag );
-	for ( i=0; i<people.n; ++i ) {
-		process_person( &person, (char *)vplist_get( &people, i ) );
+	fields_iter_init( &it, f, level, FIELDS_CHRP, tag, NULL );
+	for ( i=0; ( name = fields_iter_next( &it ) ); ++i ) {
+		process_person( &person, name );
 		if ( str_memerr( &person ) ) { *status = BIBL_ERR_MEMERR; goto out; }
 		if ( i==0 ) fstatus = fields_add_can_dup( out, isitag, str_cstr( &person ), LEVEL_MAIN );
 		else        fstatus = fields_add_can_dup( out, "  ",   str_cstr( &person ), LEVEL_MAIN );
@@ -214,7 +214,6 @@ append_people( fields *f, char *tag, char *isitag, int level, fields *out, int *
 	}
 
 out:
-	vplist_free( &people );
 	str_free( &person );
 }
 
@@ -234,17 +233,15 @@ append_easy( fields *in, char *tag, char *isitag, int level, fields *out, int *s
 static void
 append_easyall( fields *in, char *tag, char *isitag, int level, fields *out, int *status )
 {
-	vplist_index i;
+	fields_iter it;
+	char *value;
 	int fstatus;
-	vplist a;
 
-	vplist_init( &a );
-	fields_findv_each( in, level, FIELDS_CHRP, &a, tag );
-	for ( i=0; i<a.n; ++i ) {
-		fstatus = fields_add( out, isitag, (char *) vplist_get( &a, i ), LEVEL_MAIN );
+	fields_iter_init( &it, in, level, FIELDS_CHRP, tag, NULL );
+	while ( ( value = fields_iter_next( &it ) ) ) {
+		fstatus = fields_add( out, isitag, value, LEVEL_MAIN );
 		if ( fstatus!=FIELDS_OK ) *status = BIBL_ERR_MEMERR;
 	}
-	vplist_free( &a );
 }
 
 static void
@@ -316,7 +313,8 @@ append_data( fields *in, fields *out )
 static void
 output_verbose( fields *f, const char *type, unsigned long refnum )
 {
-	char *tag, *value;
+	const char *tag;
+	char *value;
 	int i, n, level;
 
 	fprintf( stderr, "REF #%lu %s---\n", refnum+1, type );
@@ -350,22 +348,27 @@ output( FILE *fp, fields *out )
 static int
 isiout_write( fields *in, FILE *fp, param *p, unsigned long refnum )
 {
+	fields local, *out = p->scratch;
 	int status;
-	fields out;
 
-	fields_init( &out );
+	/* fields to reuse for each reference, from bibl_write() */
+	if ( out ) fields_reset( out );
+	else {
+		fields_init( &local );
+		out = &local;
+	}
 
 	if ( p->format_opts & BIBL_FORMAT_VERBOSE )
 		output_verbose( in, "IN", refnum );
 
-	status = append_data( in, &out );
+	status = append_data( in, out );
 
-	if ( status==BIBL_OK ) output( fp, &out );
+	if ( status==BIBL_OK ) output( fp, out );
 
 	if ( p->format_opts & BIBL_FORMAT_VERBOSE )
-		output_verbose( &out, "OUT", refnum );
+		output_verbose( out, "OUT", refnum );
 
-	fields_free( &out );
+	if ( out==&local ) fields_free( &local );
 
 	return status;
 }
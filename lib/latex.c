@@ -495,6 +495,96 @@ static struct latex_chars latex_chars[] = {
 
 static int nlatex_chars = sizeof(latex_chars)/sizeof(struct latex_chars);
 
+/*
+ * The input variants of latex_chars[] as a trie, built on the first
+ * call to latex2char(). Each node is reached by one character from its
+ * parent; its children are a list through next.
+ */
+typedef struct latex_node {
+	int child;            /* first child, 0 if none */
+	int next;             /* next sibling, 0 if none */
+	int entry;            /* latex_chars[] index + 1 of the variant ending here, 0 if none */
+	unsigned char c;      /* character leading to this node */
+} latex_node;
+
+static latex_node *latex_trie = NULL;
+static int latex_trie_built = 0;
+
+static int
+latex_trie_build( void )
+{
+	int i, j, k, n, nnodes = 1, max = 1;
+	const char *v;
+
+	for ( i=0; i<nlatex_chars; ++i )
+		for ( j=0; j<3; ++j )
+			if ( latex_chars[i].variant[j] )
+				max += strlen( latex_chars[i].variant[j] );
+
+	latex_trie = ( latex_node * ) calloc( max, sizeof( latex_node ) );
+	if ( !latex_trie ) return 0;
+
+	for ( i=0; i<nlatex_chars; ++i ) {
+		for ( j=0; j<3; ++j ) {
+			v = latex_chars[i].variant[j];
+			if ( !v ) continue;
+			n = 0;
+			for ( ; *v; ++v ) {
+				k = latex_trie[n].child;
+				while ( k && latex_trie[k].c!=(unsigned char) *v )
+					k = latex_trie[k].next;
+				if ( !k ) {
+					k = nnodes++;
+					latex_trie[k].c = (unsigned char) *v;
+					latex_trie[k].next = latex_trie[n].child;
+					latex_trie[n].child = k;
+				}
+				n = k;
+			}
+			/* the first of identical variants wins */
+			if ( !latex_trie[n].entry ) latex_trie[n].entry = i + 1;
+		}
+	}
+	return 1;
+}
+
+/* longest variant at the start of p, returns its latex_chars[] index or -1 */
+static int
+latex_trie_match( const char *p, int *len )
+{
+	int n = 0, k, best = -1;
+
+	for ( k=0; p[k]; ++k ) {
+		n = latex_trie[n].child;
+		while ( n && latex_trie[n].c!=(unsigned char) p[k] )
+			n = latex_trie[n].next;
+		if ( !n ) break;
+		if ( latex_trie[n].entry ) {
+			best = latex_trie[n].entry - 1;
+			*len = k + 1;
+		}
+	}
+	return best;
+}
+
+/* without the trie: the longest variant, found by trying all of them */
+static int
+latex_linear_match( const char *p, int *len )
+{
+	int i, j, n, best = -1;
+	for ( i=0; i<nlatex_chars; ++i ) {
+		for ( j=0; j<3; ++j ) {
+			if ( latex_chars[i].variant[j] == NULL ) continue;
+			n = strlen( latex_chars[i].variant[j] );
+			if ( ( best==-1 || n > *len ) && !strncmp( p, latex_chars[i].variant[j], n ) ) {
+				best = i;
+				*len = n;
+			}
+		}
+	}
+	return best;
+}
+
 /* latex2char()
  *
  *   Use the latex_chars[] lookup table to determine if any character
@@ -504,13 +594,15 @@ static int nlatex_chars = sizeof(latex_chars)/sizeof(struct latex_chars);
  *   meaning that the output is whatever character set was given to us
  *   (which could be Unicode, but is not necessarily Unicode).
  *
+ *   The longest matching code wins, so that "\oe" is not read as "\o"
+ *   followed by "e".
+ *
  */
 unsigned int
 latex2char( char *s, unsigned int *pos, int *unicode )
 {
 	unsigned int value;
-//	char *p, *q[3];
-	int i, j, len;
+	int i, len = 0;
 	char *p;
 
 	p = &( s[*pos] );
@@ -518,80 +610,201 @@ latex2char( char *s, unsigned int *pos, int *unicode )
 	if ( value=='{' || value=='\\' || value=='~' || 
 	     value=='$' || value=='\'' || value=='`' || 
 	     value=='-' || value=='^' ) {
-//		if ( *p=='\\' && ( *p=='{' || *p=='}' ) ) {
-//		} else {
-		for ( i=0; i<nlatex_chars; ++i ) {
-//			q[0] = latex_chars[i].bib1;
-//			l[0] = strlen( q[0] );
-//			q[1] = latex_chars[i].bib2;
-//			l[1] = strlen( q[1] );
-//			q[2] = latex_chars[i].bib3;
-//			l[2] = strlen( q[2] );
-			for ( j=0; j<3; ++j ) {
-				if ( latex_chars[i].variant[j] == NULL ) continue;
-				len = strlen( latex_chars[i].variant[j] );
-				if ( !strncmp( p, latex_chars[i].variant[j], len ) ) {
-					*pos = *pos + len;
-					*unicode = 1;
-					return latex_chars[i].unicode;
-				}
-			}
+		if ( !latex_trie_built ) {
+			latex_trie_build();
+			latex_trie_built = 1;
+		}
+		if ( latex_trie ) i = latex_trie_match( p, &len );
+		else i = latex_linear_match( p, &len );
+		if ( i!=-1 ) {
+			*pos = *pos + len;
+			*unicode = 1;
+			return latex_chars[i].unicode;
 		}
-//		}
 	}
 	*unicode = 0;
 	*pos = *pos + 1;
 	return value;
 }
 
-void
-uni2latex( unsigned int ch, char buf[], int buf_size )
+static void
+latex_out_addchar( char buf[], int buf_size, int *n, char c )
 {
-	int i, j, n;
+	if ( *n < buf_size ) buf[*n] = c;
+	*n = *n + 1;
+}
 
-	if ( buf_size==0 ) return;
+/* latex_out_write()
+ *
+ * The output for latex_chars[i]: the bare combination, {\macro} or
+ * $\math$. Returns the length, which can be more than what fits in buf.
+ */
+static int
+latex_out_write( int i, char buf[], int buf_size )
+{
+	int j, n = 0;
+
+	if ( latex_chars[i].type == LATEX_MACRO ) {
+		latex_out_addchar( buf, buf_size, &n, '{' );
+		latex_out_addchar( buf, buf_size, &n, '\\' );
+	}
+	else if ( latex_chars[i].type == LATEX_MATH ) {
+		latex_out_addchar( buf, buf_size, &n, '$' );
+		latex_out_addchar( buf, buf_size, &n, '\\' );
+	}
+
+	for ( j=0; latex_chars[i].out[j]; ++j )
+		latex_out_addchar( buf, buf_size, &n, latex_chars[i].out[j] );
 
-	buf[0] = '?';
-	buf[1] = '\0';
+	if ( latex_chars[i].type == LATEX_MACRO )
+		latex_out_addchar( buf, buf_size, &n, '}' );
+	else if ( latex_chars[i].type == LATEX_MATH )
+		latex_out_addchar( buf, buf_size, &n, '$' );
 
-	if ( ch==' ' ) {
-		buf[0] = ' '; /*special case to avoid &nbsp;*/
-		return;
+	if ( n < buf_size ) buf[n] = '\0';
+	else if ( buf_size > 0 ) buf[ buf_size-1 ] = '\0';
+
+	return n;
+}
+
+/*
+ * The output for each Unicode character, built on the first call to
+ * uni2latex_str(). The upper bits of the character pick a page of 256
+ * entries, which holds the latex_chars[] index plus one (zero for none);
+ * the strings themselves are made once, in latex_outstr.
+ */
+#define LATEX_PAGEBITS ( 8 )
+#define LATEX_PAGESIZE ( 1 << LATEX_PAGEBITS )
+
+typedef struct latex_out {
+	char *s;
+	int len;
+} latex_out;
+
+static latex_out latex_outs[ sizeof(latex_chars)/sizeof(struct latex_chars) ];
+static char *latex_outstr = NULL;
+static unsigned short **latex_pages = NULL;
+static unsigned int latex_npages = 0;
+static int latex_outs_built = 0;
+
+static void
+latex_outs_free( void )
+{
+	unsigned int i;
+	if ( latex_pages ) {
+		for ( i=0; i<latex_npages; ++i )
+			if ( latex_pages[i] ) free( latex_pages[i] );
+		free( latex_pages );
 	}
+	if ( latex_outstr ) free( latex_outstr );
+	latex_pages = NULL;
+	latex_npages = 0;
+	latex_outstr = NULL;
+}
+
+static int
+latex_outs_build( void )
+{
+	unsigned int maxuni = 0, page, slot;
+	unsigned long size = 0;
+	unsigned short *p;
+	char *q;
+	int i;
 
 	for ( i=0; i<nlatex_chars; ++i ) {
-		if ( ch == latex_chars[i].unicode ) {
-			n = 0;
+		if ( latex_chars[i].unicode > maxuni ) maxuni = latex_chars[i].unicode;
+		size += latex_out_write( i, NULL, 0 ) + 1;
+	}
 
-			if ( latex_chars[i].type == LATEX_MACRO ) {
-				if ( n < buf_size ) buf[n++] = '{';
-				if ( n < buf_size ) buf[n++] = '\\';
-			}
-			else if ( latex_chars[i].type == LATEX_MATH ) {
-				if ( n < buf_size ) buf[n++] = '$';
-				if ( n < buf_size ) buf[n++] = '\\';
-			}
+	latex_outstr = ( char * ) malloc( size );
+	latex_npages = ( maxuni >> LATEX_PAGEBITS ) + 1;
+	latex_pages = ( unsigned short ** ) calloc( latex_npages, sizeof( unsigned short * ) );
+	if ( !latex_outstr || !latex_pages ) goto err;
 
-			j = 0;
-			while ( latex_chars[i].out[j] ) {
-				if ( n < buf_size ) buf[n++] = latex_chars[i].out[j];
-				j++;
-			}
+	q = latex_outstr;
+	for ( i=0; i<nlatex_chars; ++i ) {
+		latex_outs[i].s   = q;
+		latex_outs[i].len = latex_out_write( i, q, size );
+		q += latex_outs[i].len + 1;
+
+		page = latex_chars[i].unicode >> LATEX_PAGEBITS;
+		slot = latex_chars[i].unicode & ( LATEX_PAGESIZE - 1 );
+		p = latex_pages[page];
+		if ( !p ) {
+			p = ( unsigned short * ) calloc( LATEX_PAGESIZE, sizeof( unsigned short ) );
+			if ( !p ) goto err;
+			latex_pages[page] = p;
+		}
+		/* the first entry for a character wins */
+		if ( !p[slot] ) p[slot] = ( unsigned short )( i + 1 );
+	}
+	return 1;
+err:
+	latex_outs_free();
+	return 0;
+}
 
-			if ( latex_chars[i].type == LATEX_MACRO ) {
-				if ( n < buf_size ) buf[n++] = '}';
-			}
-			else if ( latex_chars[i].type == LATEX_MATH ) {
-				if ( n < buf_size ) buf[n++] = '$';
-			}
+/* uni2latex_str()
+ *
+ * The LaTeX output for Unicode character ch, e.g. "{\'e}" for U+E9, with
+ * its length in *len. Returns NULL if latex_chars[] has no entry for ch.
+ * The string is shared and must not be changed.
+ */
+const char *
+uni2latex_str( unsigned int ch, int *len )
+{
+	static char buf[512];
+	unsigned short *p;
+	int i;
 
-			if ( n < buf_size ) buf[n] = '\0';
-			else buf[ buf_size-1 ] = '\0';
+	if ( ch==' ' ) { /*special case to avoid &nbsp;*/
+		*len = 1;
+		return " ";
+	}
 
-			return;
-		}
+	if ( !latex_outs_built ) {
+		latex_outs_build();
+		latex_outs_built = 1;
 	}
 
-	if ( ch < 128 ) buf[0] = (char)ch;
+	if ( latex_pages ) {
+		if ( ( ch >> LATEX_PAGEBITS ) >= latex_npages ) return NULL;
+		p = latex_pages[ ch >> LATEX_PAGEBITS ];
+		if ( !p || !p[ ch & ( LATEX_PAGESIZE - 1 ) ] ) return NULL;
+		i = p[ ch & ( LATEX_PAGESIZE - 1 ) ] - 1;
+		*len = latex_outs[i].len;
+		return latex_outs[i].s;
+	}
+
+	/* without the tables */
+	for ( i=0; i<nlatex_chars; ++i ) {
+		if ( ch == latex_chars[i].unicode ) {
+			*len = latex_out_write( i, buf, sizeof( buf ) );
+			if ( *len >= (int) sizeof( buf ) ) *len = sizeof( buf ) - 1;
+			return buf;
+		}
+	}
+	return NULL;
 }
 
+void
+uni2latex( unsigned int ch, char buf[], int buf_size )
+{
+	const char *p;
+	char c[2];
+	int n;
+
+	if ( buf_size==0 ) return;
+
+	p = uni2latex_str( ch, &n );
+	if ( !p ) {
+		c[0] = ( ch < 128 ) ? (char) ch : '?';
+		c[1] = '\0';
+		p = c;
+		n = ( c[0] ) ? 1 : 0;
+	}
+
+	if ( n > buf_size-1 ) n = buf_size-1;
+	memcpy( buf, p, n );
+	buf[n] = '\0';
+}
@@ -11,6 +11,7 @@
 
 extern unsigned int latex2char( char *s, unsigned int *pos, int *unicode );
 extern void uni2latex( unsigned int ch, char buf[], int buf_size );
+extern const char *uni2latex_str( unsigned int ch, int *len );
 
 
 #endif
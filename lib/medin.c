@@ -18,7 +18,7 @@
 #include "bibutils.h"
 #include "bibformats.h"
 
-static int medin_readf( FILE *fp, char *buf, int bufsize, int *bufpos, str *line, str *reference, int *fcharset );
+static int medin_readf( reader *r, str *line, str *reference, int *fcharset );
 static int medin_processf( fields *medin, char *data, char *filename, long nref, param *p );
 
 
@@ -36,6 +36,9 @@ medin_initparams( param *p, const char *progname )
 	p->utf8in           = 1;
 	p->nosplittitle     = 0;
 	p->verbose          = 0;
+	p->intern           = 0;
+	p->convcache        = 0;
+	p->borrow           = 0;
 	p->addcount         = 0;
 	p->output_raw       = BIBL_RAW_WITHMAKEREFID |
 	                      BIBL_RAW_WITHCHARCONVERT;
@@ -87,13 +90,13 @@ medin_findendwrapper( char *buf, int ntype )
 }
 
 static int
-medin_readf( FILE *fp, char *buf, int bufsize, int *bufpos, str *line, str *reference, int *fcharset )
+medin_readf( reader *r, str *line, str *reference, int *fcharset )
 {
 	str tmp;
 	char *startptr = NULL, *endptr;
 	int haveref = 0, inref = 0, file_charset = CHARSET_UNKNOWN, m, type = -1;
 	str_init( &tmp );
-	while ( !haveref && str_fget( fp, buf, bufsize, bufpos, line ) ) {
+	while ( !haveref && reader_getline( r, line ) ) {
 		if ( line->data ) {
 			m = xml_getencoding( line );
 			if ( m!=CHARSET_UNKNOWN ) file_charset = m;
@@ -0,0 +1,99 @@
+/*
+ * memstats.c
+ *
+ * Copyright (c) Chris Putnam 2017
+ *
+ * Source code released under the GPL version 2
+ *
+ * Counters of the memory held by the growing buffers of str, fields,
+ * slist and xml, to see what converting a file takes and where.
+ *
+ */
+#include <string.h>
+#include "memstats.h"
+
+static const char *memstats_names[ MEMSTATS_NUM+1 ] = {
+	"str", "fields", "slist", "xml", "total"
+};
+
+#ifndef BIBL_NOMEMSTATS
+
+static memstats counts[ MEMSTATS_NUM+1 ];
+
+static void
+memstats_grow( memstats *m, long n )
+{
+	m->live += n;
+	if ( m->live > m->peak ) m->peak = m->live;
+}
+
+void
+memstats_alloc( int which, unsigned long n )
+{
+	counts[ which ].nalloc++;
+	counts[ MEMSTATS_ALL ].nalloc++;
+	memstats_grow( &(counts[ which ]), (long) n );
+	memstats_grow( &(counts[ MEMSTATS_ALL ]), (long) n );
+}
+
+void
+memstats_realloc( int which, unsigned long oldn, unsigned long newn )
+{
+	counts[ which ].nrealloc++;
+	counts[ MEMSTATS_ALL ].nrealloc++;
+	memstats_grow( &(counts[ which ]), (long) newn - (long) oldn );
+	memstats_grow( &(counts[ MEMSTATS_ALL ]), (long) newn - (long) oldn );
+}
+
+void
+memstats_free( int which, unsigned long n )
+{
+	counts[ which ].live -= (long) n;
+	counts[ MEMSTATS_ALL ].live -= (long) n;
+}
+
+/* memstats_get()
+ *
+ * Fill m with the counters of MEMSTATS_STR, ..., or MEMSTATS_ALL.
+ * Returns 0 (with m zeroed) if the library was built without them.
+ */
+int
+memstats_get( int which, memstats *m )
+{
+	memset( m, 0, sizeof( *m ) );
+	if ( which < 0 || which > MEMSTATS_ALL ) return 0;
+	*m = counts[ which ];
+	return 1;
+}
+
+#else
+
+int
+memstats_get( int which, memstats *m )
+{
+	memset( m, 0, sizeof( *m ) );
+	return 0;
+}
+
+#endif
+
+void
+memstats_report( FILE *fp, const char *progname )
+{
+	memstats m;
+	int i;
+
+	if ( !memstats_get( MEMSTATS_ALL, &m ) ) {
+		if ( progname ) fprintf( fp, "%s: ", progname );
+		fprintf( fp, "memory statistics not compiled in\n" );
+		return;
+	}
+
+	if ( progname ) fprintf( fp, "%s: ", progname );
+	fprintf( fp, "%-8s %12s %12s %10s %10s\n", "memory", "live bytes", "peak bytes", "allocs", "reallocs" );
+	for ( i=0; i<=MEMSTATS_ALL; ++i ) {
+		memstats_get( i, &m );
+		if ( progname ) fprintf( fp, "%s: ", progname );
+		fprintf( fp, "%-8s %12ld %12ld %10ld %10ld\n", memstats_names[i], m.live, m.peak, m.nalloc, m.nrealloc );
+	}
+}
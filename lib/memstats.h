@@ -0,0 +1,51 @@
+/*
+ * memstats.h
+ *
+ * Copyright (c) Chris Putnam 2017
+ *
+ * Source code released under the GPL version 2
+ *
+ */
+#ifndef MEMSTATS_H
+#define MEMSTATS_H
+
+#include <stdio.h>
+
+/* Compile without the counters if BIBL_NOMEMSTATS is defined */
+
+#define MEMSTATS_STR    (0)  /* heap buffers of str */
+#define MEMSTATS_FIELDS (1)  /* entry arrays, indexes and pooled values of fields */
+#define MEMSTATS_SLIST  (2)  /* str arrays of slist */
+#define MEMSTATS_XML    (3)  /* node chunks of xml trees */
+#define MEMSTATS_NUM    (4)
+#define MEMSTATS_ALL    (MEMSTATS_NUM) /* all of the above together */
+
+typedef struct memstats {
+	long live;     /* bytes allocated now */
+	long peak;     /* most bytes allocated at once */
+	long nalloc;   /* number of allocations */
+	long nrealloc; /* number of reallocations */
+} memstats;
+
+#ifndef BIBL_NOMEMSTATS
+
+void memstats_alloc( int which, unsigned long n );
+void memstats_realloc( int which, unsigned long oldn, unsigned long newn );
+void memstats_free( int which, unsigned long n );
+
+#define MEMSTATS_ALLOC( which, n )             memstats_alloc( (which), (n) )
+#define MEMSTATS_REALLOC( which, oldn, newn )  memstats_realloc( (which), (oldn), (newn) )
+#define MEMSTATS_FREE( which, n )              memstats_free( (which), (n) )
+
+#else
+
+#define MEMSTATS_ALLOC( which, n )             do { } while ( 0 )
+#define MEMSTATS_REALLOC( which, oldn, newn )  do { } while ( 0 )
+#define MEMSTATS_FREE( which, n )              do { } while ( 0 )
+
+#endif
+
+int  memstats_get( int which, memstats *m );
+void memstats_report( FILE *fp, const char *progname );
+
+#endif
@@ -31,7 +31,7 @@
 #define Da1  if (0)
 #define Da3  if (1)
 
-static int modsin_readf( FILE *fp, char *buf, int bufsize, int *bufpos, str *line, str *reference, int *fcharset );
+static int modsin_readf( reader *r, str *line, str *reference, int *fcharset );
 static int modsin_processf( fields *medin, char *data, char *filename, long nref, param *p );
 
 /* two helper functions to deal with lanugage attributes in two letter form (ISO 639-1 codes) or three letter form (ISO 639-2), specifically  ISO 639-2/b */
@@ -107,6 +107,9 @@ modsin_initparams( param *p, const char *progname )
 	p->xmlin            = 1;
 	p->nosplittitle     = 0;
 	p->verbose          = 0;
+	p->intern           = 0;
+	p->convcache        = 0;
+	p->borrow           = 0;
 	p->addcount         = 0;
 	p->singlerefperfile = 0;
 	p->output_raw       = BIBL_RAW_WITHMAKEREFID |
@@ -1583,7 +1586,7 @@ modsin_endptr( char *p )
 }
 
 static int
-modsin_readf( FILE *fp, char *buf, int bufsize, int *bufpos, str *line, str *reference, int *fcharset )
+modsin_readf( reader *r, str *line, str *reference, int *fcharset )
 {
 	str tmp;
 	int m, file_charset = CHARSET_UNKNOWN;
@@ -1604,7 +1607,7 @@ modsin_readf( FILE *fp, char *buf, int bufsize, int *bufpos, str *line, str *ref
 			str_segcpy( reference, startptr, endptr );
 			str_strcpyc( line, endptr );
 		}
-	} while ( !endptr && str_fget( fp, buf, bufsize, bufpos, line ) );
+	} while ( !endptr && reader_getline( r, line ) );
 
 	str_free( &tmp );
 	*fcharset = file_charset;
@@ -40,6 +40,8 @@ modsout_initparams( param *p, const char *progname )
 	p->verbose          = 0;
 	p->addcount         = 0;
 	p->singlerefperfile = 0;
+	p->sortkey          = BIBL_SORT_NONE;
+	p->dedup            = BIBL_DEDUP_NONE;
 
 	p->headerf = modsout_writeheader;
 	p->footerf = modsout_writefooter;
@@ -198,7 +200,7 @@ output_title( fields *f, FILE *outptr, int level )
 	/* output shorttitle if it's different from normal title */
 	if ( shrttl!=-1 ) {
 		val = (char *) fields_value( f, shrttl, FIELDS_CHRP );
-		if ( ttl==-1 || subttl!=-1 || strcmp(f->data[ttl].data,val) ) {
+		if ( ttl==-1 || subttl!=-1 || strcmp((char *) fields_value( f, ttl, FIELDS_CHRP_NOUSE ),val) ) {
 			output_tag( outptr, lvl2indent(level),               "titleInfo", NULL, TAG_OPEN,      TAG_NEWLINE, "type", "abbreviated", NULL );
 			output_tag( outptr, lvl2indent(incr_level(level,1)), "title",     val,  TAG_OPENCLOSE, TAG_NEWLINE, NULL );
 			output_tag( outptr, lvl2indent(level),               "titleInfo", NULL, TAG_CLOSE,     TAG_NEWLINE, NULL );
@@ -317,9 +319,9 @@ output_names( fields *f, FILE *outptr, int level )
 	for ( n=0; n<ntypes; ++n ) {
 		for ( i=0; i<nfields; ++i ) {
 			if ( fields_level( f, i )!=level ) continue;
-			if ( f->data[i].len==0 ) continue;
+			if ( fields_nodata( f, i ) ) continue;
 			f_asis = f_corp = f_conf = 0;
-			str_strcpyc( &role, f->tag[i].data );
+			str_strcpyc( &role, fields_tag( f, i, FIELDS_CHRP_NOUSE ) );
 			if ( str_findreplace( &role, ":ASIS", "" )) f_asis=1;
 			if ( str_findreplace( &role, ":CORP", "" )) f_corp=1;
 			if ( str_findreplace( &role, ":CONF", "" )) f_conf=1;
@@ -335,7 +337,7 @@ output_names( fields *f, FILE *outptr, int level )
 				output_tag( outptr, lvl2indent(level),               "name",     NULL, TAG_OPEN,      TAG_NEWLINE, "type", "conference", NULL );
 				output_fil( outptr, lvl2indent(incr_level(level,1)), "namePart", f, i, TAG_OPENCLOSE, TAG_NEWLINE, NULL );
 			} else {
-				output_name(outptr, f->data[i].data, level);
+				output_name(outptr, (char *) fields_value( f, i, FIELDS_CHRP_NOUSE ), level);
 			}
 			output_tag( outptr, lvl2indent(incr_level(level,1)), "role", NULL, TAG_OPEN, TAG_NEWLINE, NULL );
 			if ( names[n].code & MARC_AUTHORITY )
@@ -821,7 +823,7 @@ static void
 output_notes( fields *f, FILE *outptr, int level )
 {
 	int i, n;
-	char *t;
+	const char *t;
 
 	n = fields_num( f );
 	for ( i=0; i<n; ++i ) {
@@ -858,12 +860,12 @@ output_key( fields *f, FILE *outptr, int level )
 	n = fields_num( f );
 	for ( i=0; i<n; ++i ) {
 		if ( fields_level( f, i ) != level ) continue;
-		if ( !strcasecmp( f->tag[i].data, "KEYWORD" ) ) {
+		if ( fields_match_casetag( f, i, "KEYWORD" ) ) {
 			output_tag( outptr, lvl2indent(level),               "subject", NULL, TAG_OPEN,      TAG_NEWLINE, NULL );
 			output_fil( outptr, lvl2indent(incr_level(level,1)), "topic",   f, i, TAG_OPENCLOSE, TAG_NEWLINE, NULL );
 			output_tag( outptr, lvl2indent(level),               "subject", NULL, TAG_CLOSE,     TAG_NEWLINE, NULL );
 		}
-		else if ( !strcasecmp( f->tag[i].data, "EPRINTCLASS" ) ) {
+		else if ( fields_match_casetag( f, i, "EPRINTCLASS" ) ) {
 			output_tag( outptr, lvl2indent(level),               "subject", NULL, TAG_OPEN,      TAG_NEWLINE, NULL );
 			output_fil( outptr, lvl2indent(incr_level(level,1)), "topic",   f, i, TAG_OPENCLOSE, TAG_NEWLINE, "class", "primary", NULL );
 			output_tag( outptr, lvl2indent(level),               "subject", NULL, TAG_CLOSE,     TAG_NEWLINE, NULL );
@@ -913,8 +915,8 @@ output_sn( fields *f, FILE *outptr, int level )
 	/* output _all_ elements of type SERIALNUMBER */
 	n = fields_num( f );
 	for ( i=0; i<n; ++i ) {
-		if ( f->level[i]!=level ) continue;
-		if ( strcasecmp( f->tag[i].data, "SERIALNUMBER" ) ) continue;
+		if ( fields_level( f, i )!=level ) continue;
+		if ( !fields_match_casetag( f, i, "SERIALNUMBER" ) ) continue;
 		output_fil( outptr, lvl2indent(level), "identifier", f, i, TAG_OPENCLOSE, TAG_NEWLINE, "type", "serial number", NULL );
 	}
 }
@@ -942,19 +944,19 @@ output_url( fields *f, FILE *outptr, int level )
 
 	n = fields_num( f );
 	for ( i=0; i<n; ++i ) {
-		if ( f->level[i]!=level ) continue;
-		if ( strcasecmp( f->tag[i].data, "URL" ) ) continue;
+		if ( fields_level( f, i )!=level ) continue;
+		if ( !fields_match_casetag( f, i, "URL" ) ) continue;
 		output_fil( outptr, lvl2indent(incr_level(level,1)), "url", f, i, TAG_OPENCLOSE, TAG_NEWLINE, NULL );
 	}
 	for ( i=0; i<n; ++i ) {
-		if ( f->level[i]!=level ) continue;
-		if ( strcasecmp( f->tag[i].data, "PDFLINK" ) ) continue;
+		if ( fields_level( f, i )!=level ) continue;
+		if ( !fields_match_casetag( f, i, "PDFLINK" ) ) continue;
 /*		output_fil( outptr, lvl2indent(incr_level(level,1)), "url", f, i, TAG_OPENCLOSE, TAG_NEWLINE, "urlType", "pdf", NULL ); */
 		output_fil( outptr, lvl2indent(incr_level(level,1)), "url", f, i, TAG_OPENCLOSE, TAG_NEWLINE, NULL );
 	}
 	for ( i=0; i<n; ++i ) {
-		if ( f->level[i]!=level ) continue;
-		if ( strcasecmp( f->tag[i].data, "FILEATTACH" ) ) continue;
+		if ( fields_level( f, i )!=level ) continue;
+		if ( !fields_match_casetag( f, i, "FILEATTACH" ) ) continue;
 		output_fil( outptr, lvl2indent(incr_level(level,1)), "url", f, i, TAG_OPENCLOSE, TAG_NEWLINE, "displayLabel", "Electronic full text", "access", "raw object", NULL );
 	}
 	if ( location!=-1 )
@@ -1050,7 +1052,8 @@ static void
 modsout_report_unused_tags( fields *f, param *p, unsigned long numrefs )
 {
 	int i, n, nwritten, nunused = 0, level;
-	char *tag, *value;
+	const char *tag;
+	char *value;
 	n = fields_num( f );
 	for ( i=0; i<n; ++i ) {
 		if ( fields_used( f, i ) ) continue;
@@ -450,22 +450,21 @@ out:
 static char *
 name_copy( str *name, char *p )
 {
-	char *start, *end, *q;
+	char *start, *end;
 
 	str_empty( name );
 
 	start = p = skip_ws( p );
 
 	/* strip tailing whitespace and commas */
-	while ( *p && *p!='|' ) p++;
+	p += strcspn( p, "|" );
 
 	end = p;
 	while ( is_ws( *end ) || *end==',' || *end=='|' || *end=='\0' )
 		end--;
 	if ( *p=='|' ) p++;
 
-	for ( q=start; q<=end; q++ )
-		str_addchar( name, *q );
+	if ( end >= start ) str_strncatc( name, start, end-start+1 );
 
 	return p;
 }
@@ -29,7 +29,7 @@ extern int nbib_nall;
  PUBLIC: void nbib_initparams()
 *****************************************************/
 
-static int nbib_readf( FILE *fp, char *buf, int bufsize, int *bufpos, str *line, str *reference, int *fcharset );
+static int nbib_readf( reader *r, str *line, str *reference, int *fcharset );
 static int nbib_processf( fields *nbib, char *p, char *filename, long nref, param *pm );
 static int nbib_typef( fields *nbib, char *filename, int nref, param *p );
 static int nbib_convertf( fields *nbib, fields *info, int reftype, param *p );
@@ -45,6 +45,9 @@ nbibin_initparams( param *p, const char *progname )
 	p->utf8in           = 0;
 	p->nosplittitle     = 0;
 	p->verbose          = 0;
+	p->intern           = 0;
+	p->convcache        = 0;
+	p->borrow           = 0;
 	p->addcount         = 0;
 	p->output_raw       = 0;
 
@@ -103,10 +106,10 @@ nbib_istag( char *buf )
 }
 
 static int
-readmore( FILE *fp, char *buf, int bufsize, int *bufpos, str *line )
+readmore( reader *r, str *line )
 {
 	if ( line->len ) return 1;
-	else return str_fget( fp, buf, bufsize, bufpos, line );
+	else return reader_getline( r, line );
 }
 
 static int
@@ -126,14 +129,14 @@ skip_utf8_bom( str *line, int *fcharset )
 }
 
 static int
-nbib_readf( FILE *fp, char *buf, int bufsize, int *bufpos, str *line, str *reference, int *fcharset )
+nbib_readf( reader *r, str *line, str *reference, int *fcharset )
 {
 	int n, haveref = 0, inref = 0, readtoofar = 0;
 	char *p;
 
 	*fcharset = CHARSET_UNKNOWN;
 
-	while ( !haveref && readmore( fp, buf, bufsize, bufpos, line ) ) {
+	while ( !haveref && readmore( r, line ) ) {
 
 		/* ...references are terminated by an empty line */
 		if ( !line->data || line->len==0 ) {
@@ -293,7 +296,7 @@ nbib_typef( fields *nbib, char *filename, int nref, param *p )
 /* PB  - 2016 May 7 */
 
 static int
-nbibin_date( fields *bibin, int n, str *intag, str *invalue, int level, param *pm, char *outtag, fields *bibout )
+nbibin_date( fields *bibin, int n, const str *intag, str *invalue, int level, param *pm, char *outtag, fields *bibout )
 {
 	int fstatus, status = BIBL_OK;
 	str s;
@@ -373,7 +376,7 @@ out:
 
 /* the LID and AID fields that can be doi's or pii's */
 static int
-nbibin_doi( fields *bibin, int n, str *intag, str *invalue, int level, param *pm, char *outtag, fields *bibout )
+nbibin_doi( fields *bibin, int n, const str *intag, str *invalue, int level, param *pm, char *outtag, fields *bibout )
 {
 	int fstatus, sstatus, status = BIBL_OK;
 	char *id, *type, *usetag="";
@@ -406,7 +409,7 @@ out:
 }
 
 static int
-nbibin_pages( fields *bibin, int n, str *intag, str *invalue, int level, param *pm, char *outtag, fields *bibout )
+nbibin_pages( fields *bibin, int n, const str *intag, str *invalue, int level, param *pm, char *outtag, fields *bibout )
 {
 	int fstatus, status = BIBL_OK;
 	str sp, tmp, ep;
@@ -471,7 +474,7 @@ nbib_report_notag( param *p, char *tag )
 static int
 nbib_convertf( fields *bibin, fields *bibout, int reftype, param *p )
 {
-	static int (*convertfns[NUM_REFTYPES])(fields *, int i, str *, str *, int, param *, char *, fields *) = {
+	static int (*convertfns[NUM_REFTYPES])(fields *, int i, const str *, str *, int, param *, char *, fields *) = {
 		[ 0 ... NUM_REFTYPES-1 ] = generic_null,
 		[ SIMPLE       ] = generic_simple,
 		[ TITLE        ] = generic_title,
@@ -482,7 +485,8 @@ nbib_convertf( fields *bibin, fields *bibout, int reftype, param *p )
 		[ DOI          ] = nbibin_doi,
         };
 	int process, level, i, nfields, status = BIBL_OK;
-	str *intag, *invalue;
+	const str *intag;
+	str *invalue;
 	char *outtag;
 
 	nfields = fields_num( bibin );
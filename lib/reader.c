@@ -0,0 +1,117 @@
+/*
+ * reader.c
+ *
+ * Copyright (c) Chris Putnam 2017
+ *
+ * Source code released under the GPL version 2
+ *
+ * Line reader for the input formats.
+ *
+ * Input is read in READER_BUFSIZE blocks and lines are found with
+ * memchr() in the block, so long lines are copied out in a few large
+ * pieces instead of being rebuilt from many small fgets() calls.
+ *
+ * Lines end at "\n", "\r", "\r\n" or "\n\r", also when the two
+ * characters of a break are split between blocks.
+ */
+#include <stdlib.h>
+#include <string.h>
+#include "reader.h"
+
+void
+reader_init( reader *r, FILE *fp )
+{
+	r->fp   = fp;
+	r->buf  = NULL;
+	r->pos  = 0;
+	r->end  = 0;
+	r->nl   = 0;
+	r->skip = '\0';
+	r->eof  = 0;
+}
+
+void
+reader_free( reader *r )
+{
+	if ( r->buf ) free( r->buf );
+	reader_init( r, NULL );
+}
+
+/* reader_fill()
+ *
+ * Replace the used up block with the next one, returns 0 at end of input.
+ */
+static int
+reader_fill( reader *r )
+{
+	char *p;
+
+	if ( r->eof ) return 0;
+	if ( !r->buf ) {
+		r->buf = ( char * ) malloc( READER_BUFSIZE );
+		if ( !r->buf ) {
+			fprintf(stderr,"Error.  Cannot allocate memory in reader_fill.\n");
+			exit( EXIT_FAILURE );
+		}
+	}
+	r->pos = 0;
+	r->end = fread( r->buf, 1, READER_BUFSIZE, r->fp );
+	if ( r->end==0 ) {
+		r->eof = 1;
+		return 0;
+	}
+	p = memchr( r->buf, '\n', r->end );
+	r->nl = ( p ) ? p - r->buf : r->end;
+	return 1;
+}
+
+/* reader_getline()
+ *
+ * Copy the next line without its line break into line.
+ * Returns 0 if we're done, 1 if we're not done; like str_fget()
+ * a last line without a line break is still returned.
+ */
+int
+reader_getline( reader *r, str *line )
+{
+	unsigned long n;
+	char *p, *q;
+	int found = 0;
+	char ch;
+
+	str_empty( line );
+	while ( 1 ) {
+		if ( r->pos==r->end && !reader_fill( r ) ) return found;
+		p = &( r->buf[ r->pos ] );
+
+		/* finish a "\r\n" or "\n\r" break from the previous line */
+		if ( r->skip ) {
+			ch = r->skip;
+			r->skip = '\0';
+			if ( *p==ch ) {
+				r->pos++;
+				continue;
+			}
+		}
+		found = 1;
+
+		if ( r->nl < r->pos ) {
+			q = memchr( p, '\n', r->end - r->pos );
+			r->nl = ( q ) ? q - r->buf : r->end;
+		}
+		n = r->nl - r->pos;
+		q = memchr( p, '\r', n );
+		if ( q ) n = q - p;
+
+		/* as with fgets(), nothing past an embedded '\0' is kept */
+		q = memchr( p, '\0', n );
+		str_strncatc( line, p, ( q ) ? q - p : n );
+		r->pos += n;
+
+		if ( r->pos < r->end ) {
+			ch = r->buf[ r->pos++ ];
+			r->skip = ( ch=='\n' ) ? '\r' : '\n';
+			return 1;
+		}
+	}
+}
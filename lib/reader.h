@@ -0,0 +1,31 @@
+/*
+ * reader.h
+ *
+ * Copyright (c) Chris Putnam 2017
+ *
+ * Source code released under the GPL version 2
+ *
+ */
+#ifndef READER_H
+#define READER_H
+
+#include <stdio.h>
+#include "str.h"
+
+#define READER_BUFSIZE (1024*1024)
+
+typedef struct reader {
+	FILE *fp;
+	char *buf;
+	unsigned long pos;   /* next unread byte in buf */
+	unsigned long end;   /* end of data read into buf */
+	unsigned long nl;    /* next '\n' at or after pos, end if none */
+	char skip;           /* second half of a two character line break */
+	int eof;
+} reader;
+
+void reader_init( reader *r, FILE *fp );
+void reader_free( reader *r );
+int  reader_getline( reader *r, str *line );
+
+#endif
@@ -10,6 +10,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include <ctype.h>
+#include "is_ws.h"
 #include "str.h"
 #include "str_conv.h"
 #include "fields.h"
@@ -29,7 +30,7 @@ extern int ris_nall;
  PUBLIC: void risin_initparams()
 *****************************************************/
 
-static int risin_readf( FILE *fp, char *buf, int bufsize, int *bufpos, str *line, str *reference, int *fcharset );
+static int risin_readf( reader *r, str *line, str *reference, int *fcharset );
 static int risin_processf( fields *risin, char *p, char *filename, long nref, param *pm );
 static int risin_typef( fields *risin, char *filename, int nref, param *p );
 static int risin_convertf( fields *risin, fields *info, int reftype, param *p );
@@ -45,6 +46,9 @@ risin_initparams( param *p, const char *progname )
 	p->utf8in           = 0;
 	p->nosplittitle     = 0;
 	p->verbose          = 0;
+	p->intern           = 0;
+	p->convcache        = 0;
+	p->borrow           = 1;
 	p->addcount         = 0;
 	p->output_raw       = 0;
 
@@ -124,21 +128,21 @@ is_ris_end_tag( char *p )
 }
 
 static int
-readmore( FILE *fp, char *buf, int bufsize, int *bufpos, str *line )
+readmore( reader *r, str *line )
 {
 	if ( line->len ) return 1;
-	else return str_fget( fp, buf, bufsize, bufpos, line );
+	else return reader_getline( r, line );
 }
 
 static int
-risin_readf( FILE *fp, char *buf, int bufsize, int *bufpos, str *line, str *reference, int *fcharset )
+risin_readf( reader *r, str *line, str *reference, int *fcharset )
 {
 	int haveref = 0, inref = 0, readtoofar = 0;
 	char *p;
 
 	*fcharset = CHARSET_UNKNOWN;
 
-	while ( !haveref && readmore( fp, buf, bufsize, bufpos, line ) ) {
+	while ( !haveref && readmore( r, line ) ) {
 
 		if ( str_is_empty( line ) ) continue;
 
@@ -189,56 +193,69 @@ risin_readf( FILE *fp, char *buf, int bufsize, int *bufpos, str *line, str *refe
  PUBLIC: int risin_processf()
 *****************************************************/
 
+/* Values are not copied out of the record, but terminated in place and
+ * borrowed by the fields, see fields_record().
+ */
 static char*
-process_untagged_line( str *value, char *p )
+process_untagged_line( char **value, int *len, char *p )
 {
+	char *end;
+
 	while ( *p==' ' || *p=='\t' ) p++;
-	while ( *p && *p!='\r' && *p!='\n' )
-		str_addchar( value, *p++ );
+	*value = p;
+	while ( *p && *p!='\r' && *p!='\n' ) p++;
+	end = p;
+	*len = end - *value;
 	while ( *p=='\r' || *p=='\n' ) p++;
+	*end = '\0';
 	return p;
 }
 
 static char*
-process_tagged_line( str *tag, str *value, char *p )
+process_tagged_line( str *tag, char **value, int *len, char *p )
 {
-	int i = 0;
+	char *end;
+	int n;
 
-	while ( i<6 && *p && *p!='\n' && *p!='\r' ) {
-		if ( i<2 ) str_addchar( tag, *p );
-		p++;
-		i++;
-	}
+	/* keep the tag of "TY  - ", skip the rest */
+	n = strcspn( p, "\r\n" );
+	if ( n > 6 ) n = 6;
+	str_strncatc( tag, p, ( n < 2 ) ? n : 2 );
+	p += n;
 
 	while ( *p==' ' || *p=='\t' ) p++;
 
-	while ( *p && *p!='\r' && *p!='\n' )
-		str_addchar( value, *p++ );
-	str_trimendingws( value );
+	*value = p;
+	while ( *p && *p!='\r' && *p!='\n' ) p++;
+	end = p;
+	while ( end > *value && is_ws( *(end-1) ) ) end--;
+	*len = end - *value;
 
 	while ( *p=='\n' || *p=='\r' ) p++;
 
+	*end = '\0';
+
 	return p;
 }
 
 static int
-merge_tag_value( fields *risin, str *tag, str *value, int *tag_added )
+merge_tag_value( fields *risin, str *tag, char *value, int len, int *tag_added )
 {
 	str *oldval;
 	int n, status;
 
-	if ( str_has_value( value ) ) {
+	if ( len > 0 ) {
 		if ( *tag_added==1 ) {
 			n = fields_num( risin );
 			if ( n>0 ) {
 				oldval = fields_value( risin, n-1, FIELDS_STRP );
 				str_addchar( oldval, ' ' );
-				str_strcat( oldval, value );
+				str_strcatc( oldval, value );
 				if ( str_memerr( oldval ) ) return BIBL_ERR_MEMERR;
 			}
 		}
 		else  {
-			status = fields_add( risin, str_cstr( tag ), str_cstr( value ), 0 );
+			status = fields_add_borrowed( risin, str_cstr( tag ), value, len, 0 );
 			if ( status!=FIELDS_OK ) return BIBL_ERR_MEMERR;
 			*tag_added = 1;
 		}
@@ -247,12 +264,12 @@ merge_tag_value( fields *risin, str *tag, str *value, int *tag_added )
 }
 
 static int
-add_tag_value( fields *risin, str *tag, str *value, int *tag_added )
+add_tag_value( fields *risin, str *tag, char *value, int len, int *tag_added )
 {
 	int status;
 
-	if ( str_has_value( value ) ) {
-		status = fields_add( risin, str_cstr( tag ), str_cstr( value ), 0 );
+	if ( len > 0 ) {
+		status = fields_add_borrowed( risin, str_cstr( tag ), value, len, 0 );
 		if ( status!=FIELDS_OK ) return BIBL_ERR_MEMERR;
 		*tag_added = 1;
 	}
@@ -267,19 +284,19 @@ add_tag_value( fields *risin, str *tag, str *value, int *tag_added )
 static int
 risin_processf( fields *risin, char *p, char *filename, long nref, param *pm )
 {
-	int status, tag_added = 0, ret = 1;
-	str tag, value;
+	int status, tag_added = 0, ret = 1, len;
+	char *value;
+	str tag;
 
-	strs_init( &tag, &value, NULL );
+	str_init( &tag );
 
 	while ( *p ) {
 
 		/* ...tag, add entry */
 		if ( is_ris_tag( p ) ) {
 			str_empty( &tag );
-			str_empty( &value );
-			p = process_tagged_line( &tag, &value, p );
-			status = add_tag_value( risin, &tag, &value, &tag_added );
+			p = process_tagged_line( &tag, &value, &len, p );
+			status = add_tag_value( risin, &tag, value, len, &tag_added );
 			if ( status!=BIBL_OK ) {
 				ret = 0;
 				goto out;
@@ -288,9 +305,8 @@ risin_processf( fields *risin, char *p, char *filename, long nref, param *pm )
 
 		/* ...no tag, merge with previous line */
 		else {
-			str_empty( &value );
-			p = process_untagged_line( &value, p );
-			status = merge_tag_value( risin, &tag, &value, &tag_added );
+			p = process_untagged_line( &value, &len, p );
+			status = merge_tag_value( risin, &tag, value, len, &tag_added );
 			if ( status!=BIBL_OK ) {
 				ret = 0;
 				goto out;
@@ -300,7 +316,7 @@ risin_processf( fields *risin, char *p, char *filename, long nref, param *pm )
 	}
 out:
 
-	strs_free( &tag, &value, NULL );
+	str_free( &tag );
 	return ret;
 }
 
@@ -334,7 +350,7 @@ is_uri_file_scheme( char *p )
 }
 
 static int
-risin_linkedfile( fields *bibin, int n, str *intag, str *invalue, int level, param *pm, char *outtag, fields *bibout )
+risin_linkedfile( fields *bibin, int n, const str *intag, str *invalue, int level, param *pm, char *outtag, fields *bibout )
 {
 	int fstatus, m;
 	char *p;
@@ -365,7 +381,7 @@ risin_linkedfile( fields *bibin, int n, str *intag, str *invalue, int level, par
 
 /* scopus puts DOI in the DO or DI tag, but it needs cleaning */
 static int
-risin_doi( fields *bibin, int n, str *intag, str *invalue, int level, param *pm, char *outtag, fields *bibout )
+risin_doi( fields *bibin, int n, const str *intag, str *invalue, int level, param *pm, char *outtag, fields *bibout )
 {
 	int fstatus, doi;
 	doi = is_doi( str_cstr( invalue ) );
@@ -377,7 +393,7 @@ risin_doi( fields *bibin, int n, str *intag, str *invalue, int level, param *pm,
 }
 
 static int
-risin_date( fields *bibin, int n, str *intag, str *invalue, int level, param *pm, char *outtag, fields *bibout )
+risin_date( fields *bibin, int n, const str *intag, str *invalue, int level, param *pm, char *outtag, fields *bibout )
 {
 	char *p = invalue->data;
 	int part, status;
@@ -428,7 +444,7 @@ risin_date( fields *bibin, int n, str *intag, str *invalue, int level, param *pm
 }
 
 static int
-risin_person( fields *bibin, int n, str *intag, str *invalue, int level, param *pm, char *outtag, fields *bibout )
+risin_person( fields *bibin, int n, const str *intag, str *invalue, int level, param *pm, char *outtag, fields *bibout )
 {
 	int i, begin, end, ok, status = BIBL_OK;
 	slist tokens;
@@ -476,7 +492,8 @@ static int
 risin_thesis_hints( fields *bibin, int reftype, param *p, fields *bibout )
 {
 	int i, nfields, fstatus;
-	char *tag, *value;
+	const char *tag;
+	char *value;
 
 	if ( strcasecmp( p->all[reftype].type, "THES" ) ) return BIBL_OK;
 
@@ -509,7 +526,7 @@ risin_report_notag( param *p, char *tag )
 static int
 risin_convertf( fields *bibin, fields *bibout, int reftype, param *p )
 {
-	static int (*convertfns[NUM_REFTYPES])(fields *, int, str *, str *, int, param *, char *, fields *) = {
+	static int (*convertfns[NUM_REFTYPES])(fields *, int, const str *, str *, int, param *, char *, fields *) = {
 		[ 0 ... NUM_REFTYPES-1 ] = generic_null,
 		[ SIMPLE       ] = generic_simple,
 		[ TITLE        ] = generic_title,
@@ -522,7 +539,8 @@ risin_convertf( fields *bibin, fields *bibout, int reftype, param *p )
 		[ LINKEDFILE   ] = risin_linkedfile,
         };
 	int process, level, i, nfields, status = BIBL_OK;
-	str *intag, *invalue;
+	const str *intag;
+	str *invalue;
 	char *outtag;
 
 	nfields = fields_num( bibin );
@@ -38,6 +38,8 @@ risout_initparams( param *p, const char *progname )
 	p->verbose          = 0;
 	p->addcount         = 0;
 	p->singlerefperfile = 0;
+	p->sortkey          = BIBL_SORT_NONE;
+	p->dedup            = BIBL_DEDUP_NONE;
 
 	if ( p->charsetout == BIBL_CHARSET_UNICODE ) {
 		p->utf8out = p->utf8bom = 1;
@@ -142,7 +144,7 @@ verbose_type_identified( char *element_type, param *p, int type )
 }
 
 static void
-verbose_type_assignment( char *tag, char *value, param *p, int type )
+verbose_type_assignment( const char *tag, char *value, param *p, int type )
 {
 	if ( p->progname ) fprintf( stderr, "%s: ", p->progname );
 	fprintf( stderr, "Type from tag '%s' data '%s': ", tag, value );
@@ -186,13 +188,14 @@ get_type_genre( fields *f, param *p )
 		{ "map",                       TYPE_MAP },
 	};
 	int nmatch_genres = sizeof( match_genres ) / sizeof( match_genres[0] );
-	char *tag, *value;
+	const char *tag;
+	char *value;
 	int type, i, j;
 
 	type = TYPE_UNKNOWN;
 
 	for ( i=0; i<fields_num( f ); ++i ) {
-		tag = ( char * ) fields_tag( f, i, FIELDS_CHRP );
+		tag = fields_tag( f, i, FIELDS_CHRP );
 		if ( strcmp( tag, "GENRE" ) && strcmp( tag, "NGENRE" ) ) continue;
 		value = ( char * ) fields_value( f, i, FIELDS_CHRP );
 		for ( j=0; j<nmatch_genres; ++j )
@@ -232,18 +235,15 @@ get_type_resource( fields *f, param *p )
 		{ "cartographic",              TYPE_MAP     },
 	};
 	int nmatch_res = sizeof( match_res ) / sizeof( match_res[0] );
-	vplist_index i;
+	fields_iter it;
 	int type, j;
 	char *value;
-	vplist a;
 
 	type = TYPE_UNKNOWN;
 
-	vplist_init( &a );
-	fields_findv_each( f, LEVEL_ANY, FIELDS_CHRP, &a, "RESOURCE" );
+	fields_iter_init( &it, f, LEVEL_ANY, FIELDS_CHRP, "RESOURCE", NULL );
 
-	for ( i=0; i<a.n; ++i ) {
-		value = ( char * ) vplist_get( &a, i );
+	while ( ( value = fields_iter_next( &it ) ) ) {
 		for ( j=0; j<nmatch_res; ++j ) {
 			if ( !strcasecmp( value, match_res[j].name ) )
 				type = match_res[j].type;
@@ -253,7 +253,6 @@ get_type_resource( fields *f, param *p )
 
 	if ( p->verbose ) verbose_type_identified( "resource", p, type );
 
-	vplist_free( &a );
 	return type;
 }
 
@@ -269,7 +268,7 @@ get_type_issuance( fields *f, param *p )
 		if ( !strcasecmp( (char *) fields_tag( f, i, FIELDS_CHRP_NOUSE ), "issuance" ) &&
 		     !strcasecmp( (char *) fields_value( f, i, FIELDS_CHRP_NOUSE ), "MONOGRAPHIC" ) ){
 			monographic = 1;
-			monographic_level = f->level[i];
+			monographic_level = fields_level( f, i );
 		}
 //		if ( !strcasecmp( (char *) fields_tag( f, i, FIELDS_CHRP_NOUSE ), "typeOfResource" ) &&
 //		     !strcasecmp( (char *) fields_value( f, i, FIELDS_CHRP_NOUSE ), "text" ) ) {
@@ -361,22 +360,20 @@ append_type( int type, param *p, fields *out, int *status )
 static void
 append_people( fields *f, char *tag, char *ristag, int level, fields *out, int *status )
 {
-	vplist_index i;
+	fields_iter it;
 	str oneperson;
-	vplist people;
+	char *person;
 	int fstatus;
 
 	str_init( &oneperson );
-	vplist_init( &people );
-	fields_findv_each( f, level, FIELDS_CHRP, &people, tag );
-	for ( i=0; i<people.n; ++i ) {
-		name_build_withcomma( &oneperson, ( char * ) vplist_get( &people, i ) );
+	fields_iter_init( &it, f, level, FIELDS_CHRP, tag, NULL );
+	while ( ( person = fields_iter_next( &it ) ) ) {
+		name_build_withcomma( &oneperson, person );
 		if ( str_memerr( &oneperson ) ) { *status = BIBL_ERR_MEMERR; goto out; }
 		fstatus = fields_add_can_dup( out, ristag, str_cstr( &oneperson ), LEVEL_MAIN );
 		if ( fstatus!=FIELDS_OK ) { *status = BIBL_ERR_MEMERR; goto out; }
 	}
 out:
-	vplist_free( &people );
 	str_free( &oneperson );
 }
 
@@ -485,17 +482,15 @@ append_pages( fields *in, fields *out, int *status )
 static void
 append_keywords( fields *in, fields *out, int *status )
 {
-	vplist_index i;
+	fields_iter it;
+	char *keyword;
 	int fstatus;
-	vplist vpl;
 
-	vplist_init( &vpl );
-	fields_findv_each( in, LEVEL_ANY, FIELDS_CHRP, &vpl, "KEYWORD" );
-	for ( i=0; i<vpl.n; ++i ) {
-		fstatus = fields_add( out, "KW", ( char * ) vplist_get( &vpl, i ), LEVEL_MAIN );
+	fields_iter_init( &it, in, LEVEL_ANY, FIELDS_CHRP, "KEYWORD", NULL );
+	while ( ( keyword = fields_iter_next( &it ) ) ) {
+		fstatus = fields_add( out, "KW", keyword, LEVEL_MAIN );
 		if ( fstatus!=FIELDS_OK ) *status = BIBL_ERR_MEMERR;
 	}
-	vplist_free( &vpl );
 }
 
 static void
@@ -563,17 +558,14 @@ is_uri_scheme( char *p )
 static void
 append_file( fields *in, char *tag, char *ristag, int level, fields *out, int *status )
 {
-	vplist_index i;
+	fields_iter it;
 	str filename;
 	int fstatus;
-	vplist a;
 	char *fl;
 
 	str_init( &filename );
-	vplist_init( &a );
-	fields_findv_each( in, level, FIELDS_CHRP, &a, tag );
-	for ( i=0; i<a.n; ++i ) {
-		fl = ( char * ) vplist_get( &a, i );
+	fields_iter_init( &it, in, level, FIELDS_CHRP, tag, NULL );
+	while ( ( fl = fields_iter_next( &it ) ) ) {
 		str_empty( &filename );
 		if ( !is_uri_scheme( fl ) ) str_strcatc( &filename, "file:" );
 		str_strcatc( &filename, fl );
@@ -582,7 +574,6 @@ append_file( fields *in, char *tag, char *ristag, int level, fields *out, int *s
 		if ( fstatus!=FIELDS_OK ) { *status = BIBL_ERR_MEMERR; goto out; }
 	}
 out:
-	vplist_free( &a );
 	str_free( &filename );
 }
 
@@ -602,17 +593,15 @@ append_easy( fields *in, char *tag, char *ristag, int level, fields *out, int *s
 static void
 append_easyall( fields *in, char *tag, char *ristag, int level, fields *out, int *status )
 {
-	vplist_index i;
+	fields_iter it;
+	char *value;
 	int fstatus;
-	vplist a;
 
-	vplist_init( &a );
-	fields_findv_each( in, level, FIELDS_CHRP, &a, tag );
-	for ( i=0; i<a.n; ++i ) {
-		fstatus = fields_add( out, ristag, (char *) vplist_get( &a, i ), LEVEL_MAIN );
+	fields_iter_init( &it, in, level, FIELDS_CHRP, tag, NULL );
+	while ( ( value = fields_iter_next( &it ) ) ) {
+		fstatus = fields_add( out, ristag, value, LEVEL_MAIN );
 		if ( fstatus!=FIELDS_OK ) *status = BIBL_ERR_MEMERR;
 	}
-	vplist_free( &a );
 }
 
 static void
@@ -647,7 +636,8 @@ append_allpeople( fields *in, int type, fields *out, int *status )
 static void
 output( FILE *fp, fields *out )
 {
-	char *tag, *value;
+	const char *tag;
+	char *value;
 	int i;
 
 	for ( i=0; i<out->n; ++i ) {
@@ -704,15 +694,20 @@ append_data( fields *in, param *p, fields *out )
 static int
 risout_write( fields *in, FILE *fp, param *p, unsigned long refnum )
 {
+	fields local, *out = p->scratch;
 	int status;
-	fields out;
 
-	fields_init( &out );
+	/* fields to reuse for each reference, from bibl_write() */
+	if ( out ) fields_reset( out );
+	else {
+		fields_init( &local );
+		out = &local;
+	}
 
-	status = append_data( in, p, &out );
-	if ( status==BIBL_OK ) output( fp, &out );
+	status = append_data( in, p, out );
+	if ( status==BIBL_OK ) output( fp, out );
 
-	fields_free( &out );
+	if ( out==&local ) fields_free( &local );
 
 	return status;
 }
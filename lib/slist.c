@@ -11,6 +11,7 @@
  *
  */
 #include "slist.h"
+#include "memstats.h"
 
 /* Do not use asserts in VPLIST_NOASSERT defined */
 #ifdef VPLIST_NOASSERT
@@ -122,6 +123,7 @@ slist_free( slist *a )
 		str_free( &(a->strs[i]) );
 
 	free( a->strs );
+	MEMSTATS_FREE( MEMSTATS_SLIST, sizeof( str ) * a->max );
 	slist_init( a );
 }
 
@@ -267,6 +269,7 @@ slist_alloc( slist *a, slist_index alloc )
 
 	a->strs = ( str* ) malloc( sizeof( str ) * alloc );
 	if ( !(a->strs) ) return SLIST_ERR_MEMERR;
+	MEMSTATS_ALLOC( MEMSTATS_SLIST, sizeof( str ) * alloc );
 
 	a->max = alloc;
 	a->n   = 0;
@@ -285,9 +288,13 @@ slist_realloc( slist *a, slist_index alloc )
 
 	more = ( str* ) realloc( a->strs, sizeof( str ) * alloc );
 	if ( !more ) return SLIST_ERR_MEMERR;
+	MEMSTATS_REALLOC( MEMSTATS_SLIST, sizeof( str ) * a->max, sizeof( str ) * alloc );
 
 	a->strs = more;
 
+	for ( i=0; i<a->max; ++i )
+		str_relocate( &(a->strs[i]) );
+
 	for ( i=a->max; i<alloc; ++i )
 		str_init( &(a->strs[i]) );
 
@@ -532,10 +539,38 @@ slist_remove( slist *a, slist_index n )
 	return SLIST_OK;
 }
 
+static void
+slist_siftdown( slist *a, slist_index n, slist_index len )
+{
+	slist_index child;
+
+	while ( ( child = 2 * n + 1 ) < len ) {
+		if ( child+1 < len && slist_comp_step( a, child, child+1 ) < 0 )
+			child++;
+		if ( slist_comp_step( a, n, child ) >= 0 ) return;
+		slist_swap( a, n, child );
+		n = child;
+	}
+}
+
+/* slist_sort()
+ *
+ * Heapsort in place with slist_swap(); qsort() would move the str
+ * structures behind the back of their inline buffers.
+ */
 void
 slist_sort( slist *a )
 {
-	qsort( a->strs, a->n, sizeof( str ), slist_comp );
+	slist_index i;
+
+	for ( i=a->n/2-1; i>=0; --i )
+		slist_siftdown( a, i, a->n );
+
+	for ( i=a->n-1; i>0; --i ) {
+		slist_swap( a, 0, i );
+		slist_siftdown( a, 0, i );
+	}
+
 	a->sorted = 1;
 }
 
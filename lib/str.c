@@ -19,6 +19,7 @@
 #include <limits.h>
 #include "is_ws.h"
 #include "str.h"
+#include "memstats.h"
 
 /* Do not use asserts in STR_NOASSERT defined */
 #ifdef STR_NOASSERT
@@ -28,6 +29,8 @@
 
 #define str_initlen (64)
 
+#define str_isinline( s ) ( (s)->data==(s)->inbuf )
+
 
 /* Clear memory in resize/free if STR_PARANOIA defined */
 
@@ -41,7 +44,16 @@ str_realloc( str *s, unsigned long minsize )
 	assert( s );
 	size = 2 * s->dim;
 	if (size < minsize) size = minsize;
-	newptr = (char *) realloc( s->data, sizeof( *(s->data) )*size );
+	if ( str_isinline( s ) ) {
+		/* outgrown the inline buffer, move to the heap */
+		if ( size < str_initlen ) size = str_initlen;
+		newptr = (char *) malloc( sizeof( *(s->data) )*size );
+		if ( newptr ) memcpy( newptr, s->data, s->dim );
+		MEMSTATS_ALLOC( MEMSTATS_STR, size );
+	} else {
+		newptr = (char *) realloc( s->data, sizeof( *(s->data) )*size );
+		MEMSTATS_REALLOC( MEMSTATS_STR, s->dim, size );
+	}
 	if ( !newptr ) {
 		fprintf(stderr,"Error.  Cannot reallocate memory (%ld bytes) in str_realloc.\n", sizeof(*(s->data))*size);
 		exit( EXIT_FAILURE );
@@ -63,15 +75,20 @@ str_realloc( str *s, unsigned long minsize )
 	assert( s );
 	size = 2 * s->dim;
 	if ( size < minsize ) size = minsize;
+	if ( size < str_initlen ) size = str_initlen;
 	newptr = (char *) malloc( sizeof( *(s->data) ) * size );
 	if ( !newptr ) {
 		fprintf( stderr, "Error.  Cannot reallocate memory (%d bytes)"
 			" in str_realloc.\n", sizeof(*(s->data))*size );
 		exit( EXIT_FAILURE );
 	}
+	if ( s->data && !str_isinline( s ) )
+		MEMSTATS_REALLOC( MEMSTATS_STR, s->dim, size );
+	else
+		MEMSTATS_ALLOC( MEMSTATS_STR, size );
 	if ( s->data ) {
 		str_nullify( s );
-		free( s->data );
+		if ( !str_isinline( s ) ) free( s->data );
 	}
 	s->data = newptr;
 	s->dim = size;
@@ -177,11 +194,17 @@ str_initalloc( str *s, unsigned long minsize )
 {
 	unsigned long size = str_initlen;
 	assert( s );
-	if ( minsize > str_initlen ) size = minsize;
-	s->data = (char *) malloc (sizeof( *(s->data) ) * size);
-	if ( !s->data ) {
-		fprintf(stderr,"Error.  Cannot allocate memory in str_initalloc.\n");
-		exit( EXIT_FAILURE );
+	if ( minsize <= STR_INLINE ) {
+		s->data = s->inbuf;
+		size = STR_INLINE;
+	} else {
+		if ( minsize > str_initlen ) size = minsize;
+		s->data = (char *) malloc (sizeof( *(s->data) ) * size);
+		if ( !s->data ) {
+			fprintf(stderr,"Error.  Cannot allocate memory in str_initalloc.\n");
+			exit( EXIT_FAILURE );
+		}
+		MEMSTATS_ALLOC( MEMSTATS_STR, size );
 	}
 	s->data[0]='\0';
 	s->dim=size;
@@ -193,7 +216,7 @@ str_new( void )
 {
 	str *s = (str *) malloc( sizeof( *s ) );
 	if ( s )
-		str_initalloc( s, str_initlen );
+		str_initalloc( s, 1 );
 	return s;
 }
 
@@ -209,7 +232,10 @@ str_free( str *s )
 	assert( s );
 	if ( s->data ) {
 		str_nullify( s );
-		free( s->data );
+		if ( !str_isinline( s ) ) {
+			free( s->data );
+			MEMSTATS_FREE( MEMSTATS_STR, s->dim );
+		}
 	}
 	s->dim = 0;
 	s->len = 0;
@@ -275,7 +301,7 @@ str_addchar( str *s, char newchar )
 	assert( s );
 	if ( newchar=='\0' ) return; /* appending '\0' is a null operation */
 	if ( !s->data || s->dim==0 ) 
-		str_initalloc( s, str_initlen );
+		str_initalloc( s, 2 );
 	if ( s->len + 2 > s->dim ) 
 		str_realloc( s, s->len*2 );
 	s->data[s->len++] = newchar;
@@ -312,7 +338,7 @@ str_addutf8( str *s, const char *p )
  *     str_cstr( &keywords )
  */
 char *
-str_cstr( str *s )
+str_cstr( const str *s )
 {
 	assert( s );
 	return s->data;
@@ -359,7 +385,7 @@ static inline void
 str_strcat_internal( str *s, const char *addstr, unsigned long n )
 {
 	str_strcat_ensurespace( s, n );
-	strncat( &(s->data[s->len]), addstr, n );
+	memcpy( &(s->data[s->len]), addstr, n );
 	s->len += n;
 	s->data[s->len]='\0';
 }
@@ -393,25 +419,43 @@ str_strcatc( str *s, const char *from )
 	str_strcat_internal( s, from, n );
 }
 
+/*
+ * Add the n characters at from (which must not include '\0') to the
+ * end of a str in one step.
+ *
+ * Example:
+ *     n = strcspn( p, "|" );
+ *     str_strncatc( &name, p, n );
+ */
 void
-str_segcat( str *s, char *startat, char *endat )
+str_strncatc( str *s, const char *from, unsigned long n )
 {
-	unsigned long n;
-	char *p;
+	assert( s && from );
+	if ( n==0 ) return;
+	str_strcat_internal( s, from, n );
+}
 
+/* str_reserve()
+ *
+ * Make room for n more characters so that appending them will not
+ * reallocate, e.g. when the final length is known up front.
+ */
+void
+str_reserve( str *s, unsigned long n )
+{
+	assert( s );
+	str_strcat_ensurespace( s, n );
+}
+
+void
+str_segcat( str *s, char *startat, char *endat )
+{
 	assert( s && startat && endat );
 	assert( (size_t) startat < (size_t) endat );
 
 	if ( startat==endat ) return;
 
-	n = 0;
-	p = startat;
-	while ( p!=endat ) {
-		n++;
-		p++;
-	}
-
-	str_strcat_internal( s, startat, n );
+	str_strcat_internal( s, startat, (unsigned long) ( endat - startat ) );
 }
 
 void
@@ -445,12 +489,13 @@ str_cpytodelim( str *s, char *p, const char *delim, unsigned char finalstep )
 char *
 str_cattodelim( str *s, char *p, const char *delim, unsigned char finalstep )
 {
+	unsigned long n;
 	assert( s );
-	while ( p && *p && !strchr( delim, *p ) ) {
-		str_addchar( s, *p );
-		p++;
-	}
-	if ( p && *p && finalstep ) p++;
+	if ( !p ) return p;
+	n = strcspn( p, delim );
+	str_strncatc( s, p, n );
+	p += n;
+	if ( *p && finalstep ) p++;
 	return p;
 }
 
@@ -468,13 +513,13 @@ static inline void
 str_strcpy_internal( str *s, const char *p, unsigned long n )
 {
 	str_strcpy_ensurespace( s, n );
-	strncpy( s->data, p, n );
+	memmove( s->data, p, n );
 	s->data[n] = '\0';
 	s->len = n;
 }
 
 void
-str_strcpy( str *s, str *from )
+str_strcpy( str *s, const str *from )
 {
 	assert( s );
 	assert( from );
@@ -499,9 +544,6 @@ str_strcpyc( str *s, const char *from )
 void
 str_segcpy( str *s, char *startat, char *endat )
 {
-	unsigned long n;
-	char *p;
-
 	assert( s && startat && endat );
 	assert( ((size_t) startat) <= ((size_t) endat) );
 
@@ -510,14 +552,7 @@ str_segcpy( str *s, char *startat, char *endat )
 		return;
 	}
 
-	n = 0;
-	p = startat;
-	while ( p!=endat ) {
-		p++;
-		n++;
-	}
-
-	str_strcpy_internal( s, startat, n );
+	str_strcpy_internal( s, startat, (unsigned long) ( endat - startat ) );
 }
 
 /*
@@ -644,12 +679,14 @@ int
 str_fget( FILE *fp, char *buf, int bufsize, int *pbufpos, str *outs )
 {
 	int  bufpos = *pbufpos, done = 0;
+	unsigned long n;
 	char *ok;
 	assert( fp && outs );
 	str_empty( outs );
 	while ( !done ) {
-		while ( buf[bufpos] && buf[bufpos]!='\r' && buf[bufpos]!='\n' )
-			str_addchar( outs, buf[bufpos++] );
+		n = strcspn( &(buf[bufpos]), "\r\n" );
+		str_strncatc( outs, &(buf[bufpos]), n );
+		bufpos += n;
 		if ( buf[bufpos]=='\0' ) {
 			ok = fgets( buf, bufsize, fp );
 			bufpos=*pbufpos=0;
@@ -692,25 +729,29 @@ str_tolower( str *s )
 void
 str_swapstrings( str *s1, str *s2 )
 {
-	char *tmpp;
-	int tmp;
+	str tmp;
 
 	assert( s1 && s2 );
 
-	/* swap dimensioning info */
-	tmp = s1->dim;
-	s1->dim = s2->dim;
-	s2->dim = tmp;
+	/* inline buffers go along with the structures */
+	tmp = *s1;
+	*s1 = *s2;
+	*s2 = tmp;
 
-	/* swap length info */
-	tmp = s1->len;
-	s1->len = s2->len;
-	s2->len = tmp;
+	str_relocate( s1 );
+	str_relocate( s2 );
+}
 
-	/* swap data */
-	tmpp = s1->data;
-	s1->data = s2->data;
-	s2->data = tmpp;
+/* str_relocate( s )
+ *
+ * point the data of a str using its inline buffer back at the
+ * buffer after the str has been moved in memory
+ */
+void
+str_relocate( str *s )
+{
+	assert( s );
+	if ( s->dim==STR_INLINE ) s->data = s->inbuf;
 }
 
 void
@@ -1071,14 +1112,14 @@ str_fill( str *s, unsigned long n, char fillchar )
 }
 
 int
-str_has_value( str *s )
+str_has_value( const str *s )
 {
 	if ( !s || s->len==0 ) return 0;
 	return 1;
 }
 
 int
-str_is_empty( str *s )
+str_is_empty( const str *s )
 {
 	if ( !s || s->len==0 ) return 1;
 	return 0;
@@ -13,10 +13,18 @@
 
 #include <stdio.h>
 
+/* Strings that fit are kept in a buffer inside the str itself, without
+ * a separate allocation. data then points into the str, so a str that
+ * is moved in memory (e.g. realloc() of an array of str) needs
+ * str_relocate() before it is used again.
+ */
+#define STR_INLINE (24)
+
 typedef struct str {
 	char *data;
 	unsigned long dim;
 	unsigned long len;
+	char inbuf[ STR_INLINE ];
 }  str;
 
 str *  str_new         ( void );
@@ -38,8 +46,10 @@ str*   str_strdupc( const char *p );
 
 void   str_strcat ( str *s, str *from );
 void   str_strcatc( str *s, const char *from );
+void   str_strncatc( str *s, const char *from, unsigned long n );
+void   str_reserve( str *s, unsigned long n );
 
-void   str_strcpy ( str *s, str *from );
+void   str_strcpy ( str *s, const str *from );
 void   str_strcpyc( str *s, const char *from );
 
 int    str_strcmp ( const str *s, const str *t );
@@ -71,7 +81,7 @@ void str_indxcat     ( str *s, char *p, unsigned long start, unsigned long stop
 void str_fprintf     ( FILE *fp, str *s );
 int  str_fget        ( FILE *fp, char *buf, int bufsize, int *pbufpos,
                           str *outs );
-char * str_cstr      ( str *s );
+char * str_cstr      ( const str *s );
 char str_char        ( str *s, unsigned long n );
 char str_revchar     ( str *s, unsigned long n );
 int  str_fgetline    ( str *s, FILE *fp );
@@ -81,6 +91,7 @@ void str_tolower     ( str *s );
 void str_trimstartingws( str *s );
 void str_trimendingws( str *s );
 void str_swapstrings ( str *s1, str *s2 );
+void str_relocate    ( str *s );
 void str_stripws     ( str *s );
 
 int  str_match_first ( str *s, char ch );
@@ -101,8 +112,8 @@ int  str_is_uppercase( str *s );
 
 int  str_memerr( str *s );
 
-int  str_has_value( str *s );
-int  str_is_empty( str *s );
+int  str_has_value( const str *s );
+int  str_is_empty( const str *s );
 /* str_strlen added for KTH DiVA */
 int  str_strlen( str *s );
 
@@ -20,23 +20,39 @@
 #include "charsets.h"
 #include "str_conv.h"
 
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+/* "&#%d;" without sprintf() */
 static void
 addentity( str *s, unsigned int ch )
 {
-	char buf[512];
-	sprintf( buf, "&#%d;", ch );
-	str_strcatc( s, buf );
+	unsigned int n = ( (int) ch < 0 ) ? -ch : ch;
+	char buf[16];
+	int i = sizeof( buf );
+	buf[--i] = ';';
+	do {
+		buf[--i] = '0' + n % 10;
+		n /= 10;
+	} while ( n );
+	if ( (int) ch < 0 ) buf[--i] = '-';
+	buf[--i] = '#';
+	buf[--i] = '&';
+	str_strncatc( s, &(buf[i]), sizeof( buf ) - i );
 }
 
 /* These are the five minimal predefined entites in XML */
 static int
 minimalxmlchars( str *s, unsigned int ch )
 {
-	if ( ch==34 )      { str_strcatc( s, "&quot;" ); return 1; }
-	else if ( ch==38 ) { str_strcatc( s, "&amp;" );  return 1; }
-	else if ( ch==39 ) { str_strcatc( s, "&apos;" ); return 1; }
-	else if ( ch==60 ) { str_strcatc( s, "&lt;" );   return 1; }
-	else if ( ch==62 ) { str_strcatc( s, "&gt;" );   return 1; }
+	switch ( ch ) {
+	case 34: str_strncatc( s, "&quot;", 6 ); return 1;
+	case 38: str_strncatc( s, "&amp;", 5 );  return 1;
+	case 39: str_strncatc( s, "&apos;", 6 ); return 1;
+	case 60: str_strncatc( s, "&lt;", 4 );   return 1;
+	case 62: str_strncatc( s, "&gt;", 4 );   return 1;
+	}
 	return 0;
 }
 
@@ -52,15 +68,15 @@ static void
 addutf8char( str *s, unsigned int ch, int xmlout )
 {
 	unsigned char code[6];
-	int nc, i;
+	int nc;
 	if ( xmlout ) {
 		if ( minimalxmlchars( s, ch ) ) return;
 		if ( ch > 127 && xmlout == STR_CONV_XMLOUT_ENTITIES )
 			{ addentity( s, ch ); return; }
 	}
+	if ( ch==0 ) return; /* as str_addchar() */
 	nc = utf8_encode( ch, code );
-	for ( i=0; i<nc; ++i )
-		str_addchar( s, code[i] );
+	str_strncatc( s, (char *) code, nc );
 }
 
 static void
@@ -81,17 +97,17 @@ addgb18030char( str *s, unsigned int ch, int xmlout )
 static void
 addlatexchar( str *s, unsigned int ch, int xmlout, int utf8out )
 {
-	char buf[512];
-	uni2latex( ch, buf, sizeof( buf ) );
+	const char *p;
+	int n;
+	p = uni2latex_str( ch, &n );
+	if ( p ) str_strncatc( s, p, n );
+	else if ( ch < 128 ) str_addchar( s, (char) ch );
 	/* If the unicode character isn't recognized as latex output
 	 * a '?' unless the user has requested unicode output.  If so,
 	 * output the unicode.
 	 */
-	if ( utf8out && !strcmp( buf, "?" ) ) {
-		addutf8char( s, ch, xmlout );
-	} else {
-		str_strcatc( s, buf );
-	}
+	else if ( utf8out ) addutf8char( s, ch, xmlout );
+	else str_addchar( s, '?' );
 }
 
 /*
@@ -161,36 +177,553 @@ write_unicode( str *s, unsigned int ch, int charsetout, int latexout,
 	return 1;
 }
 
+static int
+is_minimalxmlchar( unsigned int ch )
+{
+	return ( ch==34 || ch==38 || ch==39 || ch==60 || ch==62 );
+}
+
+/*
+ * Work out the ASCII characters that get_unicode() and write_unicode()
+ * pass through unchanged for the settings in c. Runs of them can be
+ * copied as they are.
+ */
+static void
+str_conv_cleantable( str_conv *c )
+{
+	unsigned int i, ch;
+	char buf[512];
+	int clean;
+
+	c->nspecial = 0;
+	c->clean[0] = 0;
+
+	for ( i=1; i<128; ++i ) {
+
+		/* can start an xml entity or a latex sequence? */
+		clean = 1;
+		if ( c->xmlin && i=='&' ) clean = 0;
+		if ( c->latexin && c->charsetin!=CHARSET_GB18030 && strchr( "{\\~$'`-^", i ) ) clean = 0;
+
+		/* decoded as in get_unicode() */
+		if ( c->charsetin==CHARSET_GB18030 || c->charsetin==CHARSET_UNICODE ) ch = i;
+		else ch = charset_lookupchar( c->charsetin, (char) i );
+
+		/* encoded as in write_unicode() */
+		if ( ch!=i ) clean = 0;
+		else if ( c->latexout ) {
+			uni2latex( ch, buf, sizeof( buf ) );
+			if ( buf[0]!=(char) i || buf[1]!='\0' ) clean = 0;
+		} else if ( c->utf8out || c->charsetout==CHARSET_GB18030 ) {
+			if ( c->xmlout && is_minimalxmlchar( ch ) ) clean = 0;
+		} else {
+			if ( charset_lookupuni( c->charsetout, ch )!=i ) clean = 0;
+			else if ( c->xmlout && is_minimalxmlchar( ch ) ) clean = 0;
+		}
+
+		c->clean[i] = clean;
+		if ( !clean ) {
+			if ( c->nspecial < 16 ) c->special[ c->nspecial ] = i;
+			c->nspecial++;
+		}
+	}
+}
+
+/* str_conv_span()
+ *
+ * Length of the run of clean characters at the start of the n
+ * characters at p; with highbit set, bytes above ASCII are let
+ * through as well, to be looked at by the caller.
+ */
+static unsigned long
+str_conv_span( str_conv *c, const unsigned char *p, unsigned long n, int highbit )
+{
+	unsigned long i = 0;
+#ifdef __SSE2__
+	/* 16 at a time: no byte with the high bit set or equal to a special */
+	__m128i v, bad, special[16];
+	unsigned int mask;
+	int k;
+
+	if ( c->nspecial <= 16 && n >= 16 ) {
+		for ( k=0; k<c->nspecial; ++k )
+			special[k] = _mm_set1_epi8( (char) c->special[k] );
+		for ( ; i+16<=n; i+=16 ) {
+			v = _mm_loadu_si128( (const __m128i *)( p+i ) );
+			bad = ( highbit ) ? _mm_setzero_si128() : v;
+			for ( k=0; k<c->nspecial; ++k )
+				bad = _mm_or_si128( bad, _mm_cmpeq_epi8( v, special[k] ) );
+			mask = _mm_movemask_epi8( bad );
+			if ( mask ) {
+#ifdef __GNUC__
+				return i + __builtin_ctz( mask );
+#else
+				while ( !( mask & 1 ) ) {
+					mask >>= 1;
+					i++;
+				}
+				return i;
+#endif
+			}
+		}
+	}
+#endif
+	if ( highbit )
+		while ( i<n && ( p[i]>=128 || c->clean[ p[i] ] ) ) i++;
+	else
+		while ( i<n && p[i]<128 && c->clean[ p[i] ] ) i++;
+	return i;
+}
+
+static unsigned long
+str_conv_cleanspan( str_conv *c, const unsigned char *p, unsigned long n )
+{
+	return str_conv_span( c, p, n, 0 );
+}
+
+/* copy the clean run at pos, returns its length */
+static unsigned long
+str_conv_copyclean( str_conv *c, str *s, str *ns, unsigned int pos )
+{
+	unsigned long n;
+	n = str_conv_cleanspan( c, (unsigned char *) &(s->data[pos]), s->len - pos );
+	if ( n ) str_strncatc( ns, &(s->data[pos]), n );
+	return n;
+}
+
+static void
+str_conv_addutf8( str *ns, unsigned int ch )
+{
+	unsigned char code[6];
+	int nc;
+	if ( ch==0 ) return; /* as str_addchar() */
+	nc = utf8_encode( ch, code );
+	str_strncatc( ns, (char *) code, nc );
+}
+
+/*
+ * Conversion loops from pos to the end of s, appending to ns. Each
+ * returns 0 on error. The general one follows all of the settings for
+ * every character, the others are for the common combinations and only
+ * do what those need.
+ *
+ * A truncated multibyte character can be decoded past the end, so the
+ * loops stop at s->len as well as at the '\0'.
+ */
+static int
+str_conv_general( str_conv *c, str *s, str *ns, unsigned int pos )
+{
+	unsigned int ch;
+	unsigned long n;
+	int ok;
+
+	while ( pos < s->len && s->data[pos] ) {
+		n = str_conv_copyclean( c, s, ns, pos );
+		if ( n ) { pos += n; continue; }
+		ch = get_unicode( s, &pos, c->charsetin, c->latexin, c->utf8in, c->xmlin );
+		ok = write_unicode( ns, ch, c->charsetout, c->latexout, c->utf8out, c->xmlout );
+		if ( !ok ) return 0;
+	}
+	return 1;
+}
+
+/* copy the run at pos of clean characters and of well-formed UTF-8
+ * characters above ASCII, which decoding and encoding would leave as
+ * they are, in one go; returns its length */
+static unsigned long
+str_conv_copyutf8( str_conv *c, str *s, str *ns, unsigned int pos )
+{
+	const unsigned char *p = (unsigned char *) &(s->data[pos]);
+	unsigned long n = 0, end;
+	int len;
+	end = str_conv_span( c, p, s->len - pos, 1 );
+	while ( n < end ) {
+		if ( p[n] & 128 ) {
+			len = utf8_valid_seqlen( (char *) &(p[n]), end - n );
+			if ( !len ) break;
+			n += len;
+		} else n++;
+	}
+	if ( n ) str_strncatc( ns, (char *) p, n );
+	return n;
+}
+
+/* UTF-8, perhaps with XML entities, to plain UTF-8: reading MODS, EndNote XML... */
+static int
+str_conv_utf8xml_utf8( str_conv *c, str *s, str *ns, unsigned int pos )
+{
+	int unicode, err;
+	unsigned int ch;
+
+	while ( pos < s->len && s->data[pos] ) {
+		pos += str_conv_copyutf8( c, s, ns, pos );
+		if ( pos >= s->len || !s->data[pos] ) break;
+		if ( c->xmlin && s->data[pos]=='&' ) {
+			unicode = err = 0;
+			ch = decode_entity( s->data, &pos, &unicode, &err );
+		} else
+			ch = utf8_decode( s->data, &pos );
+		str_conv_addutf8( ns, ch );
+	}
+	return 1;
+}
+
+/* LaTeX in ASCII or UTF-8 to plain UTF-8: reading BibTeX */
+static int
+str_conv_latex_utf8( str_conv *c, str *s, str *ns, unsigned int pos )
+{
+	unsigned int ch;
+	unsigned long n;
+	int unicode;
+
+	while ( pos < s->len && s->data[pos] ) {
+		n = str_conv_copyclean( c, s, ns, pos );
+		if ( n ) { pos += n; continue; }
+		if ( c->utf8in && ( s->data[pos] & 128 ) )
+			ch = utf8_decode( s->data, &pos );
+		else {
+			unicode = 0;
+			ch = latex2char( s->data, &pos, &unicode );
+		}
+		str_conv_addutf8( ns, ch );
+	}
+	return 1;
+}
+
+/* plain UTF-8 to LaTeX: writing BibTeX */
+static int
+str_conv_utf8_latex( str_conv *c, str *s, str *ns, unsigned int pos )
+{
+	unsigned int ch;
+	unsigned long n;
+
+	while ( pos < s->len && s->data[pos] ) {
+		n = str_conv_copyclean( c, s, ns, pos );
+		if ( n ) { pos += n; continue; }
+		ch = utf8_decode( s->data, &pos );
+		addlatexchar( ns, ch, c->xmlout, c->utf8out );
+	}
+	return 1;
+}
+
+/* plain UTF-8 to UTF-8 with XML entities: writing MODS, Word 2007...
+ * The only ASCII characters that aren't clean are the five that XML
+ * escapes, which are spliced in without decoding */
+static int
+str_conv_utf8_utf8xml( str_conv *c, str *s, str *ns, unsigned int pos )
+{
+	unsigned int ch;
+	unsigned long n;
+
+	while ( pos < s->len && s->data[pos] ) {
+		if ( c->xmlout!=STR_CONV_XMLOUT_ENTITIES )
+			n = str_conv_copyutf8( c, s, ns, pos );
+		else
+			n = str_conv_copyclean( c, s, ns, pos );
+		if ( n ) { pos += n; continue; }
+		ch = (unsigned char) s->data[pos];
+		if ( ch < 128 ) {
+			if ( !minimalxmlchars( ns, ch ) ) str_addchar( ns, ch );
+			pos++;
+			continue;
+		}
+		ch = utf8_decode( s->data, &pos );
+		addutf8char( ns, ch, c->xmlout );
+	}
+	return 1;
+}
+
 /*
- * Returns 1 on memory error condition
+ * A bounded cache of conversions, from the input bytes to the converted
+ * value, for values that come up again and again (journals, publishers,
+ * names of authors). The settings are those of the str_conv it hangs off.
+ * When full, the least recently used entry is replaced.
+ */
+typedef struct str_conv_entry {
+	str in;
+	str out;
+	unsigned long hash;
+	long hnext;      /* next entry in the same bucket, -1 for none */
+	long prev, next; /* neighbours in order of use, -1 for none */
+} str_conv_entry;
+
+struct str_conv_cache {
+	long max;        /* most entries kept */
+	long n;          /* entries in use */
+	long mask;       /* number of buckets less one, a power of two */
+	long *buckets;
+	long first;      /* most recently used entry */
+	long last;       /* least recently used entry */
+	str_conv_entry *entries;
+};
+
+static unsigned long
+str_conv_hash( const char *p, unsigned long n )
+{
+	unsigned long h = 2166136261UL;
+	unsigned long i;
+	for ( i=0; i<n; ++i ) {
+		h ^= (unsigned char) p[i];
+		h *= 16777619UL;
+	}
+	return h;
+}
+
+static void
+str_conv_cache_unlink( struct str_conv_cache *cc, long i )
+{
+	str_conv_entry *e = &(cc->entries[i]);
+	if ( e->prev!=-1 ) cc->entries[ e->prev ].next = e->next;
+	else cc->first = e->next;
+	if ( e->next!=-1 ) cc->entries[ e->next ].prev = e->prev;
+	else cc->last = e->prev;
+}
+
+static void
+str_conv_cache_push( struct str_conv_cache *cc, long i )
+{
+	str_conv_entry *e = &(cc->entries[i]);
+	e->prev = -1;
+	e->next = cc->first;
+	if ( cc->first!=-1 ) cc->entries[ cc->first ].prev = i;
+	else cc->last = i;
+	cc->first = i;
+}
+
+static long
+str_conv_cache_find( struct str_conv_cache *cc, str *s, unsigned long hash )
+{
+	str_conv_entry *e;
+	long i;
+
+	i = cc->buckets[ hash & cc->mask ];
+	while ( i!=-1 ) {
+		e = &(cc->entries[i]);
+		if ( e->hash==hash && e->in.len==s->len &&
+		     !memcmp( e->in.data, s->data, s->len ) ) {
+			if ( cc->first!=i ) {
+				str_conv_cache_unlink( cc, i );
+				str_conv_cache_push( cc, i );
+			}
+			return i;
+		}
+		i = e->hnext;
+	}
+	return -1;
+}
+
+static void
+str_conv_cache_add( struct str_conv_cache *cc, str *in, str *out, unsigned long hash )
+{
+	str_conv_entry *e;
+	long i, *pi;
+
+	if ( cc->n < cc->max ) i = cc->n++;
+	else {
+		/* reuse the least recently used entry */
+		i = cc->last;
+		str_conv_cache_unlink( cc, i );
+		pi = &(cc->buckets[ cc->entries[i].hash & cc->mask ]);
+		while ( *pi!=i ) pi = &(cc->entries[ *pi ].hnext);
+		*pi = cc->entries[i].hnext;
+	}
+
+	e = &(cc->entries[i]);
+	str_strcpy( &(e->in), in );
+	str_strcpy( &(e->out), out );
+	e->hash  = hash;
+	e->hnext = cc->buckets[ hash & cc->mask ];
+	cc->buckets[ hash & cc->mask ] = i;
+	str_conv_cache_push( cc, i );
+}
+
+/* str_conv_cache()
+ *
+ * Keep up to max recent conversions of c, set up by str_conv_init(), so
+ * that a value seen before is copied from the cache rather than converted
+ * again; c->nhit and c->nmiss
+ * count how often that works out. Only values that need converting are
+ * kept. A max of zero or less drops the cache.
+ *
+ * Returns 0 on memory error condition
  */
 int
-str_convert( str *s,
+str_conv_cache( str_conv *c, long max )
+{
+	struct str_conv_cache *cc;
+	long i, nbuckets;
+
+	str_conv_free( c );
+	if ( max <= 0 ) return 1;
+
+	cc = ( struct str_conv_cache * ) malloc( sizeof( struct str_conv_cache ) );
+	if ( !cc ) return 0;
+
+	nbuckets = 16;
+	while ( nbuckets < max * 2 ) nbuckets *= 2;
+
+	cc->buckets = ( long * ) malloc( sizeof( long ) * nbuckets );
+	cc->entries = ( str_conv_entry * ) malloc( sizeof( str_conv_entry ) * max );
+	if ( !cc->buckets || !cc->entries ) {
+		if ( cc->buckets ) free( cc->buckets );
+		if ( cc->entries ) free( cc->entries );
+		free( cc );
+		return 0;
+	}
+
+	for ( i=0; i<nbuckets; ++i )
+		cc->buckets[i] = -1;
+	for ( i=0; i<max; ++i )
+		strs_init( &(cc->entries[i].in), &(cc->entries[i].out), NULL );
+
+	cc->max   = max;
+	cc->n     = 0;
+	cc->mask  = nbuckets - 1;
+	cc->first = -1;
+	cc->last  = -1;
+
+	c->cache = cc;
+	return 1;
+}
+
+/* str_conv_free()
+ *
+ * Free the cache of c, if any; the settings are kept.
+ */
+void
+str_conv_free( str_conv *c )
+{
+	struct str_conv_cache *cc = c->cache;
+	long i;
+
+	if ( !cc ) return;
+	for ( i=0; i<cc->n; ++i )
+		strs_free( &(cc->entries[i].in), &(cc->entries[i].out), NULL );
+	free( cc->entries );
+	free( cc->buckets );
+	free( cc );
+	c->cache = NULL;
+}
+
+/* str_conv_init()
+ *
+ * Set up c for converting strs with these settings, see str_conv_convert().
+ * Working out what a conversion needs is done here once, rather than
+ * for every character. The conversion has no cache until str_conv_cache().
+ */
+void
+str_conv_init( str_conv *c,
 	int charsetin,  int latexin,  int utf8in,  int xmlin,
 	int charsetout, int latexout, int utf8out, int xmlout )
 {
-	unsigned int pos = 0;
-	unsigned int ch;
+	int plainin;
+
+	if ( charsetin==CHARSET_UNKNOWN ) charsetin = CHARSET_DEFAULT;
+	if ( charsetout==CHARSET_UNKNOWN ) charsetout = CHARSET_DEFAULT;
+
+	c->charsetin  = charsetin;
+	c->latexin    = latexin;
+	c->utf8in     = utf8in;
+	c->xmlin      = xmlin;
+	c->charsetout = charsetout;
+	c->latexout   = latexout;
+	c->utf8out    = utf8out;
+	c->xmlout     = xmlout;
+
+	c->cache = NULL;
+	c->nhit  = 0;
+	c->nmiss = 0;
+
+	str_conv_cleantable( c );
+
+	/* UTF-8 in that needs no table lookups */
+	plainin = ( charsetin==CHARSET_UNICODE && utf8in );
+
+	c->convert = str_conv_general;
+	if ( plainin && !latexin && utf8out && !latexout && !xmlout )
+		c->convert = str_conv_utf8xml_utf8;
+	else if ( charsetin==CHARSET_UNICODE && latexin && !xmlin &&
+	          utf8out && !latexout && !xmlout )
+		c->convert = str_conv_latex_utf8;
+	else if ( plainin && !latexin && !xmlin && latexout )
+		c->convert = str_conv_utf8_latex;
+	else if ( plainin && !latexin && !xmlin && utf8out && !latexout && xmlout )
+		c->convert = str_conv_utf8_utf8xml;
+}
+
+/* str_conv_convert()
+ *
+ * Convert s as set up by str_conv_init(), or copy the result from the
+ * cache if s was converted recently.
+ *
+ * Returns 0 on memory error condition
+ */
+int
+str_conv_convert( str_conv *c, str *s )
+{
+	unsigned long n, hash = 0;
+	long i;
 	str ns;
 	int ok = 1;
 
 	if ( !s || s->len==0 ) return ok;
 
-	str_init( &ns );
-
-	if ( charsetin==CHARSET_UNKNOWN ) charsetin = CHARSET_DEFAULT;
-	if ( charsetout==CHARSET_UNKNOWN ) charsetout = CHARSET_DEFAULT;
+	/* nothing to translate, leave s as it is */
+	n = str_conv_cleanspan( c, (unsigned char *) s->data, s->len );
+	if ( n==s->len ) return ok;
 
-	while ( s->data[pos] ) {
-		ch = get_unicode( s, &pos, charsetin, latexin, utf8in, xmlin );
-		ok = write_unicode( &ns, ch, charsetout, latexout, utf8out, xmlout );
-		if ( !ok ) goto out;
+	if ( c->cache ) {
+		hash = str_conv_hash( s->data, s->len );
+		i = str_conv_cache_find( c->cache, s, hash );
+		if ( i!=-1 ) {
+			c->nhit++;
+			str_strcpy( s, &(c->cache->entries[i].out) );
+			return !str_memerr( s );
+		}
+		c->nmiss++;
 	}
 
-	str_swapstrings( s, &ns );
-out:
+	str_init( &ns );
+	str_reserve( &ns, s->len );
+	str_strncatc( &ns, s->data, n );
+
+	ok = c->convert( c, s, &ns, n );
+	if ( ok && c->cache ) str_conv_cache_add( c->cache, s, &ns, hash );
+	if ( ok ) str_swapstrings( s, &ns );
+
 	str_free( &ns );
 
 	return ok;
 }
 
+/*
+ * Returns 0 on memory error condition
+ *
+ * The set up is kept for the settings of the last call, which rarely
+ * change during a conversion.
+ */
+int
+str_convert( str *s,
+	int charsetin,  int latexin,  int utf8in,  int xmlin,
+	int charsetout, int latexout, int utf8out, int xmlout )
+{
+	static str_conv last;
+	static int valid = 0;
+
+	if ( !s || s->len==0 ) return 1;
+
+	if ( charsetin==CHARSET_UNKNOWN ) charsetin = CHARSET_DEFAULT;
+	if ( charsetout==CHARSET_UNKNOWN ) charsetout = CHARSET_DEFAULT;
+
+	if ( !valid ||
+	     last.charsetin!=charsetin   || last.latexin!=latexin ||
+	     last.utf8in!=utf8in         || last.xmlin!=xmlin ||
+	     last.charsetout!=charsetout || last.latexout!=latexout ||
+	     last.utf8out!=utf8out       || last.xmlout!=xmlout ) {
+		str_conv_init( &last, charsetin, latexin, utf8in, xmlin,
+				charsetout, latexout, utf8out, xmlout );
+		valid = 1;
+	}
+
+	return str_conv_convert( &last, s );
+}
@@ -15,6 +15,27 @@
 
 #include "str.h"
 
+struct str_conv_cache;
+
+/* A conversion set up by str_conv_init() */
+typedef struct str_conv {
+	int charsetin, latexin, utf8in, xmlin;
+	int charsetout, latexout, utf8out, xmlout;
+	unsigned char clean[128];  /* ASCII characters passed through as they are */
+	int nspecial;              /* number of ASCII characters that aren't clean */
+	unsigned char special[16]; /* ...and the characters, if no more than 16 */
+	int (*convert)( struct str_conv *c, str *s, str *ns, unsigned int pos );
+	struct str_conv_cache *cache; /* recent conversions, see str_conv_cache() */
+	unsigned long nhit, nmiss;    /* lookups answered and not by the cache */
+} str_conv;
+
+extern void str_conv_init( str_conv *c,
+		int charsetin, int latexin, int utf8in, int xmlin,
+		int charsetout, int latexout, int utf8out, int xmlout );
+extern int  str_conv_cache( str_conv *c, long max );
+extern int  str_conv_convert( str_conv *c, str *s );
+extern void str_conv_free( str_conv *c );
+
 extern int str_convert( str *s,
 		int charsetin, int latexin, int utf8in, int xmlin, 
 		int charsetout, int latexout, int utf8out, int xmlout );
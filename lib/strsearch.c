@@ -15,12 +15,22 @@
  * strsearch returns haystack when needle is empty as per strstr()
  * conventions
  *
+ * With SSE2 (always there on x86-64) the haystack is scanned 16 bytes
+ * at a time for places where the first two characters of needle match
+ * in either case, and only those places are compared in full.
+ *
  */
 #include <stdio.h>
+#include <stddef.h>
 #include <ctype.h>
 #include "strsearch.h"
 
-char *strsearch (const char *haystack, const char *needle)
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+char *
+strsearch_scalar( const char *haystack, const char *needle )
 {
 	char *returnptr=NULL;
 	unsigned long pos=0;
@@ -39,3 +49,93 @@ char *strsearch (const char *haystack, const char *needle)
 	return returnptr;
 }
 
+#ifdef __SSE2__
+
+/* compare the rest of needle at a candidate */
+static int
+strsearch_match( const char *p, const char *needle )
+{
+	while ( *needle ) {
+		if ( toupper( (unsigned char) *p ) != toupper( (unsigned char) *needle ) )
+			return 0;
+		p++;
+		needle++;
+	}
+	return 1;
+}
+
+/*
+ * Only aligned 16 byte blocks are loaded, and the next block only once
+ * the current one holds no '\0', so reads never leave the pages of the
+ * haystack. They can still go past the end of its allocation, which
+ * is fine for the hardware but not for AddressSanitizer.
+ */
+#if defined(__SANITIZE_ADDRESS__)
+#define STRSEARCH_NOASAN __attribute__((no_sanitize_address))
+#elif defined(__has_feature)
+#if __has_feature(address_sanitizer)
+#define STRSEARCH_NOASAN __attribute__((no_sanitize_address))
+#endif
+#endif
+#ifndef STRSEARCH_NOASAN
+#define STRSEARCH_NOASAN
+#endif
+
+STRSEARCH_NOASAN static char *
+strsearch_sse2( const char *haystack, const char *needle )
+{
+	const unsigned char *n = (const unsigned char *) needle;
+	const char *block = (const char *)( (size_t) haystack & ~(size_t) 15 );
+	unsigned int skip = (unsigned int)( haystack - block );
+	__m128i lo1, up1, lo2, up2, zero, cur, next, second, m;
+	unsigned int mask, zmask;
+	int bit;
+
+	zero = _mm_setzero_si128();
+	lo1 = _mm_set1_epi8( (char) tolower( n[0] ) );
+	up1 = _mm_set1_epi8( (char) toupper( n[0] ) );
+	lo2 = _mm_set1_epi8( (char) tolower( n[1] ) );
+	up2 = _mm_set1_epi8( (char) toupper( n[1] ) );
+
+	cur = _mm_load_si128( (const __m128i *) block );
+	while ( 1 ) {
+		m = _mm_or_si128( _mm_cmpeq_epi8( cur, lo1 ), _mm_cmpeq_epi8( cur, up1 ) );
+		zmask = _mm_movemask_epi8( _mm_cmpeq_epi8( cur, zero ) ) >> skip << skip;
+		if ( !zmask ) {
+			/* second character of each position, from this block and the next */
+			next = _mm_load_si128( (const __m128i *)( block + 16 ) );
+			second = _mm_or_si128( _mm_srli_si128( cur, 1 ), _mm_slli_si128( next, 15 ) );
+			m = _mm_and_si128( m, _mm_or_si128( _mm_cmpeq_epi8( second, lo2 ),
+			                                    _mm_cmpeq_epi8( second, up2 ) ) );
+		}
+		mask = _mm_movemask_epi8( m ) >> skip << skip;
+		if ( zmask ) mask &= ( zmask & -zmask ) - 1; /* before the '\0' */
+		while ( mask ) {
+#ifdef __GNUC__
+			bit = __builtin_ctz( mask );
+#else
+			bit = 0;
+			while ( !( mask & ( 1U << bit ) ) ) bit++;
+#endif
+			if ( strsearch_match( block + bit + 1, needle + 1 ) )
+				return (char *)( block + bit );
+			mask &= mask - 1;
+		}
+		if ( zmask ) return NULL;
+		block += 16;
+		skip = 0;
+		cur = next;
+	}
+}
+
+#endif
+
+char *
+strsearch( const char *haystack, const char *needle )
+{
+	if ( !needle[0] ) return (char *) haystack;
+#ifdef __SSE2__
+	if ( needle[1] ) return strsearch_sse2( haystack, needle );
+#endif
+	return strsearch_scalar( haystack, needle );
+}
@@ -10,6 +10,7 @@
 #define STRSEARCH_H
 
 char *strsearch (const char *haystack, const char *needle);
+char *strsearch_scalar (const char *haystack, const char *needle);
 
 #endif
 
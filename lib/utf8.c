@@ -10,6 +10,10 @@
 #include <string.h>
 #include "utf8.h"
 
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
 /* UTF-8 encoding
 
 U-00000000 - U-0000007F:  0xxxxxxx 
@@ -92,53 +96,125 @@ utf8_encode_str( unsigned int value, char outstr[7] )
 	outstr[n] = '\0';
 }
 
+/* utf8_decode()
+ *
+ * Decode the character at s[*pi] and move *pi past it. A byte that
+ * doesn't start a character, or whose continuation bytes are missing
+ * (say at the end of the string), decodes to '?' and is skipped alone.
+ */
 unsigned int
 utf8_decode( char *s, unsigned int *pi )
 {
+	unsigned char *p = ( unsigned char * ) &(s[*pi]);
 	unsigned int c;
-	int i = *pi;
-	/* one digit utf-8 */
-	if ((s[i] & 128)== 0 ) {
-		c = (unsigned int) s[i];
-		i += 1;
-	} else if ((s[i] & 224)== 192 ) { /* 110xxxxx & 111xxxxx == 110xxxxx */
-		c = (( (unsigned int) s[i] & 31 ) << 6) +
-			( (unsigned int) s[i+1] & 63 );
-		i += 2;
-	} else if ((s[i] & 240)== 224 ) { /* 1110xxxx & 1111xxxx == 1110xxxx */
-		c = ( ( (unsigned int) s[i] & 15 ) << 12 ) + 
-			( ( (unsigned int) s[i+1] & 63 ) << 6 ) +
-		 	( (unsigned int) s[i+2] & 63 );
-		i += 3;
-	} else if ((s[i] & 248)== 240 ) { /* 11110xxx & 11111xxx == 11110xxx */
-		c =  ( ( (unsigned int) s[i] & 7 ) << 18 ) +
-			( ( (unsigned int) s[i+1] & 63 ) << 12 ) +
-			( ( (unsigned int) s[i+2] & 63 ) << 6 ) +
-			( (unsigned int) s[i+3] & 63 );
-		i+= 4;
-	} else if ((s[i] & 252)== 248 ) { /* 111110xx & 111111xx == 111110xx */
-		c = ( ( (unsigned int) s[i] & 3 ) << 24 ) +
-			( ( (unsigned int) s[i+1] & 63 ) << 18 ) +
-			( ( (unsigned int) s[i+2] & 63 ) << 12 ) +
-			( ( (unsigned int) s[i+3] & 63 ) << 6 ) +
-			( (unsigned int) s[i+4] & 63 );
-		i += 5;
-	} else if ((s[i] & 254)== 252 ) { /* 1111110x & 1111111x == 1111110x */
-		c = ( ( (unsigned int) s[i] & 1 ) << 30 ) + 
-			( ( (unsigned int) s[i+1] & 63 ) << 24 ) +
-			( ( (unsigned int) s[i+2] & 63 ) << 18 ) +
-			( ( (unsigned int) s[i+3] & 63 ) << 12 ) +
-			( ( (unsigned int) s[i+4] & 63 ) << 6 ) +
-			( (unsigned int) s[i+5] & 63 );
-		i += 6;
-	} else {
+	int i, n;
+
+	if ( p[0] < 0x80 )      { c = p[0];        n = 1; } /* 0xxxxxxx */
+	else if ( p[0] < 0xC0 ) { c = '?';         n = 0; } /* 10xxxxxx continuation */
+	else if ( p[0] < 0xE0 ) { c = p[0] & 0x1F; n = 2; } /* 110xxxxx */
+	else if ( p[0] < 0xF0 ) { c = p[0] & 0x0F; n = 3; } /* 1110xxxx */
+	else if ( p[0] < 0xF8 ) { c = p[0] & 0x07; n = 4; } /* 11110xxx */
+	else if ( p[0] < 0xFC ) { c = p[0] & 0x03; n = 5; } /* 111110xx */
+	else if ( p[0] < 0xFE ) { c = p[0] & 0x01; n = 6; } /* 1111110x */
+	else                    { c = '?';         n = 0; }
+
+	for ( i=1; i<n; ++i ) {
+		if ( ( p[i] & 0xC0 ) != 0x80 ) break; /* also stops at '\0' */
+		c = ( c << 6 ) | ( p[i] & 0x3F );
+	}
+	if ( i<n ) {
 		c = '?';
-		i++;
+		n = 0;
 	}
-	*pi = i;
+
+	*pi = *pi + ( ( n ) ? n : 1 );
 	return c;
 }
 
+/* utf8_ascii_span()
+ *
+ * Number of ASCII bytes (below 0x80) at the start of the n bytes at s.
+ */
+unsigned long
+utf8_ascii_span( const char *s, unsigned long n )
+{
+	const unsigned char *p = ( const unsigned char * ) s;
+	unsigned long i = 0;
+#ifdef __SSE2__
+	unsigned int mask;
+	for ( ; i+16<=n; i+=16 ) {
+		mask = _mm_movemask_epi8( _mm_loadu_si128( (const __m128i *)( p+i ) ) );
+		if ( mask ) {
+#ifdef __GNUC__
+			return i + __builtin_ctz( mask );
+#else
+			while ( !( mask & 1 ) ) {
+				mask >>= 1;
+				i++;
+			}
+			return i;
+#endif
+		}
+	}
+#endif
+	while ( i<n && p[i]<0x80 ) i++;
+	return i;
+}
+
+/* utf8_valid_seqlen()
+ *
+ * Length of the well-formed UTF-8 character at the start of the n bytes
+ * at s, or 0 if there isn't one. Well-formed is as in RFC 3629: at most
+ * four bytes, no overlong forms, no surrogates and nothing past U+10FFFF.
+ */
+int
+utf8_valid_seqlen( const char *s, unsigned long n )
+{
+	const unsigned char *p = ( const unsigned char * ) s;
+	if ( n==0 ) return 0;
+	if ( p[0] < 0x80 ) return 1;
+	if ( p[0] < 0xC2 ) return 0; /* continuation byte or overlong */
+	if ( p[0] < 0xE0 ) {
+		if ( n<2 || ( p[1] & 0xC0 )!=0x80 ) return 0;
+		return 2;
+	}
+	if ( p[0] < 0xF0 ) {
+		if ( n<3 || ( p[1] & 0xC0 )!=0x80 || ( p[2] & 0xC0 )!=0x80 ) return 0;
+		if ( p[0]==0xE0 && p[1]<0xA0 ) return 0;  /* overlong */
+		if ( p[0]==0xED && p[1]>=0xA0 ) return 0; /* surrogate */
+		return 3;
+	}
+	if ( p[0] < 0xF5 ) {
+		if ( n<4 || ( p[1] & 0xC0 )!=0x80 || ( p[2] & 0xC0 )!=0x80 ||
+		     ( p[3] & 0xC0 )!=0x80 ) return 0;
+		if ( p[0]==0xF0 && p[1]<0x90 ) return 0;  /* overlong */
+		if ( p[0]==0xF4 && p[1]>=0x90 ) return 0; /* past U+10FFFF */
+		return 4;
+	}
+	return 0;
+}
+
+/* utf8_validate()
+ *
+ * Returns -1 if the n bytes at s are well-formed UTF-8, otherwise the
+ * offset of the first byte of the first bad character. Runs of ASCII
+ * are skipped 16 bytes at a time.
+ */
+long
+utf8_validate( const char *s, unsigned long n )
+{
+	unsigned long i = 0;
+	int len;
+	while ( i < n ) {
+		i += utf8_ascii_span( s+i, n-i );
+		if ( i==n ) break;
+		len = utf8_valid_seqlen( s+i, n-i );
+		if ( !len ) return ( long ) i;
+		i += len;
+	}
+	return -1;
+}
+
 void
 utf8_writebom( FILE *outptr )
 {
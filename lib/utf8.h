@@ -14,6 +14,9 @@
 int          utf8_encode( unsigned int value, unsigned char out[6] );
 void         utf8_encode_str( unsigned int value, char outstr[7] );
 unsigned int utf8_decode( char *s, unsigned int *pi );
+unsigned long utf8_ascii_span( const char *s, unsigned long n );
+int          utf8_valid_seqlen( const char *s, unsigned long n );
+long         utf8_validate( const char *s, unsigned long n );
 void         utf8_writebom( FILE *outptr );
 int          utf8_is_bom( char *p );
 int          utf8_is_emdash( char *p );
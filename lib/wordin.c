@@ -16,7 +16,7 @@
 #include "xml_encoding.h"
 #include "bibformats.h"
 
-static int wordin_readf( FILE *fp, char *buf, int bufsize, int *bufpos, str *line, str *reference, int *fcharset );
+static int wordin_readf( reader *r, str *line, str *reference, int *fcharset );
 static int wordin_processf( fields *wordin, char *data, char *filename, long nref, param *p );
 
 
@@ -35,6 +35,9 @@ wordin_initparams( param *p, const char *progname )
 	p->utf8in           = 1;
 	p->nosplittitle     = 0;
 	p->verbose          = 0;
+	p->intern           = 0;
+	p->convcache        = 0;
+	p->borrow           = 0;
 	p->addcount         = 0;
 	p->output_raw       = BIBL_RAW_WITHMAKEREFID |
 	                      BIBL_RAW_WITHCHARCONVERT;
@@ -73,13 +76,13 @@ wordin_findendwrapper( char *buf, int ntype )
 }
 
 static int
-wordin_readf( FILE *fp, char *buf, int bufsize, int *bufpos, str *line, str *reference, int *fcharset )
+wordin_readf( reader *r, str *line, str *reference, int *fcharset )
 {
 	str tmp;
 	char *startptr = NULL, *endptr;
 	int haveref = 0, inref = 0, file_charset = CHARSET_UNKNOWN, m, type = 1;
 	str_init( &tmp );
-	while ( !haveref && str_fget( fp, buf, bufsize, bufpos, line ) ) {
+	while ( !haveref && reader_getline( r, line ) ) {
 		if ( str_cstr( line ) ) {
 			m = xml_getencoding( line );
 			if ( m!=CHARSET_UNKNOWN ) file_charset = m;
@@ -38,6 +38,8 @@ wordout_initparams( param *p, const char *progname )
 	p->verbose          = 0;
 	p->addcount         = 0;
 	p->singlerefperfile = 0;
+	p->sortkey          = BIBL_SORT_NONE;
+	p->dedup            = BIBL_DEDUP_NONE;
 
 	p->headerf = wordout_writeheader;
 	p->footerf = wordout_writefooter;
@@ -204,9 +206,10 @@ static int
 get_type_from_genre( fields *info )
 {
 	int type = TYPE_UNKNOWN, i, j, level;
-	char *genre, *tag;
+	const char *tag;
+	char *genre;
 	for ( i=0; i<info->n; ++i ) {
-		tag = (char *) fields_tag( info, i, FIELDS_CHRP );
+		tag = fields_tag( info, i, FIELDS_CHRP );
 		if ( strcasecmp( tag, "GENRE" ) && strcasecmp( tag, "NGENRE" ) ) continue;
 		genre = (char *) fields_value( info, i, FIELDS_CHRP );
 		for ( j=0; j<ngenres; ++j ) {
@@ -214,7 +217,7 @@ get_type_from_genre( fields *info )
 				type = genres[j].value;
 		}
 		if ( type==TYPE_UNKNOWN ) {
-			level = info->level[i];
+			level = fields_level( info, i );
 			if ( !strcasecmp( genre, "academic journal" ) ) {
 				type = TYPE_JOURNALARTICLE;
 			}
@@ -224,7 +227,7 @@ get_type_from_genre( fields *info )
 			}
 			else if ( !strcasecmp( genre, "book" ) ||
 				!strcasecmp( genre, "collection" ) ) {
-				if ( info->level[i]==0 ) type = TYPE_BOOK;
+				if ( fields_level( info, i )==0 ) type = TYPE_BOOK;
 				else type = TYPE_BOOKSECTION;
 			}
 			else if ( !strcasecmp( genre, "conference publication" ) ) {
@@ -249,9 +252,10 @@ static int
 get_type_from_resource( fields *info )
 {
 	int type = TYPE_UNKNOWN, i;
-	char *tag, *resource;
+	const char *tag;
+	char *resource;
 	for ( i=0; i<info->n; ++i ) {
-		tag = (char *) fields_tag( info, i, FIELDS_CHRP );
+		tag = fields_tag( info, i, FIELDS_CHRP );
 		if ( strcasecmp( tag, "GENRE" ) && strcasecmp( tag, "NGENRE" ) ) continue;
 		resource = (char *) fields_value( info, i, FIELDS_CHRP );
 		if ( !strcasecmp( resource, "moving image" ) )
@@ -387,7 +391,7 @@ output_name( FILE *outptr, char *p )
 #define NAME_CORP (4)
 
 static int
-extract_name_and_info( str *outtag, str *intag )
+extract_name_and_info( str *outtag, const str *intag )
 {
 	int code = NAME;
 	str_strcpy( outtag, intag );
@@ -406,7 +410,7 @@ output_name_type( fields *info, FILE *outptr, int level,
 	nfields = fields_num( info );
 	for ( j=0; j<nmap; ++j ) {
 		for ( i=0; i<nfields; ++i ) {
-			code = extract_name_and_info( &ntag, &(info->tag[i]) );
+			code = extract_name_and_info( &ntag, fields_tag( info, i, FIELDS_STRP_NOUSE ) );
 			if ( strcasecmp( str_cstr( &ntag ), map[j] ) ) continue;
 			if ( n==0 )
 				fprintf( outptr, "<%s><b:NameList>\n", tag );
@@ -500,7 +504,7 @@ type_is_thesis( int type )
 static void
 output_thesisdetails( fields *info, FILE *outptr, int type )
 {
-	char *tag;
+	const char *tag;
 	int i, n;
 
 	if ( type==TYPE_PHDTHESIS )
@@ -566,22 +570,22 @@ output_type( fields *info, FILE *outptr, int type )
 static void
 output_comments( fields *info, FILE *outptr, int level )
 {
-	vplist_index i;
-	vplist notes;
-	char *abs;
-
-	vplist_init( &notes );
+	char *abs, *note;
+	int comments;
+	fields_iter it;
 
 	abs = fields_findv( info, level, FIELDS_CHRP, "ABSTRACT" );
-	fields_findv_each( info, level, FIELDS_CHRP, &notes, "NOTES" );
+	fields_iter_init( &it, info, level, FIELDS_CHRP, "NOTES", NULL );
+	note = fields_iter_next( &it );
+	comments = ( abs || note );
 
-	if ( abs || notes.n ) fprintf( outptr, "<b:Comments>" );
+	if ( comments ) fprintf( outptr, "<b:Comments>" );
 	if ( abs ) fprintf( outptr, "%s", abs );
-	for ( i=0; i<notes.n; ++i )
-		fprintf( outptr, "%s", (char*)vplist_get( &notes, i ) );
-	if ( abs || notes.n ) fprintf( outptr, "</b:Comments>\n" );
-
-	vplist_free( &notes );
+	while ( note ) {
+		fprintf( outptr, "%s", note );
+		note = fields_iter_next( &it );
+	}
+	if ( comments ) fprintf( outptr, "</b:Comments>\n" );
 }
 
 static void
@@ -10,22 +10,12 @@
 #include <stdlib.h>
 #include <string.h>
 #include "is_ws.h"
+#include "memstats.h"
 #include "strsearch.h"
 #include "xml.h"
 
 char *xml_pns = NULL;
 
-static xml_attrib *
-xmlattrib_new( void )
-{
-	xml_attrib *a = (xml_attrib *) malloc( sizeof( xml_attrib ) );
-	if ( a ) {
-		slist_init( &(a->attrib) );
-		slist_init( &(a->value) );
-	}
-	return a;
-}
-
 static void
 xmlattrib_add( xml_attrib *a, char *attrib, char *value  )
 {
@@ -42,12 +32,100 @@ xmlattrib_free( xml_attrib *a )
 	slist_free( &(a->value ) );
 }
 
+/*
+ * The nodes of a tree built by xml_tree(), together with their tag,
+ * value and attributes, come from an arena of fixed size chunks instead
+ * of separate allocations. Trees are built and freed one record at a
+ * time, so when the last node is freed the arena is rewound for the
+ * next record.
+ */
+typedef struct xml_node {
+	xml        x;
+	str        tag;
+	str        value;
+	xml_attrib a;
+} xml_node;
+
+#define XML_ARENA_NODES (256)
+
+typedef struct xml_chunk {
+	struct xml_chunk *next;
+	int n;
+	xml_node node[ XML_ARENA_NODES ];
+} xml_chunk;
+
+static xml_chunk *xml_arena = NULL; /* chunk in use first */
+static long xml_arena_live = 0;
+
 static xml *
 xml_new( void )
 {
-	xml *x = ( xml * ) malloc( sizeof( xml ) );
-	if ( x ) xml_init( x );
-	return x;
+	xml_chunk *chunk;
+	xml_node *node;
+
+	if ( !xml_arena || xml_arena->n == XML_ARENA_NODES ) {
+		chunk = ( xml_chunk * ) malloc( sizeof( xml_chunk ) );
+		if ( !chunk ) {
+			fprintf(stderr,"xml_new: memory error.\n");
+			exit( EXIT_FAILURE );
+		}
+		MEMSTATS_ALLOC( MEMSTATS_XML, sizeof( xml_chunk ) );
+		chunk->next = xml_arena;
+		chunk->n = 0;
+		xml_arena = chunk;
+	}
+
+	node = &( xml_arena->node[ xml_arena->n++ ] );
+	xml_arena_live++;
+
+	/* like str_new(), start from an empty string rather than NULL data */
+	str_init( &(node->tag) );
+	str_init( &(node->value) );
+	str_strcpyc( &(node->tag), "" );
+	str_strcpyc( &(node->value), "" );
+	slist_init( &(node->a.attrib) );
+	slist_init( &(node->a.value) );
+	node->x.tag   = &(node->tag);
+	node->x.value = &(node->value);
+	node->x.a     = NULL;
+	node->x.down  = NULL;
+	node->x.next  = NULL;
+
+	return &(node->x);
+}
+
+/* keep one chunk for the next record */
+static void
+xml_arena_rewind( void )
+{
+	xml_chunk *chunk;
+
+	while ( xml_arena->next ) {
+		chunk = xml_arena->next;
+		xml_arena->next = chunk->next;
+		free( chunk );
+		MEMSTATS_FREE( MEMSTATS_XML, sizeof( xml_chunk ) );
+	}
+	xml_arena->n = 0;
+}
+
+/* free nodes from xml_new(), x and its siblings with their subtrees */
+static void
+xml_node_free( xml *x )
+{
+	xml_node *node;
+	xml *next;
+
+	while ( x ) {
+		node = ( xml_node * ) x;
+		next = x->next;
+		str_free( &(node->tag) );
+		str_free( &(node->value) );
+		xmlattrib_free( &(node->a) );
+		if ( x->down ) xml_node_free( x->down );
+		if ( --xml_arena_live == 0 ) xml_arena_rewind();
+		x = next;
+	}
 }
 
 void
@@ -65,8 +143,8 @@ xml_free( xml *x )
 		xmlattrib_free( x->a );
 		free( x->a );
 	}
-	if ( x->down ) xml_free( x->down );
-	if ( x->next ) xml_free( x->next );
+	if ( x->down ) xml_node_free( x->down );
+	if ( x->next ) xml_node_free( x->next );
 }
 
 void
@@ -110,46 +188,70 @@ xml_terminator( char *p, int *type )
 	return 0;
 }
 
+/* xml_span()
+ *
+ * Return the end of the run of characters starting at p that stops at
+ * a character in stop or at the terminator of the tag. stop must
+ * include the characters that can start a terminator, ">/?!".
+ */
+static char *
+xml_span( char *p, const char *stop, int *type )
+{
+	p += strcspn( p, stop );
+	while ( ( *p=='/' || *p=='?' || *p=='!' ) && !xml_terminator( p, type ) ) {
+		p++;
+		p += strcspn( p, stop );
+	}
+	return p;
+}
+
 static char *
-xml_processattrib( char *p, xml_attrib **ap, int *type )
+xml_processattrib( char *p, xml_attrib *a, int *type )
 {
-	xml_attrib *a = NULL;
 	char quote_character = '\"';
+	const char *stop = "= \t>/?!\"";
 	int inquotes = 0;
 	str aname, aval;
+	char *q;
 	str_init( &aname );
 	str_init( &aval );
 	while ( *p && !xml_terminator(p,type) ) {
 		/* get attribute name */
 		while ( *p==' ' || *p=='\t' ) p++;
-		while ( *p && !strchr( "= \t", *p ) && !xml_terminator(p,type)){
-			str_addchar( &aname, *p );
-			p++;
-		}
+		q = xml_span( p, "= \t>/?!", type );
+		str_strncatc( &aname, p, q-p );
+		p = q;
 		while ( *p==' ' || *p=='\t' ) p++;
 		if ( *p=='=' ) p++;
 		/* get attribute value */
 		while ( *p==' ' || *p=='\t' ) p++;
 		if ( *p=='\"' || *p=='\'' ) {
-			if ( *p=='\'' ) quote_character = *p;
+			if ( *p=='\'' ) {
+				quote_character = *p;
+				stop = "= \t>/?!'";
+			}
 			inquotes=1;
 			p++;
 		}
-		while ( *p && ((!xml_terminator(p,type) && !strchr("= \t", *p ))||inquotes)){
-			if ( *p==quote_character ) inquotes=0;
-			else str_addchar( &aval, *p );
+		/* quote characters are dropped, quoted runs taken whole */
+		while ( *p ) {
+			if ( inquotes ) {
+				q = strchr( p, quote_character );
+				if ( !q ) q = p + strlen( p );
+			} else q = xml_span( p, stop, type );
+			str_strncatc( &aval, p, q-p );
+			p = q;
+			if ( *p!=quote_character ) break;
+			inquotes = 0;
 			p++;
 		}
-		if ( str_has_value( &aname ) ) {
-			if ( !a ) a = xmlattrib_new();
+		if ( str_has_value( &aname ) )
 			xmlattrib_add( a, str_cstr( &aname ), str_cstr( &aval ) );
-		}
 		str_empty( &aname );
 		str_empty( &aval );
 	}
 	str_free( &aname );
 	str_free( &aval );
-	*ap = a;
 	return p;
 }
 
@@ -163,30 +265,35 @@ xml_processattrib( char *p, xml_attrib **ap, int *type )
  * 	XML_OPENCLOSE <A/>
  */
 static char *
-xml_processtag( char *p, str *tag, xml_attrib **attrib, int *type )
+xml_processtag( char *p, str *tag, xml_attrib *attrib, int *type )
 {
-	*attrib = NULL;
+	char *q;
 	if ( *p=='<' ) p++;
 	if ( *p=='!' ) {
-		while ( *p && *p!='>' ) str_addchar( tag, *p++ );
+		q = p + strcspn( p, ">" );
+		str_strncatc( tag, p, q-p );
+		p = q;
 		*type = XML_COMMENT;
 	} else if ( *p=='?' ) {
 		*type = XML_DESCRIPTOR;
 		p++; /* skip '?' */
-		while ( *p && !strchr( " \t", *p ) && !xml_terminator(p,type) )
-			str_addchar( tag, *p++ );
+		q = xml_span( p, " \t>/?!", type );
+		str_strncatc( tag, p, q-p );
+		p = q;
 		if ( *p==' ' || *p=='\t' )
 			p = xml_processattrib( p, attrib, type );
 	} else if ( *p=='/' ) {
-		while ( *p && !strchr( " \t", *p ) && !xml_terminator(p,type) )
-			str_addchar( tag, *p++ );
+		q = xml_span( p, " \t>/?!", type );
+		str_strncatc( tag, p, q-p );
+		p = q;
 		*type = XML_CLOSE;
 		if ( *p==' ' || *p=='\t' ) 
 			p = xml_processattrib( p, attrib, type );
 	} else {
 		*type = XML_OPEN;
-		while ( *p && !strchr( " \t", *p ) && !xml_terminator(p,type) )
-			str_addchar( tag, *p++ );
+		q = xml_span( p, " \t>/?!", type );
+		str_strncatc( tag, p, q-p );
+		p = q;
 		if ( *p==' ' || *p=='\t' ) 
 			p = xml_processattrib( p, attrib, type );
 	}
@@ -209,40 +316,41 @@ xml_appendnode( xml *onode, xml *nnode )
 char *
 xml_tree( char *p, xml *onode )
 {
-	str tag;
-	xml_attrib *attrib;
 	int type, is_style = 0;
-
-	str_init( &tag );
+	xml *nnode;
+	char *q;
 
 	while ( *p ) {
 		/* retain white space for <style> tags in endnote xml */
 		if ( onode->tag && str_cstr( onode->tag ) &&
 			!strcasecmp( str_cstr( onode->tag ),"style") ) is_style=1;
-		while ( *p && *p!='<' ) {
-			if ( onode->value->len>0 || is_style || !is_ws( *p ) )
-				str_addchar( onode->value, *p );
-			p++;
-		}
+		/* skip leading white space, then take the text up to the next tag */
+		q = p + strcspn( p, "<" );
+		if ( onode->value->len==0 && !is_style )
+			while ( p<q && is_ws( *p ) ) p++;
+		str_strncatc( onode->value, p, q-p );
+		p = q;
 		if ( *p=='<' ) {
-			str_empty( &tag );
-			p = xml_processtag( p, &tag, &attrib, &type );
+			/* parse straight into a new node, drop it if not needed */
+			nnode = xml_new();
+			p = xml_processtag( p, nnode->tag, &( ((xml_node *) nnode)->a ), &type );
 			if ( type==XML_OPEN || type==XML_OPENCLOSE ||
 			     type==XML_DESCRIPTOR ) {
-				xml *nnode = xml_new();
-				str_strcpy( nnode->tag, &tag );
-				nnode->a = attrib;
+				if ( ((xml_node *) nnode)->a.attrib.n )
+					nnode->a = &( ((xml_node *) nnode)->a );
 				xml_appendnode( onode, nnode );
 				if ( type==XML_OPEN )
 					p = xml_tree( p, nnode );
-			} else if ( type==XML_CLOSE ) {
-				/*check to see if it's closing for this one*/
-				goto out; /* assume it's right for now */
+			} else {
+				xml_node_free( nnode );
+				if ( type==XML_CLOSE ) {
+					/*check to see if it's closing for this one*/
+					goto out; /* assume it's right for now */
+				}
 			}
 		}
 	}
 out:
-	str_free( &tag );
 	return p;
 }
 
@@ -0,0 +1,89 @@
+/*
+ * charsets_test.c
+ *
+ * Copyright (c) 2017
+ *
+ * Source code released under the GPL version 2
+ *
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include "charsets.h"
+
+char progname[] = "charsets_test";
+
+typedef struct test_t {
+	char *charset;
+	unsigned int unicode;
+	unsigned int expected;
+} test_t;
+
+int
+test_lookupuni( void )
+{
+	test_t tests[] = {
+		{ "latin1",   'A',     'A'  },
+		{ "latin1",   0x00E9,  0xE9 },
+		{ "latin1",   0x20AC,  '?'  },
+		{ "cp1252",   0x20AC,  0x80 },
+		{ "cp1252",   0x2014,  0x97 },
+		{ "macroman", 0x00E9,  0x8E },
+		{ "koi8_r",   0x0430,  0xC1 },
+		{ "latin1",   0x10FFFF, '?' },
+		{ "latin1",   0xFFFFFFFF, '?' },
+	};
+	int ntests = sizeof( tests ) / sizeof( tests[0] );
+	int failed = 0, i, cs;
+	unsigned int c;
+
+	for ( i=0; i<ntests; ++i ) {
+		cs = charset_find( tests[i].charset );
+		if ( cs==CHARSET_UNKNOWN ) {
+			printf( "%s: Error charset '%s' not found\n", progname, tests[i].charset );
+			failed++;
+			continue;
+		}
+		c = charset_lookupuni( cs, tests[i].unicode );
+		if ( c!=tests[i].expected ) {
+			printf( "%s: Error charset_lookupuni( %s, 0x%X ) returned 0x%X, expected 0x%X\n", progname, tests[i].charset, tests[i].unicode, c, tests[i].expected );
+			failed++;
+		}
+	}
+	return failed;
+}
+
+/* every character of every charset should come back as a byte of the same character */
+int
+test_roundtrip( void )
+{
+	int failed = 0, i, cs;
+	unsigned int uni, c;
+
+	for ( cs=0; charset_get_xmlname( cs )[0]!='?'; ++cs ) {
+		for ( i=0; i<256; ++i ) {
+			uni = charset_lookupchar( cs, (char) i );
+			c = charset_lookupuni( cs, uni );
+			if ( c > 255 || charset_lookupchar( cs, (char) c )!=uni ) {
+				printf( "%s: Error charset %s byte 0x%02X (U+%04X) came back as 0x%X\n", progname, charset_get_xmlname( cs ), i, uni, c );
+				failed++;
+				break;
+			}
+		}
+	}
+	return failed;
+}
+
+int
+main( int argc, char *argv[] )
+{
+	int failed = 0;
+	failed += test_lookupuni();
+	failed += test_roundtrip();
+	if ( !failed ) {
+		printf( "%s: PASSED\n", progname );
+		return EXIT_SUCCESS;
+	} else {
+		printf( "%s: FAILED\n", progname );
+		return EXIT_FAILURE;
+	}
+}
@@ -0,0 +1,152 @@
+/*
+ * dedup_test.c
+ *
+ * Copyright (c) 2017
+ *
+ * Source code released under the GPL version 2
+ *
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <string.h>
+#include "bibutils.h"
+#include "dedup.h"
+
+char progname[] = "dedup_test";
+
+/* add a reference of tag/value pairs, ended by NULL, all at LEVEL_MAIN */
+static void
+addref( bibl *b, ... )
+{
+	fields *f;
+	va_list ap;
+	char *tag, *value;
+
+	f = fields_new();
+	if ( !f ) {
+		printf( "%s: Error memory error making the references\n", progname );
+		exit( EXIT_FAILURE );
+	}
+	va_start( ap, b );
+	while ( ( tag = va_arg( ap, char * ) ) ) {
+		value = va_arg( ap, char * );
+		if ( fields_add_can_dup( f, tag, value, LEVEL_MAIN )!=FIELDS_OK ) {
+			printf( "%s: Error memory error making the references\n", progname );
+			exit( EXIT_FAILURE );
+		}
+	}
+	va_end( ap );
+	bibl_addref( b, f );
+}
+
+/* the REFNUMs left, in order, joined by spaces */
+static int
+check_refs( bibl *b, const char *test, const char *expected )
+{
+	char *refnum;
+	str got;
+	long i;
+	int failed = 0;
+
+	str_init( &got );
+	for ( i=0; i<b->nrefs; ++i ) {
+		refnum = fields_findv( b->ref[i], LEVEL_MAIN, FIELDS_CHRP_NOUSE, "REFNUM" );
+		if ( i ) str_addchar( &got, ' ' );
+		str_strcatc( &got, refnum ? refnum : "?" );
+	}
+	if ( strcmp( str_cstr( &got ), expected ) ) {
+		printf( "%s: Error %s kept '%s', expected '%s'\n", progname, test, str_cstr( &got ), expected );
+		failed++;
+	}
+	str_free( &got );
+	return failed;
+}
+
+static int
+check_count( fields *f, const char *test, char *tag, int expected )
+{
+	int i, n = 0;
+	for ( i=0; i<fields_num( f ); ++i )
+		if ( !strcmp( fields_tag( f, i, FIELDS_CHRP_NOUSE ), tag ) ) n++;
+	if ( n!=expected ) {
+		printf( "%s: Error %s has %d '%s' fields, expected %d\n", progname, test, n, tag, expected );
+		return 1;
+	}
+	return 0;
+}
+
+int
+test_drop( void )
+{
+	int failed = 0;
+	bibl b;
+
+	bibl_init( &b );
+	addref( &b, "REFNUM", "a", "DOI", "10.1000/XYZ", NULL );
+	addref( &b, "REFNUM", "b", "DOI", "https://doi.org/10.1000/xyz", NULL );
+	addref( &b, "REFNUM", "c", "ISBN", "0-306-40615-2", NULL );
+	addref( &b, "REFNUM", "d", "ISBN13", "978-0-306-40615-7", NULL );
+	addref( &b, "REFNUM", "e", "TITLE", "On Things", "DATE:YEAR", "1999",
+		"AUTHOR", "Smith|John", NULL );
+	addref( &b, "REFNUM", "f", "TITLE", "on things!", "DATE:YEAR", "1999",
+		"AUTHOR", "SMITH|J", NULL );
+	addref( &b, "REFNUM", "g", "TITLE", "On Things", "DATE:YEAR", "2000",
+		"AUTHOR", "Smith|John", NULL );
+	addref( &b, "REFNUM", "h", "DOI", "10.1000/other", NULL );
+
+	if ( bibl_dedup( &b, BIBL_DEDUP_NONE, NULL, NULL )!=BIBL_OK ) failed++;
+	failed += check_refs( &b, "no dedup", "a b c d e f g h" );
+
+	if ( bibl_dedup( &b, BIBL_DEDUP_DROP, NULL, NULL )!=BIBL_OK ) failed++;
+	failed += check_refs( &b, "drop", "a c e g h" );
+
+	bibl_free( &b );
+	return failed;
+}
+
+int
+test_merge( void )
+{
+	int failed = 0;
+	bibl b;
+
+	bibl_init( &b );
+	addref( &b, "REFNUM", "a", "DOI", "10.1000/abc", "AUTHOR", "Smith|John",
+		"KEYWORD", "zeta", NULL );
+	addref( &b, "REFNUM", "b", "DOI", "10.1000/abc", "AUTHOR", "Smith|John",
+		"AUTHOR", "Doe|Jane", "KEYWORD", "alpha", "NOTES", "one",
+		"NOTES", "two", "NOTES", "three", NULL );
+	addref( &b, "REFNUM", "c", "ISBN", "0306406152", NULL );
+	addref( &b, "REFNUM", "d", "ISBN", "9780306406157", "PUBLISHER", "Plenum", NULL );
+
+	if ( bibl_dedup( &b, BIBL_DEDUP_MERGE, NULL, NULL )!=BIBL_OK ) failed++;
+	failed += check_refs( &b, "merge", "a c" );
+
+	if ( b.nrefs==2 ) {
+		/* tags already in the kept reference aren't merged in */
+		failed += check_count( b.ref[0], "merge", "AUTHOR", 1 );
+		failed += check_count( b.ref[0], "merge", "KEYWORD", 1 );
+		/* ...those that aren't come with all of their values */
+		failed += check_count( b.ref[0], "merge", "NOTES", 3 );
+		failed += check_count( b.ref[1], "merge", "PUBLISHER", 1 );
+	}
+
+	bibl_free( &b );
+	return failed;
+}
+
+int
+main( int argc, char *argv[] )
+{
+	int failed = 0;
+	failed += test_drop();
+	failed += test_merge();
+	if ( !failed ) {
+		printf( "%s: PASSED\n", progname );
+		return EXIT_SUCCESS;
+	} else {
+		printf( "%s: FAILED\n", progname );
+		return EXIT_FAILURE;
+	}
+}
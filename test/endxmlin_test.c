@@ -0,0 +1,115 @@
+/*
+ * endxmlin_test.c
+ *
+ * Copyright (c) 2017
+ *
+ * Source code released under the GPL version 2
+ *
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "bibutils.h"
+
+char progname[] = "endxmlin_test";
+
+#define STYLE( t ) "<style face=\"normal\" font=\"default\" size=\"100%\">" t "</style>"
+#define REC( t ) "<record><ref-type name=\"Journal Article\">17</ref-type><titles><title>" STYLE( t ) "</title></titles></record>"
+#define DECL "<?xml version=\"1.0\" encoding=\"UTF-8\"?>"
+
+/* read data as EndNote XML, and check the titles of the references, in order */
+static int
+check( const char *test, const char *data, int nrefs, char *titles[] )
+{
+	char *title;
+	int failed = 0;
+	long i;
+	param p;
+	FILE *fp;
+	bibl b;
+
+	fp = tmpfile();
+	if ( !fp ) {
+		printf( "%s: Cannot open temporary file\n", progname );
+		exit( EXIT_FAILURE );
+	}
+	fputs( data, fp );
+	rewind( fp );
+
+	bibl_init( &b );
+	bibl_initparams( &p, BIBL_ENDNOTEXMLIN, BIBL_MODSOUT, progname );
+	if ( bibl_read( &b, fp, "test", &p )!=BIBL_OK ) {
+		printf( "%s: Error %s bibl_read() failed\n", progname, test );
+		failed++;
+	} else if ( b.nrefs!=nrefs ) {
+		printf( "%s: Error %s read %ld references, expected %d\n", progname, test, b.nrefs, nrefs );
+		failed++;
+	} else {
+		for ( i=0; i<b.nrefs; ++i ) {
+			title = fields_findv( b.ref[i], LEVEL_MAIN, FIELDS_CHRP_NOUSE, "TITLE" );
+			if ( !title || strcmp( title, titles[i] ) ) {
+				printf( "%s: Error %s reference %ld has title '%s', expected '%s'\n", progname, test, i+1, title ? title : "(null)", titles[i] );
+				failed++;
+			}
+		}
+	}
+
+	bibl_freeparams( &p );
+	bibl_free( &b );
+	fclose( fp );
+	return failed;
+}
+
+/* EndNote often writes the whole export on a single line */
+int
+test_one_line( void )
+{
+	char *titles[] = { "One", "Two", "Three", "Four", "Five" };
+	int failed = 0;
+
+	failed += check( "one record on one line, no newline",
+		"<xml><records>" REC( "One" ) "</records></xml>", 1, titles );
+	failed += check( "one record on one line",
+		"<xml><records>" REC( "One" ) "</records></xml>\n", 1, titles );
+	failed += check( "five records on one line",
+		"<xml><records>" REC( "One" ) REC( "Two" ) REC( "Three" ) REC( "Four" ) REC( "Five" ) "</records></xml>",
+		5, titles );
+	failed += check( "five records on one line after a declaration",
+		DECL "<xml><records>" REC( "One" ) REC( "Two" ) REC( "Three" ) REC( "Four" ) REC( "Five" ) "</records></xml>\n",
+		5, titles );
+	failed += check( "last record ends the input",
+		"<xml><records>" REC( "One" ) REC( "Two" ), 2, titles );
+	return failed;
+}
+
+int
+test_many_lines( void )
+{
+	char *titles[] = { "One", "Two", "Three" };
+	int failed = 0;
+
+	failed += check( "one record per line",
+		DECL "\n<xml><records>\n" REC( "One" ) "\n" REC( "Two" ) "\n" REC( "Three" ) "\n</records></xml>\n",
+		3, titles );
+	failed += check( "records over many lines",
+		"<xml>\n<records>\n<record>\n<ref-type name=\"Journal Article\">17</ref-type>\n"
+		"<titles><title>" STYLE( "One" ) "</title></titles>\n</record>\n<record><titles>\n<title>" STYLE( "Two" ) "</title>\n"
+		"</titles></record>" REC( "Three" ) "\n</records>\n</xml>\n",
+		3, titles );
+	return failed;
+}
+
+int
+main( int argc, char *argv[] )
+{
+	int failed = 0;
+	failed += test_one_line();
+	failed += test_many_lines();
+	if ( !failed ) {
+		printf( "%s: PASSED\n", progname );
+		return EXIT_SUCCESS;
+	} else {
+		printf( "%s: FAILED\n", progname );
+		return EXIT_FAILURE;
+	}
+}
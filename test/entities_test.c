@@ -111,6 +111,54 @@ test_hex_entities( void )
 	return failed;
 }
 
+typedef struct named_t {
+	char *entity;
+	unsigned int unicode;
+	int err;
+} named_t;
+
+int
+test_named_entities( void )
+{
+	named_t tests[] = {
+		{ "&amp;*",       38,     0 },
+		{ "&AMP;*",       38,     0 },
+		{ "&eacute;*",    0xE9,   0 },
+		{ "&Eacute;*",    0xC9,   0 },
+		{ "&EACUTE;*",    0xE9,   0 },
+		{ "&alpha;*",     0x3B1,  0 },
+		{ "&Alpha;*",     0x391,  0 },
+		{ "&star;*",      0x2606, 0 },
+		{ "&NotGreaterLess;*", 0x2279, 0 },
+		{ "&CounterClockwiseContourIntegral;*", 0x2233, 0 },
+		{ "&amp*",        '&',    1 },
+		{ "&nosuchname;*", '&',   1 },
+		{ "&;*",          '&',    1 },
+	};
+	int ntests = sizeof( tests ) / sizeof( tests[0] );
+	unsigned int answer, pos_in;
+	int failed = 0, err, unicode, i;
+	for ( i=0; i<ntests; ++i ) {
+		pos_in = 0;
+		err = 0;
+		answer = decode_entity( tests[i].entity, &pos_in, &unicode, &err );
+		if ( answer!=tests[i].unicode || err!=tests[i].err ) {
+			failed = 1;
+			printf("%s: Error test_named_entities sent '%s' "
+				"returned %u error %d, expected %u error %d\n",
+				progname, tests[i].entity, answer, err,
+				tests[i].unicode, tests[i].err );
+		}
+		if ( !tests[i].err && tests[i].entity[pos_in]!='*' ) {
+			failed = 1;
+			printf("%s: Error test_named_entities bad ending pos, "
+				"sent '%s' returned pointer to '%s'\n",
+				progname, tests[i].entity, &(tests[i].entity[pos_in]) );
+		}
+	}
+	return failed;
+}
+
 int
 main( int argc, char *argv[] )
 {
@@ -118,6 +166,7 @@ main( int argc, char *argv[] )
 	failed += test_decimal_entities1();
 	failed += test_decimal_entities2();
 	failed += test_hex_entities();
+	failed += test_named_entities();
 	if ( !failed ) {
 		printf( "%s: PASSED\n", progname );
 		return EXIT_SUCCESS;
@@ -0,0 +1,554 @@
+/*
+ * fields_test.c
+ *
+ * Copyright (c) 2017
+ *
+ * Source code released under the GPL version 2
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include "fields.h"
+
+char progname[] = "fields_test";
+char version[] = "0.1";
+
+#define check( a, b ) { \
+	if ( !(a) ) { \
+		fprintf( stderr, "Failed %s (%s) in %s() line %d\n", #a, b, __FUNCTION__, __LINE__ );\
+		return 1; \
+	} \
+}
+
+#define check_len( a, b ) if ( !_check_len( a, b, __FUNCTION__, __LINE__ ) ) return 1;
+int
+_check_len( fields *a, int expected, const char *fn, int line )
+{
+	if ( fields_num( a ) == expected ) return 1;
+	fprintf( stderr, "Failed: %s() line %d: Expected fields length of %d, found %d\n", fn, line, expected, fields_num( a ) );
+	return 0;
+}
+
+#define check_find( a, b, c ) if ( !_check_find( a, b, c, __FUNCTION__, __LINE__ ) ) return 1;
+int
+_check_find( fields *a, char *tag, int level, const char *fn, int line )
+{
+	int i, expected = -1, found;
+
+	/* what a straight scan of the fields would return */
+	for ( i=0; i<fields_num( a ) && expected==-1; ++i ) {
+		if ( !fields_match_casetag( a, i, tag ) ) continue;
+		if ( !fields_match_level( a, i, level ) ) continue;
+		if ( !fields_nodata( a, i ) ) expected = i;
+	}
+
+	found = fields_find( a, tag, level );
+	if ( found == expected ) return 1;
+	fprintf( stderr, "Failed: %s() line %d: fields_find( '%s', %d ) expected %d, found %d\n",
+		fn, line, tag, level, expected, found );
+	return 0;
+}
+
+static char *tags[] = { "AUTHOR", "TITLE", "DATE:YEAR", "KEYWORD", "NOTES", "URL", "PAGES:START" };
+static int ntags = sizeof( tags ) / sizeof( tags[0] );
+
+/* add count entries cycling through tags[] and levels 0..2 */
+static int
+build_fields( fields *f, int count )
+{
+	char buf[64];
+	int i, status;
+
+	for ( i=0; i<count; ++i ) {
+		sprintf( buf, "value %d", i );
+		status = fields_add_can_dup( f, tags[i%ntags], buf, i%3 );
+		if ( status!=FIELDS_OK ) return status;
+	}
+	return FIELDS_OK;
+}
+
+int
+test_add( void )
+{
+	fields f;
+	int status;
+
+	fields_init( &f );
+	check_len( &f, 0 );
+
+	status = fields_add( &f, "TITLE", "Title", LEVEL_MAIN );
+	check( (status==FIELDS_OK), "fields_add() should return FIELDS_OK" );
+	check_len( &f, 1 );
+
+	/* identical entries are dropped, ignoring case, unless dups allowed */
+	status = fields_add( &f, "title", "TITLE", LEVEL_MAIN );
+	check( (status==FIELDS_OK), "fields_add() should return FIELDS_OK" );
+	check_len( &f, 1 );
+
+	status = fields_add( &f, "TITLE", "Title", LEVEL_HOST );
+	check( (status==FIELDS_OK), "fields_add() should return FIELDS_OK" );
+	check_len( &f, 2 );
+
+	status = fields_add_can_dup( &f, "TITLE", "Title", LEVEL_MAIN );
+	check( (status==FIELDS_OK), "fields_add_can_dup() should return FIELDS_OK" );
+	check_len( &f, 3 );
+
+	check( (!strcmp( fields_tag( &f, 0, FIELDS_CHRP_NOUSE ), "TITLE" )), "tag spelling should be kept" );
+	check( (!strcmp( fields_tag( &f, 1, FIELDS_CHRP_NOUSE ), "TITLE" )), "tag spelling should be kept" );
+	check( (fields_level( &f, 1 )==LEVEL_HOST), "level should be kept" );
+
+	fields_free( &f );
+
+	return 0;
+}
+
+int
+test_find( void )
+{
+	fields f;
+	int i, j, status;
+
+	for ( j=1; j<100; j+=7 ) {
+		fields_init( &f );
+		status = build_fields( &f, j );
+		check( (status==FIELDS_OK), "build_fields() should return FIELDS_OK" );
+		check_len( &f, j );
+		for ( i=0; i<ntags; ++i ) {
+			check_find( &f, tags[i], LEVEL_ANY );
+			check_find( &f, tags[i], LEVEL_MAIN );
+			check_find( &f, tags[i], LEVEL_HOST );
+			check_find( &f, tags[i], LEVEL_SERIES );
+			check_find( &f, tags[i], LEVEL_ORIG );
+		}
+		check_find( &f, "author", LEVEL_HOST );
+		check_find( &f, "NOSUCHTAG", LEVEL_ANY );
+		fields_free( &f );
+	}
+
+	return 0;
+}
+
+/* lookups interleaved with adds must see the new entries */
+int
+test_find_add( void )
+{
+	fields f;
+	char buf[64];
+	int i, n, status;
+
+	fields_init( &f );
+	for ( i=0; i<200; ++i ) {
+		sprintf( buf, "TAG%d", i%40 );
+		check_find( &f, buf, LEVEL_ANY );
+		status = fields_add_can_dup( &f, buf, ( i%5 ) ? "data" : "", i%2 );
+		check( (status==FIELDS_OK), "fields_add_can_dup() should return FIELDS_OK" );
+		check_find( &f, buf, LEVEL_ANY );
+		check_find( &f, buf, i%2 );
+		check_find( &f, "TAG0", LEVEL_MAIN );
+	}
+	check_len( &f, 200 );
+
+	n = fields_find( &f, "tag7", LEVEL_HOST );
+	check( (n==7), "first TAG7 with data should be at position 7" );
+	check( (fields_findv( &f, LEVEL_HOST, FIELDS_POSP, "TAG7" )==(void*)7), "fields_findv() should agree with fields_find()" );
+
+	fields_free( &f );
+
+	return 0;
+}
+
+/* fields_findv_each() returns matches in order of position */
+int
+test_findv_each( void )
+{
+	vplist a;
+	fields f;
+	int i, status;
+
+	fields_init( &f );
+	status = build_fields( &f, 70 );
+	check( (status==FIELDS_OK), "build_fields() should return FIELDS_OK" );
+
+	vplist_init( &a );
+	fields_findv_each( &f, LEVEL_ANY, FIELDS_POSP, &a, "KEYWORD" );
+	check( (a.n==10), "should find 10 KEYWORD entries" );
+	for ( i=0; i<a.n; ++i )
+		check( (vplist_get( &a, i )==(void*)(intptr_t)(3+i*ntags)), "KEYWORD entries should be in order" );
+
+	vplist_empty( &a );
+	fields_findv_each( &f, LEVEL_HOST, FIELDS_POSP, &a, "keyword" );
+	for ( i=0; i<a.n; ++i )
+		check( (fields_level( &f, (intptr_t) vplist_get( &a, i ) )==LEVEL_HOST), "entries should be at LEVEL_HOST" );
+	check( (a.n==3), "should find 3 KEYWORD entries at LEVEL_HOST" );
+
+	vplist_free( &a );
+	fields_free( &f );
+
+	return 0;
+}
+
+/* duplicate suppression past the size where it is hashed */
+int
+test_add_nodups( void )
+{
+	fields f;
+	char buf[64];
+	int i, status;
+	str *s;
+
+	fields_init( &f );
+	for ( i=0; i<500; ++i ) {
+		sprintf( buf, "Keyword %d", i );
+		status = fields_add( &f, "KEYWORD", buf, LEVEL_MAIN );
+		check( (status==FIELDS_OK), "fields_add() should return FIELDS_OK" );
+	}
+	check_len( &f, 500 );
+
+	/* identical, ignoring case of tag and data */
+	for ( i=0; i<500; i+=7 ) {
+		sprintf( buf, "KEYWORD %d", i );
+		status = fields_add( &f, "keyword", buf, LEVEL_MAIN );
+		check( (status==FIELDS_OK), "fields_add() should return FIELDS_OK" );
+	}
+	check_len( &f, 500 );
+
+	/* different level or tag isn't a duplicate */
+	status = fields_add( &f, "KEYWORD", "Keyword 3", LEVEL_HOST );
+	check( (status==FIELDS_OK), "fields_add() should return FIELDS_OK" );
+	status = fields_add( &f, "TOPIC", "Keyword 3", LEVEL_MAIN );
+	check( (status==FIELDS_OK), "fields_add() should return FIELDS_OK" );
+	check_len( &f, 502 );
+
+	/* data changed in place must be seen by later checks */
+	s = fields_value( &f, 10, FIELDS_STRP_NOUSE );
+	str_strcpyc( s, "Changed" );
+	status = fields_add( &f, "KEYWORD", "Keyword 10", LEVEL_MAIN );
+	check( (status==FIELDS_OK), "fields_add() should return FIELDS_OK" );
+	check_len( &f, 503 );
+	status = fields_add( &f, "KEYWORD", "changed", LEVEL_MAIN );
+	check( (status==FIELDS_OK), "fields_add() should return FIELDS_OK" );
+	check_len( &f, 503 );
+
+	status = fields_replace_or_add( &f, "TOPIC", "Replaced", LEVEL_MAIN );
+	check( (status==FIELDS_OK), "fields_replace_or_add() should return FIELDS_OK" );
+	status = fields_add( &f, "TOPIC", "Keyword 3", LEVEL_MAIN );
+	check( (status==FIELDS_OK), "fields_add() should return FIELDS_OK" );
+	check_len( &f, 504 );
+	status = fields_add( &f, "TOPIC", "REPLACED", LEVEL_MAIN );
+	check( (status==FIELDS_OK), "fields_add() should return FIELDS_OK" );
+	check_len( &f, 504 );
+
+	fields_free( &f );
+
+	return 0;
+}
+
+/* fields_reset() empties fields, which are then reused */
+int
+test_reset( void )
+{
+	static fields z;
+	fields f;
+	int i, max, status;
+
+	fields_init( &f );
+	status = build_fields( &f, 100 );
+	check( (status==FIELDS_OK), "build_fields() should return FIELDS_OK" );
+	max = f.max;
+
+	fields_reset( &f );
+	check_len( &f, 0 );
+	check( (f.max==max), "fields_reset() should keep capacity" );
+	check_find( &f, "AUTHOR", LEVEL_ANY );
+
+	status = build_fields( &f, 30 );
+	check( (status==FIELDS_OK), "build_fields() should return FIELDS_OK" );
+	check_len( &f, 30 );
+	check( (f.max==max), "refilling should not reallocate" );
+	for ( i=0; i<ntags; ++i )
+		check_find( &f, tags[i], LEVEL_ANY );
+	status = fields_add( &f, "AUTHOR", "VALUE 0", LEVEL_MAIN );
+	check( (status==FIELDS_OK), "fields_add() should return FIELDS_OK" );
+	check_len( &f, 30 );
+
+	fields_free( &f );
+
+	fields_reset( &z );
+	status = fields_add( &z, "AUTHOR", "Value", LEVEL_MAIN );
+	check( (status==FIELDS_OK), "fields_add() should return FIELDS_OK" );
+	check_len( &z, 1 );
+	fields_free( &z );
+
+	return 0;
+}
+
+/* fields_iter_next() walks matches of several tags in order of position */
+int
+test_iter( void )
+{
+	fields_iter it;
+	char *value;
+	int i, n, status;
+	fields f;
+	str *s;
+
+	for ( n=5; n<100; n+=30 ) {
+		fields_init( &f );
+		status = build_fields( &f, n );
+		check( (status==FIELDS_OK), "build_fields() should return FIELDS_OK" );
+		status = fields_add( &f, "NOTES", "", LEVEL_HOST );
+		check( (status==FIELDS_OK), "fields_add() should return FIELDS_OK" );
+
+		/* tags are 0:AUTHOR 1:TITLE 2:DATE:YEAR 3:KEYWORD 4:NOTES ... */
+		fields_iter_init( &it, &f, LEVEL_ANY, FIELDS_CHRP, "notes", "AUTHOR", "Notes", "NOSUCHTAG", NULL );
+		i = 0;
+		while ( ( value = fields_iter_next( &it ) ) ) {
+			while ( i%ntags!=0 && i%ntags!=4 ) i++;
+			check( (fields_iter_pos( &it )==i), "matches should be in order of position" );
+			check( (value==fields_value( &f, i, FIELDS_CHRP_NOUSE )), "value should be the entry's" );
+			check( (fields_used( &f, i )), "FIELDS_CHRP should mark match used" );
+			i++;
+		}
+		while ( i<n && i%ntags!=0 && i%ntags!=4 ) i++;
+		check( (i>=n), "all matches should be returned" );
+		check( (fields_used( &f, n )), "empty match should be marked used" );
+
+		fields_iter_init( &it, &f, LEVEL_HOST, FIELDS_STRP_NOLEN, "NOTES", NULL );
+		while ( ( s = fields_iter_next( &it ) ) ) {
+			check( (fields_level( &f, fields_iter_pos( &it ) )==LEVEL_HOST), "level should match" );
+			check( (s==fields_value( &f, fields_iter_pos( &it ), FIELDS_STRP_NOUSE )), "value should be the entry's str" );
+		}
+		check( (fields_iter_pos( &it )==n), "empty entry should be returned with FIELDS_STRP_NOLEN" );
+
+		fields_iter_init( &it, &f, LEVEL_ANY, FIELDS_CHRP, "NOSUCHTAG", NULL );
+		check( (fields_iter_next( &it )==NULL), "unknown tag should not match" );
+
+		fields_free( &f );
+	}
+
+	return 0;
+}
+
+/* more tags than fields_iter has room for */
+int
+test_iter_manytags( void )
+{
+	int want[] = { 0, 1, 2, 3, 4, 5, 6, 7, 9, 11 };
+	fields_iter it;
+	vplist a;
+	char buf[16];
+	int i, ok, status;
+	fields f;
+
+	fields_init( &f );
+	vplist_init( &a );
+	for ( i=0; i<12; ++i ) {
+		sprintf( buf, "T%d", i );
+		status = fields_add( &f, buf, "value", LEVEL_MAIN );
+		check( (status==FIELDS_OK), "fields_add() should return FIELDS_OK" );
+	}
+
+	ok = fields_iter_init( &it, &f, LEVEL_ANY, FIELDS_CHRP, "T0", "T1", "T2", "T3", "T4", "T5", "T6", "T7", NULL );
+	check( (ok), "fields_iter_init() should take FIELDS_ITER_MAXTAGS tags" );
+
+	ok = fields_iter_init( &it, &f, LEVEL_ANY, FIELDS_CHRP, "T0", "T1", "T2", "T3", "T4", "T5", "T6", "T7", "T8", NULL );
+	check( (!ok), "fields_iter_init() should fail with more than FIELDS_ITER_MAXTAGS tags" );
+	check( (fields_iter_next( &it )==NULL), "failed fields_iter_init() should have no matches" );
+
+	fields_findv_eachof( &f, LEVEL_ANY, FIELDS_POSP, &a, "T11", "T0", "T1", "T2", "T3", "T4", "T5", "T6", "T7", "T9", "NOSUCHTAG", NULL );
+	check( (a.n==10), "fields_findv_eachof() should find all of many tags" );
+	for ( i=0; i<a.n; ++i )
+		check( ((intptr_t) vplist_get( &a, i )==want[i]), "matches should be in order of position" );
+
+	vplist_free( &a );
+	fields_free( &f );
+	return 0;
+}
+
+/* entries without data aren't found, but are marked used */
+int
+test_find_nodata( void )
+{
+	char *value;
+	fields f;
+	int i, status;
+
+	fields_init( &f );
+	for ( i=0; i<30; ++i ) {
+		status = fields_add_can_dup( &f, ( i==20 ) ? "EMPTY" : "FILLER", "", LEVEL_MAIN );
+		check( (status==FIELDS_OK), "fields_add_can_dup() should return FIELDS_OK" );
+	}
+
+	check( (fields_find( &f, "EMPTY", LEVEL_ANY )==-1), "empty entry should not be found" );
+	check( (fields_used( &f, 20 )==1), "empty entry should be marked used" );
+	value = fields_findv( &f, LEVEL_ANY, FIELDS_CHRP_NOLEN, "EMPTY" );
+	check( (value!=NULL && value[0]=='\0'), "FIELDS_CHRP_NOLEN should return empty string" );
+
+	fields_free( &f );
+
+	return 0;
+}
+
+int
+test_intern( void )
+{
+	fields f, g;
+	char *a, *b;
+	int i, n, status;
+	str *s;
+
+	fields_init( &f );
+	fields_init( &g );
+	status = build_fields( &f, 50 );
+	check( (status==FIELDS_OK), "build_fields() should return FIELDS_OK" );
+	status = build_fields( &g, 50 );
+	check( (status==FIELDS_OK), "build_fields() should return FIELDS_OK" );
+	status = fields_add( &f, "EMPTY", "", LEVEL_MAIN );
+	check( (status==FIELDS_OK), "fields_add() should return FIELDS_OK" );
+
+	status = fields_intern( &f );
+	check( (status==FIELDS_OK), "fields_intern() should return FIELDS_OK" );
+	status = fields_intern( &g );
+	check( (status==FIELDS_OK), "fields_intern() should return FIELDS_OK" );
+	check_len( &f, 51 );
+	check( (!fields_interned( &f, 50 )), "empty values should not be interned" );
+
+	/* identical values share storage */
+	for ( i=0; i<50; ++i ) {
+		check( (fields_interned( &f, i )), "values should be interned" );
+		a = fields_value( &f, i, FIELDS_CHRP_NOUSE );
+		b = fields_value( &g, i, FIELDS_CHRP_NOUSE );
+		check( (a==b), "identical values should share storage" );
+	}
+	for ( i=0; i<ntags; ++i )
+		check_find( &f, tags[i], LEVEL_ANY );
+
+	/* duplicate check still sees interned values */
+	status = fields_add( &f, "TITLE", "value 1", 1 );
+	check( (status==FIELDS_OK), "fields_add() should return FIELDS_OK" );
+	check_len( &f, 51 );
+
+	/* asking for a str unshares the entry only */
+	n = fields_find( &f, "TITLE", 1 );
+	check( (n==1), "fields_find() should find TITLE at position 1" );
+	s = fields_value( &f, n, FIELDS_STRP_NOUSE );
+	check( (!fields_interned( &f, n )), "FIELDS_STRP should unshare the value" );
+	check( (!strcmp( s->data, "value 1" )), "unshared value should be unchanged" );
+	str_strcpyc( s, "Changed" );
+	a = fields_value( &g, n, FIELDS_CHRP_NOUSE );
+	check( (!strcmp( a, "value 1" )), "changing an unshared value should not affect others" );
+	status = fields_add( &f, "TITLE", "changed", 1 );
+	check( (status==FIELDS_OK), "fields_add() should return FIELDS_OK" );
+	check_len( &f, 51 );
+
+	status = fields_replace_or_add( &f, "TITLE", "Replaced", 1 );
+	check( (status==FIELDS_OK), "fields_replace_or_add() should return FIELDS_OK" );
+	check( (!strcmp( fields_value( &f, n, FIELDS_CHRP_NOUSE ), "Replaced" )), "value should be replaced" );
+
+	/* dropping the last reference keeps the pool consistent */
+	fields_reset( &f );
+	check_len( &f, 0 );
+	fields_free( &f );
+	a = fields_value( &g, 0, FIELDS_CHRP_NOUSE );
+	check( (!strcmp( a, "value 0" )), "shared values should outlive other references" );
+	fields_init( &f );
+	status = build_fields( &f, 50 );
+	check( (status==FIELDS_OK), "build_fields() should return FIELDS_OK" );
+	status = fields_intern( &f );
+	check( (status==FIELDS_OK), "fields_intern() should return FIELDS_OK" );
+	a = fields_value( &f, 0, FIELDS_CHRP_NOUSE );
+	b = fields_value( &g, 0, FIELDS_CHRP_NOUSE );
+	check( (a==b), "identical values should share storage" );
+
+	fields_free( &f );
+	fields_free( &g );
+
+	return 0;
+}
+
+int
+test_borrowed( void )
+{
+	char *rec, *value;
+	str record, *s;
+	fields f;
+	int status;
+
+	fields_init( &f );
+	str_init( &record );
+	str_strcpyc( &record, "Smith, John|Title" );
+
+	rec = fields_record( &f, &record );
+	check( (record.len==0), "fields_record() should leave an empty buffer" );
+	check( (!strcmp( rec, "Smith, John|Title" )), "fields_record() should return the record" );
+
+	/* values point into the record */
+	rec[11] = '\0';
+	status = fields_add_borrowed( &f, "AUTHOR", rec, 11, LEVEL_MAIN );
+	check( (status==FIELDS_OK), "fields_add_borrowed() should return FIELDS_OK" );
+	status = fields_add_borrowed( &f, "TITLE", rec+12, 5, LEVEL_MAIN );
+	check( (status==FIELDS_OK), "fields_add_borrowed() should return FIELDS_OK" );
+	status = fields_add_borrowed( &f, "author", rec, 11, LEVEL_MAIN );
+	check( (status==FIELDS_OK), "fields_add_borrowed() should return FIELDS_OK" );
+	check_len( &f, 2 );
+	check( (fields_shared( &f, 0 ) && fields_shared( &f, 1 )), "borrowed values should not be owned" );
+	value = fields_value( &f, 1, FIELDS_CHRP_NOUSE );
+	check( (value==rec+12), "borrowed values should not be copied" );
+	check_find( &f, "TITLE", LEVEL_MAIN );
+
+	/* asking for a str copies, leaving the record alone */
+	s = fields_value( &f, 0, FIELDS_STRP_NOUSE );
+	check( (!fields_shared( &f, 0 )), "FIELDS_STRP should copy a borrowed value" );
+	check( (s->len==11 && !strcmp( s->data, "Smith, John" )), "copied value should be unchanged" );
+	str_strcatc( s, ", Jr." );
+	check( (!strcmp( rec, "Smith, John" )), "changing a copied value should not change the record" );
+	status = fields_add( &f, "AUTHOR", "smith, john, jr.", LEVEL_MAIN );
+	check( (status==FIELDS_OK), "fields_add() should return FIELDS_OK" );
+	check_len( &f, 2 );
+
+	/* interning takes borrowed values too */
+	status = fields_intern( &f );
+	check( (status==FIELDS_OK), "fields_intern() should return FIELDS_OK" );
+	check( (fields_interned( &f, 1 )), "borrowed values should be interned" );
+	value = fields_value( &f, 1, FIELDS_CHRP_NOUSE );
+	check( (value!=rec+12 && !strcmp( value, "Title" )), "interned value should be a copy" );
+
+	/* the record buffer goes back for reuse */
+	fields_reset( &f );
+	str_strcpyc( &record, "Next" );
+	rec = fields_record( &f, &record );
+	check( (!strcmp( rec, "Next" )), "fields_record() should return the new record" );
+	check( (record.len==0), "fields_record() should leave an empty buffer" );
+
+	fields_free( &f );
+	str_free( &record );
+
+	return 0;
+}
+
+int
+main( int argc, char *argv[] )
+{
+	int failed = 0;
+
+	failed += test_add();
+	failed += test_add_nodups();
+	failed += test_find();
+	failed += test_find_add();
+	failed += test_findv_each();
+	failed += test_iter();
+	failed += test_iter_manytags();
+	failed += test_find_nodata();
+	failed += test_reset();
+	failed += test_intern();
+	failed += test_borrowed();
+
+	if ( !failed ) {
+		printf( "%s: PASSED\n", progname );
+		return EXIT_SUCCESS;
+	} else {
+		printf( "%s: FAILED\n", progname );
+		return EXIT_FAILURE;
+	}
+}
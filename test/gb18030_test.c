@@ -0,0 +1,96 @@
+/*
+ * gb18030_test.c
+ *
+ * Copyright (c) 2017
+ *
+ * Source code released under the GPL version 2
+ *
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "gb18030.h"
+
+char progname[] = "gb18030_test";
+
+typedef struct test_t {
+	unsigned int unicode;
+	int len;
+	unsigned char bytes[4];
+} test_t;
+
+int
+test_gb18030_known( void )
+{
+	test_t tests[] = {
+		{ 0x0041,   1, { 0x41 } },
+		{ 0x0080,   4, { 0x81, 0x30, 0x81, 0x30 } },  /* table */
+		{ 0x00E9,   2, { 0xA8, 0xA6 } },
+		{ 0x4E2D,   2, { 0xD6, 0xD0 } },              /* zhong */
+		{ 0x0452,   4, { 0x81, 0x30, 0xD3, 0x30 } },  /* first of a range */
+		{ 0x200F,   4, { 0x81, 0x36, 0xA5, 0x31 } },  /* last of a range */
+		{ 0x9FA6,   4, { 0x82, 0x35, 0x8F, 0x33 } },
+		{ 0xFFFF,   4, { 0x84, 0x31, 0xA4, 0x39 } },
+		{ 0x10000,  4, { 0x90, 0x30, 0x81, 0x30 } },
+		{ 0x10FFFF, 4, { 0xE3, 0x32, 0x9A, 0x35 } },
+		{ 0xD800,   0, { 0 } },                       /* surrogate, no code */
+	};
+	int ntests = sizeof( tests ) / sizeof( tests[0] );
+	unsigned char out[4];
+	int failed = 0, i, n;
+
+	for ( i=0; i<ntests; ++i ) {
+		n = gb18030_encode( tests[i].unicode, out );
+		if ( n!=tests[i].len || memcmp( out, tests[i].bytes, n ) ) {
+			printf( "%s: Error gb18030_encode( 0x%X ) returned %d bytes, expected %d\n", progname, tests[i].unicode, n, tests[i].len );
+			failed = 1;
+		}
+	}
+	return failed;
+}
+
+/* every Unicode character with a code should decode back to itself */
+int
+test_gb18030_roundtrip( void )
+{
+	unsigned char out[4];
+	unsigned int i, j, pos;
+	int failed = 0, n, k;
+	char buf[8];
+
+	for ( i=0x80; i<=0x10FFFF; ++i ) {
+		n = gb18030_encode( i, out );
+		if ( n==0 ) {
+			if ( i < 0xD800 || i > 0xDFFF ) {
+				printf( "%s: Error gb18030_encode( 0x%X ) gave no code\n", progname, i );
+				failed = 1;
+			}
+			continue;
+		}
+		for ( k=0; k<n; ++k ) buf[k] = (char) out[k];
+		buf[n] = '*';
+		buf[n+1] = '\0';
+		pos = 0;
+		j = gb18030_decode( buf, &pos );
+		if ( i!=j || buf[pos]!='*' ) {
+			printf( "%s: Error test_gb18030 mismatch, send 0x%X got back 0x%X\n", progname, i, j );
+			failed = 1;
+		}
+	}
+	return failed;
+}
+
+int
+main( int argc, char *argv[] )
+{
+	int failed = 0;
+	failed += test_gb18030_known();
+	failed += test_gb18030_roundtrip();
+	if ( !failed ) {
+		printf( "%s: PASSED\n", progname );
+		return EXIT_SUCCESS;
+	} else {
+		printf( "%s: FAILED\n", progname );
+		return EXIT_FAILURE;
+	}
+}
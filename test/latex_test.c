@@ -0,0 +1,120 @@
+/*
+ * latex_test.c
+ *
+ * Copyright (c) 2017
+ *
+ * Source code released under the GPL version 2
+ *
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "latex.h"
+
+char progname[] = "latex_test";
+
+typedef struct test_t {
+	char *latex;
+	unsigned int unicode;
+	unsigned int len;
+	int isunicode;
+} test_t;
+
+int
+test_latex2char( void )
+{
+	test_t tests[] = {
+		{ "a",                   'a',    1, 0 },
+		{ "{",                   '{',    1, 0 },
+		{ "{\\'e}t",             0xE9,   5, 1 },
+		{ "\\'{e}",              0xE9,   5, 1 },
+		{ "\\'e",                0xE9,   3, 1 },
+		{ "\\'",                 0xB4,   2, 1 },
+		{ "\\o",                 0xF8,   2, 1 },
+		{ "\\oe",                0x153,  3, 1 },
+		{ "\\omega",             0x3C9,  6, 1 },
+		{ "\\nu",                0x3BD,  3, 1 },
+		{ "\\textdagger",        0x2020, 11, 1 },
+		{ "\\textdaggerdbl",     0x2021, 14, 1 },
+		{ "``",                  0x201C, 2, 1 },
+		{ "`",                   0x2018, 1, 1 },
+		{ "\\textbraceleft",     '{',    14, 1 },
+		{ "\\unknownmacro",      '\\',   1, 0 },
+	};
+	int ntests = sizeof( tests ) / sizeof( tests[0] );
+	int failed = 0, i, unicode;
+	unsigned int pos, ch;
+
+	for ( i=0; i<ntests; ++i ) {
+		pos = 0;
+		ch = latex2char( tests[i].latex, &pos, &unicode );
+		if ( ch!=tests[i].unicode || pos!=tests[i].len || unicode!=tests[i].isunicode ) {
+			printf( "%s: Error latex2char( '%s' ) returned 0x%X length %u unicode %d, expected 0x%X length %u unicode %d\n",
+				progname, tests[i].latex, ch, pos, unicode,
+				tests[i].unicode, tests[i].len, tests[i].isunicode );
+			failed++;
+		}
+	}
+	return failed;
+}
+
+typedef struct outtest_t {
+	unsigned int unicode;
+	char *latex;
+} outtest_t;
+
+int
+test_uni2latex( void )
+{
+	outtest_t tests[] = {
+		{ 'a',    "a" },
+		{ ' ',    " " },
+		{ '{',    "{\\{}" },
+		{ 0xE5,   "{\\aa}" },
+		{ 0xE4,   "{\\\"a}" },
+		{ 0xF6,   "{\\\"o}" },
+		{ 0xEC,   "{\\`i}" },
+		{ 0x3B1,  "$\\alpha$" },
+		{ 0x4E00, "?" },
+	};
+	int ntests = sizeof( tests ) / sizeof( tests[0] );
+	int failed = 0, i, len;
+	const char *p;
+	char buf[512], small[4];
+
+	for ( i=0; i<ntests; ++i ) {
+		uni2latex( tests[i].unicode, buf, sizeof( buf ) );
+		if ( strcmp( buf, tests[i].latex ) ) {
+			printf( "%s: Error uni2latex( 0x%X ) returned '%s', expected '%s'\n", progname, tests[i].unicode, buf, tests[i].latex );
+			failed++;
+		}
+		p = uni2latex_str( tests[i].unicode, &len );
+		if ( p && ( len!=(int) strlen( p ) || strcmp( p, tests[i].latex ) ) ) {
+			printf( "%s: Error uni2latex_str( 0x%X ) returned '%s' length %d, expected '%s'\n", progname, tests[i].unicode, p, len, tests[i].latex );
+			failed++;
+		}
+	}
+
+	/* output is cut to fit */
+	uni2latex( 0x3B1, small, sizeof( small ) );
+	if ( strcmp( small, "$\\a" ) ) {
+		printf( "%s: Error uni2latex( 0x3B1 ) into %d bytes returned '%s', expected '%s'\n", progname, (int) sizeof( small ), small, "$\\a" );
+		failed++;
+	}
+	return failed;
+}
+
+int
+main( int argc, char *argv[] )
+{
+	int failed = 0;
+	failed += test_latex2char();
+	failed += test_uni2latex();
+	if ( !failed ) {
+		printf( "%s: PASSED\n", progname );
+		return EXIT_SUCCESS;
+	} else {
+		printf( "%s: FAILED\n", progname );
+		return EXIT_FAILURE;
+	}
+}
@@ -0,0 +1,153 @@
+/*
+ * memstats_test.c
+ *
+ * Copyright (c) 2017
+ *
+ * Source code released under the GPL version 2
+ *
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include "str.h"
+#include "slist.h"
+#include "fields.h"
+#include "memstats.h"
+
+char progname[] = "memstats_test";
+
+int
+test_str( void )
+{
+	memstats before, grown, after;
+	int failed = 0;
+	str s;
+
+	memstats_get( MEMSTATS_STR, &before );
+	str_init( &s );
+	str_strcpyc( &s, "short" );
+	str_strcatc( &s, "...and a string long enough to leave the inline buffer" );
+	str_strcatc( &s, "...and then long enough to be reallocated on the heap at least once" );
+	memstats_get( MEMSTATS_STR, &grown );
+	str_free( &s );
+	memstats_get( MEMSTATS_STR, &after );
+
+	if ( grown.nalloc != before.nalloc + 1 ) {
+		printf( "%s: Error str allocations %ld, expected %ld\n", progname, grown.nalloc, before.nalloc + 1 );
+		failed++;
+	}
+	if ( grown.nrealloc <= before.nrealloc ) {
+		printf( "%s: Error str reallocations %ld, expected more than %ld\n", progname, grown.nrealloc, before.nrealloc );
+		failed++;
+	}
+	if ( grown.live <= before.live || grown.peak < grown.live ) {
+		printf( "%s: Error str live %ld peak %ld after growing\n", progname, grown.live, grown.peak );
+		failed++;
+	}
+	if ( after.live != before.live || after.peak != grown.peak ) {
+		printf( "%s: Error str live %ld peak %ld after str_free(), expected %ld and %ld\n", progname, after.live, after.peak, before.live, grown.peak );
+		failed++;
+	}
+	return failed;
+}
+
+int
+test_slist( void )
+{
+	memstats before, after, all;
+	int failed = 0, i;
+	slist a;
+
+	memstats_get( MEMSTATS_SLIST, &before );
+	slist_init( &a );
+	for ( i=0; i<100; ++i )
+		slist_addc( &a, "x" );
+	slist_free( &a );
+	memstats_get( MEMSTATS_SLIST, &after );
+	memstats_get( MEMSTATS_ALL, &all );
+
+	if ( after.nalloc + after.nrealloc <= before.nalloc + before.nrealloc ) {
+		printf( "%s: Error slist growth was not counted\n", progname );
+		failed++;
+	}
+	if ( after.live != before.live ) {
+		printf( "%s: Error slist live %ld after slist_free(), expected %ld\n", progname, after.live, before.live );
+		failed++;
+	}
+	if ( all.nalloc < after.nalloc || all.peak < after.peak ) {
+		printf( "%s: Error total counters below those of slist\n", progname );
+		failed++;
+	}
+	return failed;
+}
+
+/* fill fields enough to build the duplicate check set and pool the values;
+ * returns the number of errors, with the counters before fields_free() and
+ * the bytes of the entries and index in grown and entries */
+static int
+fields_round( memstats *grown, long *entries )
+{
+	char tag[16], value[16];
+	int i, failed = 0;
+	fields f;
+
+	fields_init( &f );
+	for ( i=0; i<100; ++i ) {
+		sprintf( tag, "TAG%d", i % 10 );
+		sprintf( value, "value %d", i );
+		if ( fields_add( &f, tag, value, LEVEL_MAIN )!=FIELDS_OK ) failed++;
+	}
+	if ( fields_find( &f, "TAG3", LEVEL_MAIN )==-1 ) failed++;
+	if ( fields_intern( &f )!=FIELDS_OK ) failed++;
+	memstats_get( MEMSTATS_FIELDS, grown );
+	*entries = sizeof( fields_entry ) * f.max + sizeof( fields_slot ) * f.maxindex;
+	fields_free( &f );
+	return failed;
+}
+
+int
+test_fields( void )
+{
+	memstats before, grown, after;
+	int failed = 0;
+	long entries;
+
+	/* the first round also allocates the value pool's table, which is kept */
+	failed += fields_round( &grown, &entries );
+
+	memstats_get( MEMSTATS_FIELDS, &before );
+	failed += fields_round( &grown, &entries );
+	memstats_get( MEMSTATS_FIELDS, &after );
+
+	if ( failed )
+		printf( "%s: Error building the fields\n", progname );
+	if ( grown.live - before.live <= entries ) {
+		printf( "%s: Error fields live %ld above %ld, expected more than the %ld of the entries\n", progname, grown.live - before.live, before.live, entries );
+		failed++;
+	}
+	if ( after.live != before.live ) {
+		printf( "%s: Error fields live %ld after fields_free(), expected %ld\n", progname, after.live, before.live );
+		failed++;
+	}
+	return failed;
+}
+
+int
+main( int argc, char *argv[] )
+{
+	memstats m;
+	int failed = 0;
+	if ( !memstats_get( MEMSTATS_ALL, &m ) ) {
+		printf( "%s: PASSED (counters not compiled in)\n", progname );
+		return EXIT_SUCCESS;
+	}
+	failed += test_str();
+	failed += test_slist();
+	failed += test_fields();
+	if ( !failed ) {
+		printf( "%s: PASSED\n", progname );
+		return EXIT_SUCCESS;
+	} else {
+		printf( "%s: FAILED\n", progname );
+		return EXIT_FAILURE;
+	}
+}
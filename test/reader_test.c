@@ -0,0 +1,149 @@
+/*
+ * reader_test.c
+ *
+ * Copyright (c) 2017
+ *
+ * Source code released under the GPL version 2
+ *
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "reader.h"
+
+char progname[] = "reader_test";
+
+typedef struct test_t {
+	char *in;
+	int nlines;
+	char *lines[5];
+} test_t;
+
+static FILE *
+make_file( const char *data, unsigned long n )
+{
+	FILE *fp = tmpfile();
+	if ( !fp ) {
+		printf( "%s: Cannot open temporary file\n", progname );
+		exit( EXIT_FAILURE );
+	}
+	fwrite( data, 1, n, fp );
+	rewind( fp );
+	return fp;
+}
+
+int
+test_line_breaks( void )
+{
+	test_t tests[] = {
+		{ "",                  0, { NULL } },
+		{ "one",               1, { "one" } },
+		{ "one\ntwo\n",        2, { "one", "two" } },
+		{ "one\r\ntwo\r\n",    2, { "one", "two" } },
+		{ "one\rtwo\r",        2, { "one", "two" } },
+		{ "one\n\rtwo",        2, { "one", "two" } },
+		{ "one\n\ntwo",        3, { "one", "", "two" } },
+		{ "one\r\n\r\ntwo",    3, { "one", "", "two" } },
+		{ "\n",                1, { "" } },
+		{ "one\ntwo\rthree\r\nfour", 4, { "one", "two", "three", "four" } },
+	};
+	int ntests = sizeof( tests ) / sizeof( tests[0] );
+	int failed = 0;
+	int i, n;
+	reader r;
+	FILE *fp;
+	str line;
+
+	str_init( &line );
+	for ( i=0; i<ntests; ++i ) {
+		fp = make_file( tests[i].in, strlen( tests[i].in ) );
+		reader_init( &r, fp );
+		n = 0;
+		while ( reader_getline( &r, &line ) ) {
+			if ( n < tests[i].nlines && strcmp( str_cstr( &line ) ? str_cstr( &line ) : "", tests[i].lines[n] ) ) {
+				printf( "%s: Error test %d line %d returned '%s', expected '%s'\n", progname, i, n, str_cstr( &line ), tests[i].lines[n] );
+				failed++;
+			}
+			n++;
+		}
+		if ( n != tests[i].nlines ) {
+			printf( "%s: Error test %d returned %d lines, expected %d\n", progname, i, n, tests[i].nlines );
+			failed++;
+		}
+		reader_free( &r );
+		fclose( fp );
+	}
+	str_free( &line );
+	return failed;
+}
+
+/* lines and "\r\n" breaks that straddle two blocks */
+int
+test_block_boundary( void )
+{
+	unsigned long n = READER_BUFSIZE + 100;
+	int failed = 0;
+	char *data;
+	reader r;
+	FILE *fp;
+	str line;
+
+	data = ( char * ) malloc( n );
+	if ( !data ) return 1;
+
+	str_init( &line );
+
+	memset( data, 'a', n );
+	data[ READER_BUFSIZE-1 ] = '\r';
+	data[ READER_BUFSIZE ]   = '\n';
+	fp = make_file( data, n );
+	reader_init( &r, fp );
+	if ( !reader_getline( &r, &line ) || line.len != READER_BUFSIZE-1 ) {
+		printf( "%s: Error first line has length %lu, expected %lu\n", progname, line.len, (unsigned long) READER_BUFSIZE-1 );
+		failed++;
+	}
+	if ( !reader_getline( &r, &line ) || line.len != 99 ) {
+		printf( "%s: Error second line has length %lu, expected 99\n", progname, line.len );
+		failed++;
+	}
+	if ( reader_getline( &r, &line ) ) {
+		printf( "%s: Error found a third line\n", progname );
+		failed++;
+	}
+	reader_free( &r );
+	fclose( fp );
+
+	memset( data, 'b', n );
+	data[ 10 ] = '\n';
+	fp = make_file( data, n );
+	reader_init( &r, fp );
+	if ( !reader_getline( &r, &line ) || line.len != 10 ) {
+		printf( "%s: Error first line has length %lu, expected 10\n", progname, line.len );
+		failed++;
+	}
+	if ( !reader_getline( &r, &line ) || line.len != n-11 ) {
+		printf( "%s: Error long line has length %lu, expected %lu\n", progname, line.len, n-11 );
+		failed++;
+	}
+	reader_free( &r );
+	fclose( fp );
+
+	str_free( &line );
+	free( data );
+	return failed;
+}
+
+int
+main( int argc, char *argv[] )
+{
+	int failed = 0;
+	failed += test_line_breaks();
+	failed += test_block_boundary();
+	if ( !failed ) {
+		printf( "%s: PASSED\n", progname );
+		return EXIT_SUCCESS;
+	} else {
+		printf( "%s: FAILED\n", progname );
+		return EXIT_FAILURE;
+	}
+}
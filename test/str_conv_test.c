@@ -0,0 +1,179 @@
+/*
+ * str_conv_test.c
+ *
+ * Copyright (c) 2017
+ *
+ * Source code released under the GPL version 2
+ *
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "charsets.h"
+#include "str.h"
+#include "str_conv.h"
+
+char progname[] = "str_conv_test";
+
+/* convert in with c, and check against expected */
+static int
+check( str_conv *c, const char *in, const char *expected )
+{
+	str s;
+	int failed = 0;
+	str_initstrc( &s, in );
+	if ( !str_conv_convert( c, &s ) ) {
+		printf( "%s: Error str_conv_convert( '%s' ) reported a memory error\n", progname, in );
+		failed++;
+	} else if ( strcmp( str_cstr( &s ), expected ) ) {
+		printf( "%s: Error str_conv_convert( '%s' ) returned '%s', expected '%s'\n", progname, in, str_cstr( &s ), expected );
+		failed++;
+	}
+	str_free( &s );
+	return failed;
+}
+
+/* escaping for XML, with runs on both sides of the 16 byte blocks */
+int
+test_xmlout( void )
+{
+	str_conv xml, entities;
+	int failed = 0;
+
+	str_conv_init( &xml, CHARSET_UNICODE, 0, 1, 0, CHARSET_UNICODE, 0, 1, 1 );
+	str_conv_init( &entities, CHARSET_UNICODE, 0, 1, 0, CHARSET_UNICODE, 0, 1, 3 );
+
+	failed += check( &xml, "a<b", "a&lt;b" );
+	failed += check( &xml, "\"&'<>", "&quot;&amp;&apos;&lt;&gt;" );
+	failed += check( &xml, "Smith & Wesson, G\xc3\xb6teborg", "Smith &amp; Wesson, G\xc3\xb6teborg" );
+	failed += check( &xml, "0123456789abcde&", "0123456789abcde&amp;" );
+	failed += check( &xml, "0123456789abcdef&", "0123456789abcdef&amp;" );
+	failed += check( &xml, "0123456789abcde\xc3\xa5<0123456789abcdef>", "0123456789abcde\xc3\xa5&lt;0123456789abcdef&gt;" );
+	failed += check( &xml, "\xe2\x80\x94\xf0\x9f\x98\x80 & \xc3\xa4", "\xe2\x80\x94\xf0\x9f\x98\x80 &amp; \xc3\xa4" );
+	failed += check( &xml, "bad \xc3 byte", "bad ? byte" );
+
+	failed += check( &entities, "G\xc3\xb6teborg & co", "G&#246;teborg &amp; co" );
+	failed += check( &entities, "\xe2\x80\x94\xf0\x9f\x98\x80", "&#8212;&#128512;" );
+
+	return failed;
+}
+
+static int
+check_counts( str_conv *c, unsigned long nhit, unsigned long nmiss )
+{
+	if ( c->nhit!=nhit || c->nmiss!=nmiss ) {
+		printf( "%s: Error cache hits %lu misses %lu, expected %lu and %lu\n", progname, c->nhit, c->nmiss, nhit, nmiss );
+		return 1;
+	}
+	return 0;
+}
+
+int
+test_cache( void )
+{
+	str_conv c;
+	int failed = 0;
+
+	str_conv_init( &c, CHARSET_UNICODE, 1, 1, 0, CHARSET_UNICODE, 0, 1, 0 );
+	failed += check( &c, "{\\'e}t\\'e", "\xc3\xa9t\xc3\xa9" );
+	failed += check_counts( &c, 0, 0 );
+
+	if ( !str_conv_cache( &c, 2 ) ) {
+		printf( "%s: Error str_conv_cache() reported a memory error\n", progname );
+		return failed + 1;
+	}
+
+	/* values with nothing to convert don't go through the cache */
+	failed += check( &c, "plain", "plain" );
+	failed += check_counts( &c, 0, 0 );
+
+	failed += check( &c, "{\\'e}t\\'e", "\xc3\xa9t\xc3\xa9" );
+	failed += check( &c, "{\\'e}t\\'e", "\xc3\xa9t\xc3\xa9" );
+	failed += check_counts( &c, 1, 1 );
+
+	/* same bytes up to the length */
+	failed += check( &c, "{\\'e}t\\'e ", "\xc3\xa9t\xc3\xa9 " );
+	failed += check_counts( &c, 1, 2 );
+
+	/* a third value replaces the least recently used one */
+	failed += check( &c, "{\\'e}t\\'e", "\xc3\xa9t\xc3\xa9" );
+	failed += check( &c, "na\\\"ive", "na\xc3\xafve" );
+	failed += check_counts( &c, 2, 3 );
+	failed += check( &c, "{\\'e}t\\'e", "\xc3\xa9t\xc3\xa9" );
+	failed += check_counts( &c, 3, 3 );
+	failed += check( &c, "{\\'e}t\\'e ", "\xc3\xa9t\xc3\xa9 " );
+	failed += check_counts( &c, 3, 4 );
+
+	/* a smaller cache starts over */
+	if ( !str_conv_cache( &c, 1 ) ) {
+		printf( "%s: Error str_conv_cache() reported a memory error\n", progname );
+		return failed + 1;
+	}
+	failed += check( &c, "na\\\"ive", "na\xc3\xafve" );
+	failed += check( &c, "{\\'e}t\\'e", "\xc3\xa9t\xc3\xa9" );
+	failed += check( &c, "{\\'e}t\\'e", "\xc3\xa9t\xc3\xa9" );
+	failed += check_counts( &c, 4, 6 );
+
+	str_conv_free( &c );
+	return failed;
+}
+
+/* many values through a small cache, against the same conversion without one */
+int
+test_cache_many( void )
+{
+	char letters[] = "ae\\'\"{}<&;x";
+	str_conv plain, cached;
+	char buf[12];
+	int failed = 0, i, j, k;
+	str a, b;
+
+	str_conv_init( &plain, CHARSET_UNICODE, 1, 1, 0, CHARSET_UNICODE, 0, 1, 3 );
+	str_conv_init( &cached, CHARSET_UNICODE, 1, 1, 0, CHARSET_UNICODE, 0, 1, 3 );
+	if ( !str_conv_cache( &cached, 7 ) ) {
+		printf( "%s: Error str_conv_cache() reported a memory error\n", progname );
+		return 1;
+	}
+	strs_init( &a, &b, NULL );
+
+	srand( 1 );
+	for ( i=0; i<20000; ++i ) {
+		k = 1 + rand() % ( sizeof( buf ) - 1 );
+		for ( j=0; j<k; ++j ) buf[j] = letters[ rand() % 4 ];
+		buf[k] = '\0';
+		if ( rand() % 2 ) buf[ rand() % k ] = letters[ rand() % 11 ];
+		str_strcpyc( &a, buf );
+		str_strcpyc( &b, buf );
+		str_conv_convert( &plain, &a );
+		str_conv_convert( &cached, &b );
+		if ( strcmp( str_cstr( &a ), str_cstr( &b ) ) ) {
+			printf( "%s: Error cached conversion of '%s' gave '%s', expected '%s'\n", progname, buf, str_cstr( &b ), str_cstr( &a ) );
+			failed++;
+			break;
+		}
+	}
+	if ( !cached.nhit || !cached.nmiss ) {
+		printf( "%s: Error cache hits %lu misses %lu, expected some of each\n", progname, cached.nhit, cached.nmiss );
+		failed++;
+	}
+
+	strs_free( &a, &b, NULL );
+	str_conv_free( &cached );
+	return failed;
+}
+
+int
+main( int argc, char *argv[] )
+{
+	int failed = 0;
+	failed += test_xmlout();
+	failed += test_cache();
+	failed += test_cache_many();
+	if ( !failed ) {
+		printf( "%s: PASSED\n", progname );
+		return EXIT_SUCCESS;
+	} else {
+		printf( "%s: FAILED\n", progname );
+		return EXIT_FAILURE;
+	}
+}
@@ -161,6 +161,37 @@ test_strcatc( str *s )
 	return failed;
 }
 
+static int
+test_strncatc( str *s )
+{
+	int numchars = 1000, i;
+	int failed = 0;
+	char *p = "family|given|";
+
+	/* ...adding zero characters shouldn't change the string */
+	str_empty( s );
+	str_strncatc( s, p, 0 );
+	if ( string_mismatch( s, 0, "" ) ) failed++;
+	str_strcpyc( s, "1" );
+	str_strncatc( s, p, 0 );
+	if ( string_mismatch( s, 1, "1" ) ) failed++;
+
+	/* ...add spans up to a delimiter */
+	str_empty( s );
+	str_strncatc( s, p, strcspn( p, "|" ) );
+	if ( string_mismatch( s, 6, "family" ) ) failed++;
+	str_strncatc( s, p+6, 6 );
+	if ( string_mismatch( s, 12, "family|given" ) ) failed++;
+
+	/* ...build a long string from one character spans */
+	str_empty( s );
+	for ( i=0; i<numchars; ++i )
+		str_strncatc( s, p+(i%6), 1 );
+	if ( inconsistent_len( s, numchars ) ) failed++;
+
+	return failed;
+}
+
 static int
 test_strcat( str *s )
 {
@@ -1024,6 +1055,92 @@ test_swapstrings( str *s )
 	return failed;
 }
 
+static int
+test_inline( str *s )
+{
+	char buf[ STR_INLINE*2 ];
+	int failed = 0, i;
+	str t, u, moved[2];
+
+	strs_init( &t, &u, NULL );
+
+	/* ...longest string that fits in the inline buffer */
+	memset( buf, 'a', sizeof( buf ) );
+	buf[STR_INLINE-1] = '\0';
+	str_strcpyc( &t, buf );
+	if ( string_mismatch( &t, STR_INLINE-1, buf ) ) failed++;
+	if ( t.data!=t.inbuf ) {
+		fprintf( stdout, "%s line %d: %d characters should be inline\n", __FUNCTION__, __LINE__, STR_INLINE-1 );
+		failed++;
+	}
+
+	/* ...one more character moves it to the heap */
+	str_addchar( &t, 'b' );
+	buf[STR_INLINE-1] = 'b';
+	buf[STR_INLINE] = '\0';
+	if ( string_mismatch( &t, STR_INLINE, buf ) ) failed++;
+	if ( t.data==t.inbuf ) {
+		fprintf( stdout, "%s line %d: %d characters should not be inline\n", __FUNCTION__, __LINE__, STR_INLINE );
+		failed++;
+	}
+	str_free( &t );
+	if ( string_mismatch( &t, 0, "" ) ) failed++;
+
+	/* ...growing one character at a time across the boundary */
+	for ( i=0; i<STR_INLINE*2-1; ++i ) {
+		str_addchar( &t, '0' + i%10 );
+		buf[i] = '0' + i%10;
+		buf[i+1] = '\0';
+		if ( string_mismatch( &t, i+1, buf ) ) failed++;
+	}
+	str_free( &t );
+
+	/* ...copying exactly STR_INLINE-1, STR_INLINE and STR_INLINE+1 characters */
+	for ( i=STR_INLINE-1; i<=STR_INLINE+1; ++i ) {
+		memset( buf, 'c', i );
+		buf[i] = '\0';
+		str_strcpyc( &u, buf );
+		if ( string_mismatch( &u, i, buf ) ) failed++;
+		str_free( &u );
+	}
+
+	/* ...prepending across the boundary */
+	str_strcpyc( &t, "0123456789" );
+	str_prepend( &t, "abcdefghijklmnop" );
+	if ( string_mismatch( &t, 26, "abcdefghijklmnop0123456789" ) ) failed++;
+	str_free( &t );
+
+	/* ...swapping inline with inline and heap strings */
+	str_strcpyc( &t, "short" );
+	str_strcpyc( &u, "another short" );
+	str_swapstrings( &t, &u );
+	if ( string_mismatch( &t, 13, "another short" ) ) failed++;
+	if ( string_mismatch( &u, 5, "short" ) ) failed++;
+	str_strcpyc( s, "a string that is too long to be inline" );
+	str_swapstrings( s, &u );
+	if ( string_mismatch( s, 5, "short" ) ) failed++;
+	if ( string_mismatch( &u, 38, "a string that is too long to be inline" ) ) failed++;
+	if ( s->data!=s->inbuf ) {
+		fprintf( stdout, "%s line %d: swapped str should point at its own inline buffer\n", __FUNCTION__, __LINE__ );
+		failed++;
+	}
+
+	/* ...moving strs in memory */
+	memcpy( &(moved[0]), &t, sizeof( str ) );
+	memcpy( &(moved[1]), &u, sizeof( str ) );
+	str_relocate( &(moved[0]) );
+	str_relocate( &(moved[1]) );
+	str_empty( &t );
+	if ( string_mismatch( &(moved[0]), 13, "another short" ) ) failed++;
+	if ( string_mismatch( &(moved[1]), 38, "a string that is too long to be inline" ) ) failed++;
+	str_addchar( &(moved[0]), '!' );
+	if ( string_mismatch( &(moved[0]), 14, "another short!" ) ) failed++;
+
+	strs_free( &(moved[0]), &(moved[1]), NULL );
+
+	return failed;
+}
+
 int
 main ( int argc, char *argv[] )
 {
@@ -1044,6 +1161,8 @@ main ( int argc, char *argv[] )
 		failed += test_strcatc( &s );
 	for ( i=0; i<ntest; ++i )
 		failed += test_strcat( &s );
+	for ( i=0; i<ntest; ++i )
+		failed += test_strncatc( &s );
 	for ( i=0; i<ntest; ++i )
 		failed += test_segcat( &s );
 	for ( i=0; i<ntest; ++i )
@@ -1098,6 +1217,8 @@ main ( int argc, char *argv[] )
 		failed += test_swapstrings( &s );
 	for ( i=0; i<ntest; ++i )
 		failed += test_match( &s );
+	for ( i=0; i<ntest; ++i )
+		failed += test_inline( &s );
 
 	str_free( &s );
 
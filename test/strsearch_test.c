@@ -0,0 +1,132 @@
+/*
+ * strsearch_test.c
+ *
+ * Copyright (c) 2017
+ *
+ * Source code released under the GPL version 2
+ *
+ * strsearch_test         check strsearch() against strsearch_scalar()
+ * strsearch_test -b      also time both on a MODS-like buffer
+ *
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "strsearch.h"
+
+char progname[] = "strsearch_test";
+
+typedef struct test_t {
+	char *haystack;
+	char *needle;
+	int expected;   /* offset of the match, -1 if none */
+} test_t;
+
+int
+test_strsearch( void )
+{
+	test_t tests[] = {
+		{ "",                         "",           0 },
+		{ "abc",                      "",           0 },
+		{ "",                         "a",         -1 },
+		{ "abc",                      "a",          0 },
+		{ "abc",                      "C",          2 },
+		{ "abc",                      "abcd",      -1 },
+		{ "<mods ID=\"a\">",          "<MODS ",     0 },
+		{ "<modsCollection><mods>",   "<mods>",    16 },
+		{ "xxxxxxxxxxxxxxx<mods>",    "<mods>",    15 },
+		{ "xxxxxxxxxxxxxxxx<mods>",   "<mods>",    16 },
+		{ "<mod<mods>",               "<mods>",     4 },
+		{ "aaaaaaaaaaaaaaaaaaaaab",   "aab",       19 },
+		{ "</RECORD>",                "</record>",  0 },
+		{ "xxxxxxxxxxxxxxx<",         "<m",        -1 },
+	};
+	int ntests = sizeof( tests ) / sizeof( tests[0] );
+	int failed = 0;
+	char *found;
+	int i, off;
+
+	for ( i=0; i<ntests; ++i ) {
+		found = strsearch( tests[i].haystack, tests[i].needle );
+		off = ( found ) ? (int)( found - tests[i].haystack ) : -1;
+		if ( off != tests[i].expected ) {
+			printf( "%s: Error strsearch( '%s', '%s' ) returned %d, expected %d\n", progname, tests[i].haystack, tests[i].needle, off, tests[i].expected );
+			failed++;
+		}
+	}
+	return failed;
+}
+
+/* every start offset and length against the scalar search */
+int
+test_strsearch_alignment( void )
+{
+	char letters[] = "aAbB<>/ ";
+	char buf[80], needle[4];
+	int failed = 0;
+	char *a, *b;
+	int i, j, k;
+
+	srand( 1 );
+	for ( i=0; i<20000; ++i ) {
+		k = rand() % ( sizeof( buf ) - 1 );
+		for ( j=0; j<k; ++j ) buf[j] = letters[ rand() % 8 ];
+		buf[k] = '\0';
+		k = 1 + rand() % ( sizeof( needle ) - 1 );
+		for ( j=0; j<k; ++j ) needle[j] = letters[ rand() % 8 ];
+		needle[k] = '\0';
+		for ( j=0; buf[j]; ++j ) {
+			a = strsearch( &(buf[j]), needle );
+			b = strsearch_scalar( &(buf[j]), needle );
+			if ( a!=b ) {
+				printf( "%s: Error strsearch( '%s', '%s' ) differs from strsearch_scalar()\n", progname, &(buf[j]), needle );
+				failed++;
+				break;
+			}
+		}
+	}
+	return failed;
+}
+
+static double
+bench( char *(*f)( const char *, const char * ), const char *haystack, const char *needle, int n )
+{
+	clock_t start = clock();
+	int i;
+	for ( i=0; i<n; ++i )
+		if ( f( haystack, needle ) ) return -1.0;
+	return (double)( clock() - start ) / CLOCKS_PER_SEC;
+}
+
+void
+benchmark( void )
+{
+	const char record[] = "<mods ID=\"x\"><titleInfo><title>Title</title></titleInfo>"
+		"<name type=\"personal\"><namePart type=\"family\">Name</namePart></name>\n";
+	unsigned long len = 4*1024*1024, n = strlen( record ), i;
+	char *buf = ( char * ) malloc( len + 1 );
+	if ( !buf ) return;
+	for ( i=0; i+n<=len; i+=n ) memcpy( buf+i, record, n );
+	buf[i] = '\0';
+	printf( "%s: 100 x %lu bytes, needle not found\n", progname, i );
+	printf( "%s:   strsearch_scalar %.3f s\n", progname, bench( strsearch_scalar, buf, "</modsCollection>", 100 ) );
+	printf( "%s:   strsearch        %.3f s\n", progname, bench( strsearch, buf, "</modsCollection>", 100 ) );
+	free( buf );
+}
+
+int
+main( int argc, char *argv[] )
+{
+	int failed = 0;
+	failed += test_strsearch();
+	failed += test_strsearch_alignment();
+	if ( argc > 1 && !strcmp( argv[1], "-b" ) ) benchmark();
+	if ( !failed ) {
+		printf( "%s: PASSED\n", progname );
+		return EXIT_SUCCESS;
+	} else {
+		printf( "%s: FAILED\n", progname );
+		return EXIT_FAILURE;
+	}
+}
@@ -8,6 +8,7 @@
  */
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include "utf8.h"
 
 char progname[] = "utf8_test";
@@ -41,12 +42,83 @@ test_utf8( void )
 	return failed;
 }
 
+typedef struct validate_t {
+	char *s;
+	long expected;  /* offset of the first bad byte, -1 if none */
+} validate_t;
+
+int
+test_utf8_validate( void )
+{
+	validate_t tests[] = {
+		{ "",                                    -1 },
+		{ "plain ascii text that is long enough", -1 },
+		{ "G\xC3\xB6teborg",                     -1 },
+		{ "\xE2\x80\x94 \xF0\x9F\x98\x80",  -1 },
+		{ "0123456789abcdef\xE9t\xE9",           16 },
+		{ "abc\xC3",                              3 },  /* truncated */
+		{ "abc\x80",                              3 },  /* lone continuation */
+		{ "\xC0\xAF",                            0 },  /* overlong */
+		{ "\xE0\x80\xAF",                       0 },  /* overlong */
+		{ "\xED\xA0\x80",                       0 },  /* surrogate */
+		{ "\xF4\x90\x80\x80",                  0 },  /* past U+10FFFF */
+		{ "\xF8\x88\x80\x80\x80",             0 },  /* five bytes */
+	};
+	int ntests = sizeof( tests ) / sizeof( tests[0] );
+	int failed = 0, i;
+	long off;
+
+	for ( i=0; i<ntests; ++i ) {
+		off = utf8_validate( tests[i].s, strlen( tests[i].s ) );
+		if ( off!=tests[i].expected ) {
+			printf( "%s: Error test_utf8_validate test %d returned %ld, "
+				"expected %ld\n", progname, i, off, tests[i].expected );
+			failed = 1;
+		}
+	}
+
+	/* the ASCII run ends at the first byte with the high bit set, at every offset */
+	{
+		char buf[64];
+		unsigned long n;
+		for ( i=0; i<(int) sizeof( buf ) - 1; ++i ) {
+			memset( buf, 'a', sizeof( buf ) - 1 );
+			buf[ sizeof( buf ) - 1 ] = '\0';
+			buf[i] = (char) 0xC3;
+			n = utf8_ascii_span( buf, sizeof( buf ) - 1 );
+			if ( n!=(unsigned long) i ) {
+				printf( "%s: Error test_utf8_validate ASCII run %lu, "
+					"expected %d\n", progname, n, i );
+				failed = 1;
+			}
+		}
+	}
+	return failed;
+}
+
+/* a truncated character decodes to '?' without passing the '\0' */
+int
+test_utf8_truncated( void )
+{
+	char buf[] = "a\xE2\x80";
+	unsigned int pos = 1, c;
+	int failed = 0;
+	c = utf8_decode( buf, &pos );
+	if ( c!='?' || pos!=2 ) {
+		printf( "%s: Error test_utf8_truncated returned %u at %u, "
+			"expected '?' at 2\n", progname, c, pos );
+		failed = 1;
+	}
+	return failed;
+}
 
 int
 main( int argc, char *argv[] )
 {
 	int failed = 0;
 	failed += test_utf8();
+	failed += test_utf8_validate();
+	failed += test_utf8_truncated();
 	if ( !failed ) {
 		printf( "%s: PASSED\n", progname );
 		return EXIT_SUCCESS;